@@ -267,6 +267,12 @@ OPENMP_LIB =
 # Used when MFEM_TIMER_TYPE = 2
 POSIX_CLOCKS_LIB = -lrt
 
+# Used by the std::thread backend, Backend::CPU_THREADS
+THREADS_LIB = $(if $(NOTMAC),-lpthread,)
+
+# Used by the runtime kernel compilation, see JitCompiler
+DL_LIB = $(if $(NOTMAC),-ldl,)
+
 # SUNDIALS library configuration
 # For sundials_nvecmpiplusx and nvecparallel remember to build with MPI_ENABLE=ON
 # and modify cmake variables for hypre for sundials
@@ -13,8 +13,10 @@
 
 #include "fem.hpp"
 #include "../general/device.hpp"
+#include "../general/annotation.hpp"
 #include "../mesh/nurbs.hpp"
 #include <cmath>
+#include <algorithm>
 
 namespace mfem
 {
@@ -462,6 +464,7 @@ void BilinearForm::AssembleBdrElementMatrix(
 
 void BilinearForm::Assemble(int skip_zeros)
 {
+   MFEM_PERF_FUNCTION;
    if (ext)
    {
       ext->Assemble();
@@ -832,6 +835,7 @@ void BilinearForm::FormLinearSystem(const Array<int> &ess_tdof_list, Vector &x,
                                     Vector &b, OperatorHandle &A, Vector &X,
                                     Vector &B, int copy_interior)
 {
+   MFEM_PERF_FUNCTION;
    if (ext)
    {
       ext->FormLinearSystem(ess_tdof_list, x, b, A, X, B, copy_interior);
@@ -1011,6 +1015,41 @@ void BilinearForm::ComputeElementMatrices()
    element_matrices = new DenseTensor(num_dofs_per_el, num_dofs_per_el,
                                       num_elements);
 
+#ifndef MFEM_USE_LEGACY_OPENMP
+   // When all the elements have the same finite element, the integrators add
+   // the element matrices of batches of elements, see
+   // BilinearFormIntegrator::AddElementMatrices().
+   bool batched = !fes->GetNURBSext();
+   for (int i = 1; batched && i < num_elements; i++)
+   {
+      batched = (fes->GetFE(i) == fes->GetFE(0));
+   }
+   if (batched)
+   {
+      const int batch_size = 256;
+      Array<int> elems;
+      DenseMatrixBatch elmats;
+      for (int b = 0; b < num_elements; b += batch_size)
+      {
+         const int n = std::min(batch_size, num_elements - b);
+         elems.SetSize(n);
+         for (int k = 0; k < n; k++) { elems[k] = b + k; }
+         elmats.SetSize(num_dofs_per_el, num_dofs_per_el, n);
+         for (int k = 0; k < domain_integs.Size(); k++)
+         {
+            domain_integs[k]->AddElementMatrices(*fes, elems, elmats);
+         }
+         for (int k = 0; k < n; k++)
+         {
+            DenseMatrix elmat(element_matrices->GetData(b + k),
+                              num_dofs_per_el, num_dofs_per_el);
+            elmats.GetMatrix(k, elmat);
+         }
+      }
+      return;
+   }
+#endif
+
    DenseMatrix tmp;
    IsoparametricTransformation eltrans;
 
@@ -1194,6 +1233,19 @@ void BilinearForm::Mult(const Vector &x, Vector &y) const
    }
 }
 
+void BilinearForm::ArrayMult(const Array<const Vector *> &X,
+                             Array<Vector *> &Y) const
+{
+   if (ext)
+   {
+      ext->ArrayMult(X, Y);
+   }
+   else
+   {
+      mat->ArrayMult(X, Y);
+   }
+}
+
 void BilinearForm::MultTranspose(const Vector & x, Vector & y) const
 {
    if (ext)
@@ -302,6 +302,13 @@ public:
    /// Matrix vector multiplication:  $ y = M x $
    void Mult(const Vector &x, Vector &y) const override;
 
+   /** @brief Matrix multiplication of several vectors: Y[j] = A X[j]. The
+       partial assembly and the assembled matrix apply the operator to all
+       the vectors at once, see PABilinearFormExtension::ArrayMult() and
+       SparseMatrix::ArrayMult(). */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
    /** @brief Matrix vector multiplication with the original uneliminated
        matrix.  The original matrix is $ M + M_e $ so we have:
        $ y = M x + M_e x $ */
@@ -570,6 +577,9 @@ public:
                            Vector &x) override;
 
    /// Compute and store internally all element matrices.
+   /** When all the elements have the same finite element, the element
+       matrices are computed in batches of elements with
+       BilinearFormIntegrator::AddElementMatrices(). */
    void ComputeElementMatrices();
 
    /// Free the memory used by the element matrices.
@@ -549,6 +549,31 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
    MFEM_VERIFY(!(somePatchwise && !allPatchwise),
                "All or none of the integrators should be patchwise");
 
+   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
+   const int iFISz = intFaceIntegrators.Size();
+
+   // When assembling interior face integrators for DG spaces, we need to
+   // exchange the face-neighbor information. This happens inside member
+   // functions of the 'int_face_restrict_lex'. To avoid repeated calls to
+   // ParGridFunction::ExchangeFaceNbrData, if we have a parallel space
+   // with interior face integrators, we create a ParGridFunction that
+   // will be used to cache the face-neighbor data. x_dg should be passed
+   // to any restriction operator that may need to use face-neighbor data.
+   // The exchange is started here and overlapped with the element terms.
+   const Vector *x_dg = &x;
+#ifdef MFEM_USE_MPI
+   ParGridFunction x_pgf;
+   if (int_face_restrict_lex && iFISz>0)
+   {
+      if (auto *pfes = dynamic_cast<ParFiniteElementSpace*>(a->FESpace()))
+      {
+         x_pgf.MakeRef(pfes, const_cast<Vector&>(x), 0);
+         x_pgf.ExchangeFaceNbrDataBegin();
+         x_dg = &x_pgf;
+      }
+   }
+#endif
+
    if (DeviceCanUseCeed() || !elem_restrict || allPatchwise)
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
@@ -585,27 +610,11 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
       }
    }
 
-   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
-   const int iFISz = intFaceIntegrators.Size();
    if (int_face_restrict_lex && iFISz>0)
    {
-      // When assembling interior face integrators for DG spaces, we need to
-      // exchange the face-neighbor information. This happens inside member
-      // functions of the 'int_face_restrict_lex'. To avoid repeated calls to
-      // ParGridFunction::ExchangeFaceNbrData, if we have a parallel space
-      // with interior face integrators, we create a ParGridFunction that
-      // will be used to cache the face-neighbor data. x_dg should be passed
-      // to any restriction operator that may need to use face-neighbor data.
-      const Vector *x_dg = &x;
 #ifdef MFEM_USE_MPI
-      ParGridFunction x_pgf;
-      if (auto *pfes = dynamic_cast<ParFiniteElementSpace*>(a->FESpace()))
-      {
-         x_pgf.MakeRef(pfes, const_cast<Vector&>(x), 0);
-         x_dg = &x_pgf;
-      }
+      x_pgf.ExchangeFaceNbrDataEnd();
 #endif
-
       int_face_restrict_lex->Mult(*x_dg, int_face_X);
       if (int_face_dXdn.Size() > 0)
       {
@@ -694,6 +703,52 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
    }
 }
 
+void PABilinearFormExtension::ArrayMult(const Array<const Vector *> &X,
+                                        Array<Vector *> &Y) const
+{
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   const int nvec = X.Size();
+
+   // The batched path only covers the domain integrators applied through the
+   // element restriction; the other cases use one Mult() per vector.
+   bool batched = nvec > 1 && integrators.Size() > 0 && elem_restrict &&
+                  !DeviceCanUseCeed() &&
+                  a->GetAssemblyLevel() == AssemblyLevel::PARTIAL &&
+                  a->GetBBFI()->Size() == 0 && a->GetFBFI()->Size() == 0 &&
+                  a->GetBFBFI()->Size() == 0;
+   for (int i = 0; batched && i < integrators.Size(); ++i)
+   {
+      batched = !integrators[i]->Patchwise() && !elem_markers[i];
+   }
+   if (!batched)
+   {
+      Operator::ArrayMult(X, Y);
+      return;
+   }
+
+   const int esize = elem_restrict->Height();
+   localXs.UseDevice(true);
+   localYs.UseDevice(true);
+   localXs.SetSize(esize, nvec);
+   localYs.SetSize(esize, nvec);
+   for (int j = 0; j < nvec; ++j)
+   {
+      elem_restrict->Mult(*X[j], localXs.GetColumn(j));
+   }
+   localXs.SyncFromColumns();
+   localYs = 0.0;
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      integrators[i]->AddMultPAMulti(localXs, localYs);
+   }
+   localYs.SyncToColumns();
+   for (int j = 0; j < nvec; ++j)
+   {
+      elem_restrict->MultTranspose(localYs.GetColumn(j), *Y[j]);
+   }
+}
+
 void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
@@ -1370,8 +1425,7 @@ void FABilinearFormExtension::DGMult(const Vector &x, Vector &y) const
       ParGridFunction x_gf;
       x_gf.MakeRef(const_cast<ParFiniteElementSpace*>(pfes),
                    const_cast<Vector&>(x),0);
-      x_gf.ExchangeFaceNbrData();
-      Vector &shared_x = x_gf.FaceNbrData();
+      x_gf.ExchangeFaceNbrDataBegin();
       const int local_size = a->FESpace()->GetVSize();
       auto dg_x_ptr = dg_x.Write();
       auto x_ptr = x.Read();
@@ -1379,6 +1433,8 @@ void FABilinearFormExtension::DGMult(const Vector &x, Vector &y) const
       {
          dg_x_ptr[i] = x_ptr[i];
       });
+      x_gf.ExchangeFaceNbrDataEnd();
+      Vector &shared_x = x_gf.FaceNbrData();
       const int shared_size = shared_x.Size();
       auto shared_x_ptr = shared_x.Read();
       mfem::forall(shared_size, [=] MFEM_HOST_DEVICE (int i)
@@ -1431,8 +1487,7 @@ void FABilinearFormExtension::DGMultTranspose(const Vector &x, Vector &y) const
       ParGridFunction x_gf;
       x_gf.MakeRef(const_cast<ParFiniteElementSpace*>(pfes),
                    const_cast<Vector&>(x),0);
-      x_gf.ExchangeFaceNbrData();
-      Vector &shared_x = x_gf.FaceNbrData();
+      x_gf.ExchangeFaceNbrDataBegin();
       const int local_size = a->FESpace()->GetVSize();
       auto dg_x_ptr = dg_x.Write();
       auto x_ptr = x.Read();
@@ -1440,6 +1495,8 @@ void FABilinearFormExtension::DGMultTranspose(const Vector &x, Vector &y) const
       {
          dg_x_ptr[i] = x_ptr[i];
       });
+      x_gf.ExchangeFaceNbrDataEnd();
+      Vector &shared_x = x_gf.FaceNbrData();
       const int shared_size = shared_x.Size();
       auto shared_x_ptr = shared_x.Read();
       mfem::forall(shared_size, [=] MFEM_HOST_DEVICE (int i)
@@ -72,6 +72,7 @@ protected:
    Array<int> elem_attributes, bdr_attributes;
    mutable Vector tmp_evec; // Work array
    mutable Vector localX, localY;
+   mutable MultiVector localXs, localYs; // Work arrays of ArrayMult()
    mutable Vector int_face_X, int_face_Y;
    mutable Vector bdr_face_X, bdr_face_Y;
    mutable Vector int_face_dXdn, int_face_dYdn;
@@ -93,6 +94,11 @@ public:
                          int copy_interior = 0) override;
    void Mult(const Vector &x, Vector &y) const override;
    void MultTranspose(const Vector &x, Vector &y) const override;
+   /** @brief Action on several vectors. When all the integrators are domain
+       integrators without attribute markers, they are applied to all the
+       vectors at once with BilinearFormIntegrator::AddMultPAMulti(). */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
    void Update() override;
 
 protected:
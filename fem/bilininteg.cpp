@@ -15,6 +15,7 @@
 #include <cmath>
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 using namespace std;
 
@@ -109,6 +110,37 @@ void BilinearFormIntegrator::AddMultNURBSPA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AddMultPAMulti(const MultiVector &x,
+                                            MultiVector &y) const
+{
+   MFEM_ASSERT(x.NumVectors() == y.NumVectors(), "");
+   x.SyncToColumns();
+   y.SyncToColumns();
+   for (int j = 0; j < x.NumVectors(); j++)
+   {
+      AddMultPA(x.GetColumn(j), y.GetColumn(j));
+   }
+   y.SyncFromColumns();
+}
+
+void BilinearFormIntegrator::AddElementMatrices(const FiniteElementSpace &fes,
+                                                const Array<int> &elems,
+                                                DenseMatrixBatch &elmats)
+{
+   MFEM_ASSERT(elmats.NumMatrices() == elems.Size(), "");
+   const Mesh &mesh = *fes.GetMesh();
+   IsoparametricTransformation Trans;
+   DenseMatrix elmat, elmat_k;
+   for (int k = 0; k < elems.Size(); k++)
+   {
+      mesh.GetElementTransformation(elems[k], &Trans);
+      AssembleElementMatrix(*fes.GetFE(elems[k]), Trans, elmat);
+      elmats.GetMatrix(k, elmat_k);
+      elmat_k += elmat;
+      elmats.SetMatrix(k, elmat_k);
+   }
+}
+
 void BilinearFormIntegrator::AddMultTransposePA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator::AddMultTransposePA(...)\n"
@@ -976,6 +1008,59 @@ void DiffusionIntegrator::AssembleElementMatrix
    }
 }
 
+void DiffusionIntegrator::AddElementMatrices(const FiniteElementSpace &fes,
+                                             const Array<int> &elems,
+                                             DenseMatrixBatch &elmats)
+{
+   const int ne = elems.Size();
+   if (ne == 0) { return; }
+   const Mesh &mesh = *fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(elems[0]);
+   const int nd = el.GetDof();
+   dim = el.GetDim();
+   if (VQ || MQ || dim != mesh.SpaceDimension() || elmats.Height() != nd ||
+       dynamic_cast<const NURBSFiniteElement *>(&el))
+   {
+      BilinearFormIntegrator::AddElementMatrices(fes, elems, elmats);
+      return;
+   }
+
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el);
+
+   std::vector<IsoparametricTransformation> Trans(ne);
+   for (int k = 0; k < ne; k++)
+   {
+      mesh.GetElementTransformation(elems[k], &Trans[k]);
+   }
+
+   DenseMatrix dshape_ip(nd, dim);
+   DenseMatrixBatch dshape(nd, dim, ne), invJ(dim, dim, ne), invJ_w, G, G_w;
+   for (int i = 0; i < ir->GetNPoints(); i++)
+   {
+      const IntegrationPoint &ip = ir->IntPoint(i);
+      el.CalcDShape(ip, dshape_ip);
+      for (int k = 0; k < ne; k++)
+      {
+         Trans[k].SetIntPoint(&ip);
+         dshape.SetMatrix(k, dshape_ip);
+         invJ.SetMatrix(k, Trans[k].Jacobian());
+      }
+      // The physical gradients are G = dshape J^{-1} and the element matrix is
+      // the sum of w det(J) Q G G^t
+      invJ.Invert();
+      invJ_w = invJ;
+      for (int k = 0; k < ne; k++)
+      {
+         real_t w = ip.weight * Trans[k].Weight();
+         if (Q) { w *= Q->Eval(Trans[k], ip); }
+         for (int c = 0; c < dim*dim; c++) { invJ_w(c%dim, c/dim, k) *= w; }
+      }
+      Mult(dshape, invJ, G);
+      Mult(dshape, invJ_w, G_w);
+      AddMultABt(G_w, G, elmats);
+   }
+}
+
 void DiffusionIntegrator::AssembleElementMatrix2(
    const FiniteElement &trial_fe, const FiniteElement &test_fe,
    ElementTransformation &Trans, DenseMatrix &elmat)
@@ -1384,6 +1469,49 @@ void MassIntegrator::AssembleElementMatrix
    }
 }
 
+void MassIntegrator::AddElementMatrices(const FiniteElementSpace &fes,
+                                        const Array<int> &elems,
+                                        DenseMatrixBatch &elmats)
+{
+   const int ne = elems.Size();
+   if (ne == 0) { return; }
+   const Mesh &mesh = *fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(elems[0]);
+   const int nd = el.GetDof();
+   if (el.GetMapType() != FiniteElement::VALUE || elmats.Height() != nd ||
+       dynamic_cast<const NURBSFiniteElement *>(&el))
+   {
+      BilinearFormIntegrator::AddElementMatrices(fes, elems, elmats);
+      return;
+   }
+
+   std::vector<IsoparametricTransformation> Trans(ne);
+   for (int k = 0; k < ne; k++)
+   {
+      mesh.GetElementTransformation(elems[k], &Trans[k]);
+   }
+
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, Trans[0]);
+
+   Vector shape_ip(nd);
+   DenseMatrix shape_ip_mat(shape_ip.GetData(), nd, 1);
+   DenseMatrixBatch shape(nd, 1, ne), shape_w(nd, 1, ne);
+   for (int i = 0; i < ir->GetNPoints(); i++)
+   {
+      const IntegrationPoint &ip = ir->IntPoint(i);
+      el.CalcShape(ip, shape_ip);
+      for (int k = 0; k < ne; k++)
+      {
+         Trans[k].SetIntPoint(&ip);
+         real_t w = ip.weight * Trans[k].Weight();
+         if (Q) { w *= Q->Eval(Trans[k], ip); }
+         shape.SetMatrix(k, shape_ip_mat);
+         for (int j = 0; j < nd; j++) { shape_w(j, 0, k) = w*shape_ip(j); }
+      }
+      AddMultABt(shape_w, shape, elmats);
+   }
+}
+
 void MassIntegrator::AssembleElementMatrix2(
    const FiniteElement &trial_fe, const FiniteElement &test_fe,
    ElementTransformation &Trans, DenseMatrix &elmat)
@@ -81,6 +81,19 @@ public:
    /// Method for partially assembled action on NURBS patches.
    virtual void AddMultNURBSPA(const Vector&x, Vector&y) const;
 
+   /// Method for partially assembled action on several E-vectors.
+   /** Perform the action of the integrator on each column of @a x and add the
+       result to the same column of @a y. The columns of both MultiVector%s
+       are E-vectors, stored with the MultiVector::Layout::COLUMNS layout.
+
+       The default implementation calls AddMultPA() for each column. The
+       integrators with a batched kernel override this method to reuse the
+       quadrature data and the basis values of each element for all columns.
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual void AddMultPAMulti(const MultiVector &x, MultiVector &y) const;
+
    /// Method for partially assembled transposed action.
    /** Perform the transpose action of integrator on the input @a x and add the
        result to the output @a y. Both @a x and @a y are E-vectors, i.e. they
@@ -138,6 +151,19 @@ public:
                                       ElementTransformation &Trans,
                                       DenseMatrix &elmat);
 
+   /// Method for assembling the element matrices of several elements.
+   /** Add the element matrices of the elements @a elems of @a fes to the
+       batch @a elmats, whose matrix k corresponds to element @a elems[k]. All
+       the elements must have the same finite element.
+
+       The default implementation calls AssembleElementMatrix() for each
+       element. The integrators with a batched kernel override this method to
+       perform the small dense matrix operations of all the elements with the
+       SIMD kernels of DenseMatrixBatch. */
+   virtual void AddElementMatrices(const FiniteElementSpace &fes,
+                                   const Array<int> &elems,
+                                   DenseMatrixBatch &elmats);
+
    /** Compute the local matrix representation of a bilinear form
        $a(u,v)$ defined on different trial (given by $u$) and test
        (given by $v$) spaces. The rows in the local matrix correspond
@@ -2178,6 +2204,8 @@ private:
    int dim, ne, dofs1D, quad1D;
    Vector pa_data;
    bool symmetric = true; ///< False if using a nonsymmetric matrix coefficient
+   bool single_pa = false;
+   Array<float> pa_data_single; ///< Single precision copy of pa_data
 
    // Data for NURBS patch PA
 
@@ -2250,6 +2278,14 @@ public:
    void AssembleElementMatrix(const FiniteElement &el,
                               ElementTransformation &Trans,
                               DenseMatrix &elmat) override;
+
+   /** Batched element stiffness matrices for a scalar or no coefficient and
+       elements with Dim() == SpaceDimension(); otherwise, falls back to
+       AssembleElementMatrix(). */
+   void AddElementMatrices(const FiniteElementSpace &fes,
+                           const Array<int> &elems,
+                           DenseMatrixBatch &elmats) override;
+
    /** Given a trial and test Finite Element computes the element stiffness
        matrix elmat. */
    void AssembleElementMatrix2(const FiniteElement &trial_fe,
@@ -2296,6 +2332,8 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   void AddMultPAMulti(const MultiVector&, MultiVector&) const override;
+
    void AddMultTransposePA(const Vector&, Vector&) const override;
 
    void AddMultNURBSPA(const Vector&, Vector&) const override;
@@ -2307,6 +2345,20 @@ public:
 
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
+   /** @brief Use a single precision copy of the partial assembly data in
+       AddMultPA(), in 2D and 3D. Must be called before AssemblePA(). */
+   /** The quadrature data is the largest part of the memory traffic of the PA
+       operator, so that this reduces the cost of AddMultPA(), at the price of
+       a relative accuracy of about 1e-7, e.g. in the inner solver of a
+       MixedPrecisionSolver. The double precision data is kept for the other
+       methods, e.g. AssembleDiagonalPA(). Disabling the option releases the
+       single precision copy. */
+   void SetSinglePrecisionPA(bool single = true)
+   {
+      single_pa = single;
+      if (!single_pa) { pa_data_single.DeleteAll(); }
+   }
+
    Coefficient *GetCoefficient() const { return Q; }
 
    template <int DIM, int D1D, int Q1D>
@@ -2333,6 +2385,8 @@ protected:
    const GeometricFactors *geom;          ///< Not owned
    const FaceGeometricFactors *face_geom; ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
+   bool single_pa = false;
+   Array<float> pa_data_single; ///< Single precision copy of pa_data
 
 public:
 
@@ -2359,6 +2413,13 @@ public:
    void AssembleElementMatrix(const FiniteElement &el,
                               ElementTransformation &Trans,
                               DenseMatrix &elmat) override;
+
+   /** Batched element mass matrices for elements with the VALUE map type;
+       otherwise, falls back to AssembleElementMatrix(). */
+   void AddElementMatrices(const FiniteElementSpace &fes,
+                           const Array<int> &elems,
+                           DenseMatrixBatch &elmats) override;
+
    void AssembleElementMatrix2(const FiniteElement &trial_fe,
                                const FiniteElement &test_fe,
                                ElementTransformation &Trans,
@@ -2382,6 +2443,8 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   void AddMultPAMulti(const MultiVector&, MultiVector&) const override;
+
    void AddMultTransposePA(const Vector&, Vector&) const override;
 
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
@@ -2390,6 +2453,15 @@ public:
 
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
+   /** @brief Use a single precision copy of the partial assembly data in
+       AddMultPA(), in 2D and 3D, see
+       DiffusionIntegrator::SetSinglePrecisionPA(). */
+   void SetSinglePrecisionPA(bool single = true)
+   {
+      single_pa = single;
+      if (!single_pa) { pa_data_single.DeleteAll(); }
+   }
+
    const Coefficient *GetCoefficient() const { return Q; }
 
    template <int DIM, int D1D, int Q1D>
@@ -17,6 +17,7 @@
 #include "quadinterpolator.hpp"
 #include "../mesh/nurbs.hpp"
 #include "../general/text.hpp"
+#include "../general/annotation.hpp"
 
 #ifdef MFEM_USE_MPI
 #include "pfespace.hpp"
@@ -37,6 +38,7 @@ using namespace std;
 GridFunction::GridFunction(Mesh *m, std::istream &input)
    : Vector()
 {
+   MFEM_PERF_SCOPE("GridFunction::Load");
    // Grid functions are stored on the device
    UseDevice(true);
 
@@ -61,6 +63,21 @@ GridFunction::GridFunction(Mesh *m, std::istream &input)
          MFEM_ABORT("unknown section: " << buff);
       }
    }
+   else if (next_char == 'b') // First letter of "binary_data"
+   {
+      string ident;
+      int size, real_size;
+      input >> ident >> size >> real_size;
+      MFEM_VERIFY(ident == "binary_data", "unknown section: " << ident);
+      MFEM_VERIFY(size == fes->GetVSize(), "invalid binary data size");
+      MFEM_VERIFY(real_size == int(sizeof(real_t)),
+                  "the binary data was written with sizeof(real_t) = "
+                  << real_size);
+      input.get(); // the '\n' after the sizes
+      SetSize(size);
+      input.read(reinterpret_cast<char*>(HostWrite()), size*sizeof(real_t));
+      MFEM_VERIFY(input.good(), "error reading binary data");
+   }
    else
    {
       Vector::Load(input, fes->GetVSize());
@@ -3686,6 +3703,7 @@ GridFunction & GridFunction::operator=(const Vector &v)
 
 void GridFunction::Save(std::ostream &os) const
 {
+   MFEM_PERF_SCOPE("GridFunction::Save");
    fes->Save(os);
    os << '\n';
 #if 0
@@ -3716,6 +3734,21 @@ void GridFunction::Save(const char *fname, int precision) const
    Save(ofs);
 }
 
+void GridFunction::SaveBinary(std::ostream &os) const
+{
+   MFEM_PERF_SCOPE("GridFunction::SaveBinary");
+   fes->Save(os);
+   os << "\nbinary_data " << Size() << ' ' << sizeof(real_t) << '\n';
+   os.write(reinterpret_cast<const char*>(HostRead()), Size()*sizeof(real_t));
+   os.flush();
+}
+
+void GridFunction::SaveBinary(const char *fname) const
+{
+   ofstream ofs(fname, std::ios::out | std::ios::binary);
+   SaveBinary(ofs);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void GridFunction::Save(adios2stream &os,
                         const std::string& variable_name,
@@ -1522,6 +1522,17 @@ public:
    /// ASCII output.
    virtual void Save(const char *fname, int precision=16) const;
 
+   /** @brief Save the GridFunction to an output stream with the values written
+       as raw binary data, in the byte order and real_t precision of the
+       writer. */
+   /** The FiniteElementSpace header is the same as in Save(), so the result
+       can be read back with the GridFunction(Mesh*, std::istream&)
+       constructor. */
+   void SaveBinary(std::ostream &out) const;
+
+   /// Save the GridFunction to a file using SaveBinary().
+   void SaveBinary(const char *fname) const;
+
 #ifdef MFEM_USE_ADIOS2
    /// Save the GridFunction to a binary output stream using adios2 bp format.
    virtual void Save(adios2stream &out, const std::string& variable_name,
@@ -38,6 +38,11 @@ DiffusionIntegrator::Kernels::Kernels()
    DiffusionIntegrator::AddSpecialization<3,6,7>();
    DiffusionIntegrator::AddSpecialization<3,7,8>();
    DiffusionIntegrator::AddSpecialization<3,8,9>();
+   // Other orders, compiled at runtime when enabled
+   ApplyPAKernels::EnableJit("fem/integ/bilininteg_diffusion_kernels.hpp",
+                             "mfem::DiffusionIntegrator::ApplyPAKernels");
+   DiagonalPAKernels::EnableJit("fem/integ/bilininteg_diffusion_kernels.hpp",
+                                "mfem::DiffusionIntegrator::DiagonalPAKernels");
 }
 
 namespace internal
@@ -331,6 +336,174 @@ void PADiffusionSetup3D(const int Q1D,
    });
 }
 
+template<int T_D1D, int T_Q1D>
+static void PADiffusionApplyMulti(const int dim,
+                                  const int D1D,
+                                  const int Q1D,
+                                  const int NE,
+                                  const bool symm,
+                                  const real_t *B,
+                                  const real_t *G,
+                                  const real_t *Bt,
+                                  const real_t *Gt,
+                                  const real_t *D,
+                                  const int nvec,
+                                  const int stride,
+                                  const real_t *X,
+                                  real_t *Y)
+{
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int j = 0; j < nvec; j++)
+      {
+         const real_t *X_j = X + j*stride;
+         real_t *Y_j = Y + j*stride;
+         if (dim == 2)
+         {
+            PADiffusionApply2D_Element<T_D1D,T_Q1D>(e, NE, symm, B, G, Bt, Gt,
+                                                    D, X_j, Y_j, D1D, Q1D);
+         }
+         else
+         {
+            PADiffusionApply3D_Element<T_D1D,T_Q1D>(e, NE, symm, B, G, Bt, Gt,
+                                                    D, X_j, Y_j, D1D, Q1D);
+         }
+      }
+   });
+}
+
+void PADiffusionApplyMulti(const int dim,
+                           const int D1D,
+                           const int Q1D,
+                           const int NE,
+                           const bool symm,
+                           const Array<real_t> &b,
+                           const Array<real_t> &g,
+                           const Array<real_t> &bt,
+                           const Array<real_t> &gt,
+                           const Vector &d,
+                           const MultiVector &x,
+                           MultiVector &y)
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "dimension " << dim << " is not supported");
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   MFEM_ASSERT(x.GetLayout() == MultiVector::Layout::COLUMNS &&
+               y.GetLayout() == MultiVector::Layout::COLUMNS, "");
+   const int nvec = x.NumVectors();
+   const int stride = x.VectorSize();
+   const auto B = b.Read();
+   const auto G = g.Read();
+   const auto Bt = bt.Read();
+   const auto Gt = gt.Read();
+   const auto D = d.Read();
+   const auto X = x.Read();
+   auto Y = y.ReadWrite();
+   // The sizes of the default quadrature rules for the orders 1 to 4, as in
+   // PADiffusionApplySingle()
+   switch ((D1D << 4) | Q1D)
+   {
+      case 0x22: return PADiffusionApplyMulti<2,2>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      case 0x33: return PADiffusionApplyMulti<3,3>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      case 0x34: return PADiffusionApplyMulti<3,4>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      case 0x44: return PADiffusionApplyMulti<4,4>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      case 0x45: return PADiffusionApplyMulti<4,5>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      case 0x55: return PADiffusionApplyMulti<5,5>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      case 0x56: return PADiffusionApplyMulti<5,6>(dim, D1D, Q1D, NE, symm, B,
+                                                      G, Bt, Gt, D, nvec,
+                                                      stride, X, Y);
+      default: return PADiffusionApplyMulti<0,0>(dim, D1D, Q1D, NE, symm, B,
+                                                    G, Bt, Gt, D, nvec,
+                                                    stride, X, Y);
+   }
+}
+
+template<int T_D1D, int T_Q1D>
+static void PADiffusionApplySingle(const int dim,
+                                   const int D1D,
+                                   const int Q1D,
+                                   const int NE,
+                                   const bool symm,
+                                   const real_t *B,
+                                   const real_t *G,
+                                   const real_t *Bt,
+                                   const real_t *Gt,
+                                   const float *D,
+                                   const real_t *X,
+                                   real_t *Y)
+{
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      if (dim == 2)
+      {
+         PADiffusionApply2D_Element<T_D1D,T_Q1D>(e, NE, symm, B, G, Bt, Gt, D,
+                                                 X, Y, D1D, Q1D);
+      }
+      else
+      {
+         PADiffusionApply3D_Element<T_D1D,T_Q1D>(e, NE, symm, B, G, Bt, Gt, D,
+                                                 X, Y, D1D, Q1D);
+      }
+   });
+}
+
+void PADiffusionApplySingle(const int dim,
+                            const int D1D,
+                            const int Q1D,
+                            const int NE,
+                            const bool symm,
+                            const Array<real_t> &b,
+                            const Array<real_t> &g,
+                            const Array<real_t> &bt,
+                            const Array<real_t> &gt,
+                            const Array<float> &d,
+                            const Vector &x,
+                            Vector &y)
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "dimension " << dim << " is not supported");
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = b.Read();
+   const auto G = g.Read();
+   const auto Bt = bt.Read();
+   const auto Gt = gt.Read();
+   const auto D = d.Read();
+   const auto X = x.Read();
+   auto Y = y.ReadWrite();
+   // The sizes of the default quadrature rules for the orders 1 to 4
+   switch ((D1D << 4) | Q1D)
+   {
+      case 0x22: return PADiffusionApplySingle<2,2>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      case 0x33: return PADiffusionApplySingle<3,3>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      case 0x34: return PADiffusionApplySingle<3,4>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      case 0x44: return PADiffusionApplySingle<4,4>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      case 0x45: return PADiffusionApplySingle<4,5>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      case 0x55: return PADiffusionApplySingle<5,5>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      case 0x56: return PADiffusionApplySingle<5,6>(dim, D1D, Q1D, NE, symm,
+                                                       B, G, Bt, Gt, D, X, Y);
+      default: return PADiffusionApplySingle<0,0>(dim, D1D, Q1D, NE, symm,
+                                                     B, G, Bt, Gt, D, X, Y);
+   }
+}
+
 #ifdef MFEM_USE_OCCA
 void OccaPADiffusionSetup2D(const int D1D,
                             const int Q1D,
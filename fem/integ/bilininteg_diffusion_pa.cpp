@@ -19,6 +19,26 @@
 namespace mfem
 {
 
+// Estimated cost of the sum-factorized PA diffusion apply kernel: the input
+// and output E-vectors (the latter is read and written) and the quadrature
+// data are streamed from memory, the basis matrices are assumed to be cached.
+static KernelCost DiffusionApplyPACost(int dim, int D1D, int Q1D, int NE,
+                                       bool symmetric)
+{
+   const double D = D1D, Q = Q1D;
+   const int ncomp = symmetric ? (dim*(dim+1))/2 : dim*dim;
+   const double bytes = sizeof(real_t)*double(NE)*
+                        (3*std::pow(D, dim) + ncomp*std::pow(Q, dim));
+   double flops = 0.0;
+   switch (dim)
+   {
+      case 1: flops = 4*D*Q + Q; break;
+      case 2: flops = 8*D*D*Q + 8*D*Q*Q + 6*Q*Q; break;
+      case 3: flops = 8*D*D*D*Q + 12*D*D*Q*Q + 12*D*Q*Q*Q + 15*Q*Q*Q; break;
+   }
+   return KernelCost(bytes, NE*flops);
+}
+
 void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
 {
    if (DeviceCanUseCeed())
@@ -68,11 +88,36 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
       }
 #endif // MFEM_USE_OCCA
 
-      ApplyPAKernels::Run(dim, dofs1D, quad1D, ne, symmetric, B, G, Bt,
+      if (single_pa && pa_data_single.Size() > 0)
+      {
+         internal::PADiffusionApplySingle(dim, dofs1D, quad1D, ne, symmetric,
+                                          B, G, Bt, Gt, pa_data_single, x, y);
+         return;
+      }
+
+      const KernelCost cost =
+         DiffusionApplyPACost(dim, dofs1D, quad1D, ne, symmetric);
+      ApplyPAKernels::Run(cost, dim, dofs1D, quad1D, ne, symmetric, B, G, Bt,
                           Gt, Dv, x, y, dofs1D, quad1D);
    }
 }
 
+void DiffusionIntegrator::AddMultPAMulti(const MultiVector &x,
+                                         MultiVector &y) const
+{
+   bool batched = !(DeviceCanUseCeed() || dim == 1);
+#ifdef MFEM_USE_OCCA
+   batched = batched && !DeviceCanUseOcca();
+#endif
+   if (!batched)
+   {
+      BilinearFormIntegrator::AddMultPAMulti(x, y);
+      return;
+   }
+   internal::PADiffusionApplyMulti(dim, dofs1D, quad1D, ne, symmetric, maps->B,
+                                   maps->G, maps->Bt, maps->Gt, pa_data, x, y);
+}
+
 void DiffusionIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
 {
    if (symmetric)
@@ -139,6 +184,18 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    pa_data.SetSize(pa_size * nq * ne, mt);
    internal::PADiffusionSetup(dim, sdim, dofs1D, quad1D, coeff_dim, ne,
                               ir->GetWeights(), geom->J, coeff, pa_data);
+
+   pa_data_single.DeleteAll();
+   if (single_pa && dim > 1)
+   {
+      pa_data_single.SetSize(pa_data.Size(), mt);
+      const auto d = pa_data.Read();
+      auto d_single = pa_data_single.Write();
+      mfem::forall(pa_data.Size(), [=] MFEM_HOST_DEVICE (int i)
+      {
+         d_single[i] = (float)d[i];
+      });
+   }
 }
 
 void DiffusionIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
@@ -36,11 +36,133 @@ MassIntegrator::Kernels::Kernels()
    MassIntegrator::AddSpecialization<3,6,7>();
    MassIntegrator::AddSpecialization<3,7,8>();
    MassIntegrator::AddSpecialization<3,8,9>();
+   // Other orders, compiled at runtime when enabled
+   ApplyPAKernels::EnableJit("fem/integ/bilininteg_mass_kernels.hpp",
+                             "mfem::MassIntegrator::ApplyPAKernels");
+   DiagonalPAKernels::EnableJit("fem/integ/bilininteg_mass_kernels.hpp",
+                                "mfem::MassIntegrator::DiagonalPAKernels");
 }
 
 namespace internal
 {
 
+template<int T_D1D, int T_Q1D>
+static void PAMassApplyMulti(const int dim,
+                             const int D1D,
+                             const int Q1D,
+                             const int NE,
+                             const real_t *B,
+                             const real_t *Bt,
+                             const real_t *D,
+                             const int nvec,
+                             const int stride,
+                             const real_t *X,
+                             real_t *Y)
+{
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int j = 0; j < nvec; j++)
+      {
+         const real_t *X_j = X + j*stride;
+         real_t *Y_j = Y + j*stride;
+         switch (dim)
+         {
+            case 1:
+               PAMassApply1D_Element(e, NE, B, Bt, D, X_j, Y_j, D1D, Q1D);
+               break;
+            case 2:
+               PAMassApply2D_Element<true,real_t,T_D1D,T_Q1D>(
+                  e, NE, B, Bt, D, X_j, Y_j, D1D, Q1D);
+               break;
+            case 3:
+               PAMassApply3D_Element<true,real_t,T_D1D,T_Q1D>(
+                  e, NE, B, Bt, D, X_j, Y_j, D1D, Q1D);
+               break;
+         }
+      }
+   });
+}
+
+void PAMassApplyMulti(const int dim,
+                      const int D1D,
+                      const int Q1D,
+                      const int NE,
+                      const Array<real_t> &b,
+                      const Array<real_t> &bt,
+                      const Vector &d,
+                      const MultiVector &x,
+                      MultiVector &y)
+{
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   MFEM_ASSERT(x.GetLayout() == MultiVector::Layout::COLUMNS &&
+               y.GetLayout() == MultiVector::Layout::COLUMNS, "");
+   const int nvec = x.NumVectors();
+   const int stride = x.VectorSize();
+   const auto B = b.Read();
+   const auto Bt = bt.Read();
+   const auto D = d.Read();
+   const auto X = x.Read();
+   auto Y = y.ReadWrite();
+   // The sizes of the default quadrature rules for the orders 1 to 4 in 2D
+   // (D1D = Q1D) and in 3D (Q1D = D1D + 1 or D1D + 2), see the specializations
+   // registered in MassIntegrator::Kernels::Kernels()
+   switch ((D1D << 4) | Q1D)
+   {
+      case 0x22: return PAMassApplyMulti<2,2>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x23: return PAMassApplyMulti<2,3>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x33: return PAMassApplyMulti<3,3>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x34: return PAMassApplyMulti<3,4>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x44: return PAMassApplyMulti<4,4>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x45: return PAMassApplyMulti<4,5>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x46: return PAMassApplyMulti<4,6>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x55: return PAMassApplyMulti<5,5>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      case 0x56: return PAMassApplyMulti<5,6>(dim, D1D, Q1D, NE, B, Bt, D,
+                                                 nvec, stride, X, Y);
+      default: return PAMassApplyMulti<0,0>(dim, D1D, Q1D, NE, B, Bt, D,
+                                               nvec, stride, X, Y);
+   }
+}
+
+void PAMassApplySingle(const int dim,
+                       const int D1D,
+                       const int Q1D,
+                       const int NE,
+                       const Array<real_t> &b,
+                       const Array<real_t> &bt,
+                       const Array<float> &d,
+                       const Vector &x,
+                       Vector &y)
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "dimension " << dim << " is not supported");
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = b.Read();
+   const auto Bt = bt.Read();
+   const auto D = d.Read();
+   const auto X = x.Read();
+   auto Y = y.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      if (dim == 2)
+      {
+         PAMassApply2D_Element(e, NE, B, Bt, D, X, Y, D1D, Q1D);
+      }
+      else
+      {
+         PAMassApply3D_Element(e, NE, B, Bt, D, X, Y, D1D, Q1D);
+      }
+   });
+}
+
 #ifdef MFEM_USE_OCCA
 void OccaPAMassApply2D(const int D1D,
                        const int Q1D,
@@ -418,23 +418,24 @@ void OccaPAMassApply3D(const int D1D,
                        Vector &Y);
 #endif // MFEM_USE_OCCA
 
-template <bool ACCUMULATE = true>
+template <bool ACCUMULATE = true, typename TD = real_t,
+          int T_D1D = 0, int T_Q1D = 0>
 MFEM_HOST_DEVICE inline
 void PAMassApply2D_Element(const int e,
                            const int NE,
                            const real_t *b_,
                            const real_t *bt_,
-                           const real_t *d_,
+                           const TD *d_,
                            const real_t *x_,
                            real_t *y_,
                            const int d1d = 0,
                            const int q1d = 0)
 {
-   const int D1D = d1d;
-   const int Q1D = q1d;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
    auto B = ConstDeviceMatrix(b_, Q1D, D1D);
    auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
-   auto D = ConstDeviceCube(d_, Q1D, Q1D, NE);
+   auto D = DeviceTensor<3,const TD>(d_, Q1D, Q1D, NE);
    auto X = ConstDeviceCube(x_, D1D, D1D, NE);
    auto Y = DeviceCube(y_, D1D, D1D, NE);
 
@@ -449,8 +450,8 @@ void PAMassApply2D_Element(const int e,
       }
    }
 
-   constexpr int max_D1D = DofQuadLimits::MAX_D1D;
-   constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
+   constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+   constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
    real_t sol_xy[max_Q1D][max_Q1D];
    for (int qy = 0; qy < Q1D; ++qy)
    {
@@ -642,23 +643,24 @@ void SmemPAMassApply2D_Element(const int e,
    }
 }
 
-template <bool ACCUMULATE = true>
+template <bool ACCUMULATE = true, typename TD = real_t,
+          int T_D1D = 0, int T_Q1D = 0>
 MFEM_HOST_DEVICE inline
 void PAMassApply3D_Element(const int e,
                            const int NE,
                            const real_t *b_,
                            const real_t *bt_,
-                           const real_t *d_,
+                           const TD *d_,
                            const real_t *x_,
                            real_t *y_,
                            const int d1d,
                            const int q1d)
 {
-   const int D1D = d1d;
-   const int Q1D = q1d;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
    auto B = ConstDeviceMatrix(b_, Q1D, D1D);
    auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
-   auto D = DeviceTensor<4,const real_t>(d_, Q1D, Q1D, Q1D, NE);
+   auto D = DeviceTensor<4,const TD>(d_, Q1D, Q1D, Q1D, NE);
    auto X = DeviceTensor<4,const real_t>(x_, D1D, D1D, D1D, NE);
    auto Y = DeviceTensor<4,real_t>(y_, D1D, D1D, D1D, NE);
 
@@ -676,8 +678,8 @@ void PAMassApply3D_Element(const int e,
       }
    }
 
-   constexpr int max_D1D = DofQuadLimits::MAX_D1D;
-   constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
+   constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+   constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
    real_t sol_xyz[max_Q1D][max_Q1D][max_Q1D];
    for (int qz = 0; qz < Q1D; ++qz)
    {
@@ -1132,6 +1134,31 @@ inline void SmemPAMassApply3D(const int NE,
    });
 }
 
+// PA Mass Apply kernel for the columns of the E-vectors X and Y. The columns
+// are processed one element at a time, so that the quadrature data and the
+// basis values of the element are reused from the cache for all the columns.
+void PAMassApplyMulti(const int dim,
+                      const int D1D,
+                      const int Q1D,
+                      const int NE,
+                      const Array<real_t> &B,
+                      const Array<real_t> &Bt,
+                      const Vector &D,
+                      const MultiVector &X,
+                      MultiVector &Y);
+
+// PA Mass Apply kernel with the quadrature data D stored in single precision,
+// see MassIntegrator::SetSinglePrecisionPA().
+void PAMassApplySingle(const int dim,
+                       const int D1D,
+                       const int Q1D,
+                       const int NE,
+                       const Array<real_t> &B,
+                       const Array<real_t> &Bt,
+                       const Array<float> &D,
+                       const Vector &X,
+                       Vector &Y);
+
 } // namespace internal
 
 namespace
@@ -112,6 +112,18 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
          }
       });
    }
+
+   pa_data_single.DeleteAll();
+   if (single_pa)
+   {
+      pa_data_single.SetSize(pa_data.Size(), mt);
+      const auto d = pa_data.Read();
+      auto d_single = pa_data_single.Write();
+      mfem::forall(pa_data.Size(), [=] MFEM_HOST_DEVICE (int i)
+      {
+         d_single[i] = (float)d[i];
+      });
+   }
 }
 
 void MassIntegrator::AssemblePABoundary(const FiniteElementSpace &fes)
@@ -137,6 +149,7 @@ void MassIntegrator::AssemblePABoundary(const FiniteElementSpace &fes)
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
    pa_data.SetSize(ne*nq, mt);
+   pa_data_single.DeleteAll();
 
    FaceQuadratureSpace qs(*mesh, *ir, FaceType::Boundary);
    CoefficientVector coeff(Q, qs, CoefficientStorage::COMPRESSED);
@@ -201,6 +214,24 @@ void MassIntegrator::AssembleDiagonalPA(Vector &diag)
    }
 }
 
+// Estimated cost of the sum-factorized PA mass apply kernel: the input and
+// output E-vectors (the latter is read and written) and the quadrature data are
+// streamed from memory, the basis matrices are assumed to be cached.
+static KernelCost MassApplyPACost(int dim, int D1D, int Q1D, int NE)
+{
+   const double D = D1D, Q = Q1D;
+   const double bytes = sizeof(real_t)*double(NE)*
+                        (3*std::pow(D, dim) + std::pow(Q, dim));
+   double flops = 0.0;
+   switch (dim)
+   {
+      case 1: flops = 4*D*Q + Q; break;
+      case 2: flops = 4*D*D*Q + 4*D*Q*Q + Q*Q; break;
+      case 3: flops = 4*D*D*D*Q + 4*D*D*Q*Q + 4*D*Q*Q*Q + Q*Q*Q; break;
+   }
+   return KernelCost(bytes, NE*flops);
+}
+
 void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    if (DeviceCanUseCeed())
@@ -228,8 +259,30 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
          MFEM_ABORT("OCCA PA Mass Apply unknown kernel!");
       }
 #endif // MFEM_USE_OCCA
-      ApplyPAKernels::Run(dim, D1D, Q1D, ne, B, Bt, D, x, y, D1D, Q1D);
+      if (single_pa && pa_data_single.Size() > 0)
+      {
+         internal::PAMassApplySingle(dim, D1D, Q1D, ne, B, Bt, pa_data_single,
+                                     x, y);
+         return;
+      }
+      const KernelCost cost = MassApplyPACost(dim, D1D, Q1D, ne);
+      ApplyPAKernels::Run(cost, dim, D1D, Q1D, ne, B, Bt, D, x, y, D1D, Q1D);
+   }
+}
+
+void MassIntegrator::AddMultPAMulti(const MultiVector &x, MultiVector &y) const
+{
+   bool batched = !(DeviceCanUseCeed());
+#ifdef MFEM_USE_OCCA
+   batched = batched && !DeviceCanUseOcca();
+#endif
+   if (!batched)
+   {
+      BilinearFormIntegrator::AddMultPAMulti(x, y);
+      return;
    }
+   internal::PAMassApplyMulti(dim, dofs1D, quad1D, ne, maps->B, maps->Bt,
+                              pa_data, x, y);
 }
 
 void MassIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
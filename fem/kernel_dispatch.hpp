@@ -14,7 +14,10 @@
 
 #include "../config/config.hpp"
 #include "kernel_reporter.hpp"
+#include "../general/jit.hpp"
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <tuple>
 #include <cstddef>
 
@@ -41,6 +44,10 @@ namespace mfem
 //
 // Specialized functions can be registered using the static AddSpecialization
 // member function.
+//
+// The specializations that are not registered can also be compiled at runtime
+// (see JitCompiler), if the header defining the Kernel function is given with
+// the static EnableJit member function.
 
 #define MFEM_EXPAND(X) X // Workaround needed for MSVC compiler
 
@@ -130,27 +137,97 @@ class KernelDispatchTable<Kernels,
          Signature, KernelDispatchKeyHash<Params...>>;
    TableType table;
 
+   // Header and qualified class name used for the runtime compilation.
+   const char *jit_header = nullptr;
+   const char *jit_class = nullptr;
+   // Parameters for which the runtime compilation failed.
+   std::unordered_set<std::tuple<Params...>,
+       KernelDispatchKeyHash<Params...>> jit_failed;
+   // Guards table and jit_failed when the runtime compilation is enabled.
+   std::mutex jit_mutex;
+
+   /// Return the registered kernel for @a params, compiling it at runtime if
+   /// it is missing and the runtime compilation is enabled. Returns nullptr if
+   /// there is no such kernel.
+   static Signature Find(Params... params)
+   {
+      Kernels &kernels = Kernels::Get();
+      const std::tuple<Params...> key = std::make_tuple(params...);
+      if (!kernels.jit_header || !JitCompiler::IsEnabled())
+      {
+         // The table is only modified when the specializations are added,
+         // during the static initialization.
+         const auto it = kernels.table.find(key);
+         return (it != kernels.table.end()) ? it->second : nullptr;
+      }
+      // Concurrent calls may compile and register specializations.
+      std::lock_guard<std::mutex> lock(kernels.jit_mutex);
+      const auto it = kernels.table.find(key);
+      if (it != kernels.table.end()) { return it->second; }
+      return Compile(params...);
+   }
+
+   /// Compile the specialization for @a params at runtime and register it.
+   /// Returns nullptr if the compilation fails. Must be called with jit_mutex
+   /// locked.
+   static Signature Compile(Params... params)
+   {
+      Kernels &kernels = Kernels::Get();
+      const std::tuple<Params...> key = std::make_tuple(params...);
+      if (kernels.jit_failed.count(key)) { return nullptr; }
+
+      const std::string source =
+         std::string("#include \"") + kernels.jit_header + "\"\n"
+         "extern \"C\" " + kernels.jit_class + "::KernelSignature "
+         "mfem_jit_kernel()\n{\n   return " + kernels.jit_class + "::Kernel<" +
+         internal::Stringify(params..., OptParams{}...) + ">();\n}\n";
+      using Factory = Signature (*)();
+      const Factory factory = reinterpret_cast<Factory>(
+                                 JitCompiler::Lookup(source, "mfem_jit_kernel"));
+      if (!factory)
+      {
+         kernels.jit_failed.insert(key);
+         return nullptr;
+      }
+      return kernels.table[key] = factory();
+   }
+
 public:
    /// @brief Run the kernel with the given dispatch parameters and arguments.
    ///
    /// If a compile-time specialized version of the kernel with the given
-   /// parameters has been registered, it will be called. Otherwise, the
-   /// fallback kernel will be called.
+   /// parameters has been registered, it will be called. Otherwise, if the
+   /// runtime compilation is enabled (see EnableJit), the specialization is
+   /// compiled, registered and called. Otherwise, the fallback kernel will be
+   /// called.
    template<typename... Args>
    static void Run(Params... params, Args&&... args)
    {
-      const auto &table = Kernels::Get().table;
-      const std::tuple<Params...> key = std::make_tuple(params...);
-      const auto it = table.find(key);
-      if (it != table.end())
+      Run(KernelCost(), params..., std::forward<Args>(args)...);
+   }
+
+   /// @brief Same as Run(Params..., Args&&...), with an estimate of the cost
+   /// of the call, @a cost, recorded by the KernelProfiler when it is enabled.
+   template<typename... Args>
+   static void Run(const KernelCost &cost, Params... params, Args&&... args)
+   {
+      Signature kernel = Find(params...);
+      const bool fallback = (kernel == nullptr);
+      if (fallback)
       {
-         it->second(std::forward<Args>(args)...);
+         KernelReporter::ReportFallback(Kernels::Get().kernel_name, params...);
+         kernel = Kernels::Fallback(params...);
       }
-      else
+      if (!KernelProfiler::IsEnabled())
       {
-         KernelReporter::ReportFallback(Kernels::Get().kernel_name, params...);
-         Kernels::Fallback(params...)(std::forward<Args>(args)...);
+         kernel(std::forward<Args>(args)...);
+         return;
       }
+      const double start = KernelProfiler::Start();
+      kernel(std::forward<Args>(args)...);
+      KernelProfiler::Stop(Kernels::Get().kernel_name,
+                           internal::Stringify(params...), fallback, start,
+                           cost);
    }
 
    /// Register a specialized kernel for dispatch.
@@ -177,7 +254,22 @@ public:
       };
    };
 
+   /// @brief Enable the runtime compilation of the specializations that are
+   /// not registered, see JitCompiler.
+   ///
+   /// The Kernel function template must be defined in @a header, given as a
+   /// path relative to the MFEM source (or include) directory. @a class_name is
+   /// the fully qualified name of the dispatch table class. The dispatch
+   /// parameters must be integers.
+   static void EnableJit(const char *header, const char *class_name)
+   {
+      Kernels::Get().jit_header = header;
+      Kernels::Get().jit_class = class_name;
+   }
+
    /// Return the dispatch map table
+   /** The specializations compiled at runtime are added to the table by Run(),
+       which must not be called concurrently with the use of the table. */
    static const TableType &GetDispatchTable()
    {
       return Kernels::Get().table;
@@ -0,0 +1,218 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "kernel_reporter.hpp"
+#include "../general/forall.hpp"
+#ifdef MFEM_USE_MPI
+#include "../general/communication.hpp"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// Counters of one kernel, for one set of dispatch parameters.
+struct KernelCounters
+{
+   bool fallback = false;
+   long long calls = 0;
+   double total = 0.0;
+   double min = std::numeric_limits<double>::infinity();
+   double max = 0.0;
+   double bytes = 0.0;
+   double flops = 0.0;
+};
+
+class KernelProfile
+{
+public:
+   // Key: (kernel name, dispatch parameters).
+   std::map<std::pair<std::string, std::string>, KernelCounters> counters;
+   // Protects 'counters': kernels may be launched from several threads.
+   std::mutex mutex;
+   // MPI rank seen at a kernel call, -1 if unknown or in serial runs. It is
+   // only used if MPI is already finalized when the report is written.
+   int last_rank = -1;
+
+   // Return the MPI rank used in the name of the report file, -1 in serial
+   // runs.
+   int Rank()
+   {
+#ifdef MFEM_USE_MPI
+      if (Mpi::IsInitialized() && !Mpi::IsFinalized())
+      {
+         last_rank = (Mpi::WorldSize() > 1) ? Mpi::WorldRank() : -1;
+      }
+#endif
+      return last_rank;
+   }
+
+   static KernelProfile &Instance()
+   {
+      static KernelProfile instance;
+      return instance;
+   }
+
+   // Write the report requested through MFEM_PROFILE_KERNELS at program exit.
+   ~KernelProfile()
+   {
+      const char *env = GetEnv("MFEM_PROFILE_KERNELS");
+      if (!env || std::string(env) == "NO" || counters.empty()) { return; }
+
+      std::string fname(env);
+      auto ends_with = [&](const std::string &ext)
+      {
+         return fname.size() >= ext.size() &&
+                fname.compare(fname.size() - ext.size(), ext.size(), ext) == 0;
+      };
+      const bool csv = ends_with(".csv"), json = ends_with(".json");
+      if (!csv && !json)
+      {
+         KernelProfiler::Print(mfem::out, KernelProfiler::Format::JSON);
+         return;
+      }
+      const int rank = Rank();
+      if (rank >= 0)
+      {
+         fname.insert(fname.rfind('.'), "." + std::to_string(rank));
+      }
+      std::ofstream ofs(fname);
+      KernelProfiler::Print(ofs, csv ? KernelProfiler::Format::CSV :
+                            KernelProfiler::Format::JSON);
+   }
+};
+
+static bool ProfileKernelsEnv()
+{
+   const char *env = GetEnv("MFEM_PROFILE_KERNELS");
+   return env && std::string(env) != "NO";
+}
+
+// Escape the characters that can appear in kernel names (file paths).
+static std::string JSONString(const std::string &str)
+{
+   std::string res("\"");
+   for (char c : str)
+   {
+      if (c == '"' || c == '\\') { res += '\\'; }
+      res += c;
+   }
+   return res + '"';
+}
+
+} // namespace internal
+
+bool KernelProfiler::enabled = internal::ProfileKernelsEnv();
+
+void KernelProfiler::Enable() { enabled = true; }
+
+void KernelProfiler::Disable() { enabled = false; }
+
+void KernelProfiler::Clear()
+{
+   internal::KernelProfile &profile = internal::KernelProfile::Instance();
+   std::lock_guard<std::mutex> lock(profile.mutex);
+   profile.counters.clear();
+}
+
+double KernelProfiler::Start()
+{
+   if (Device::Allows(Backend::CUDA_MASK | Backend::HIP_MASK))
+   {
+      MFEM_DEVICE_SYNC;
+   }
+   using clock = std::chrono::steady_clock;
+   return std::chrono::duration<double>(
+             clock::now().time_since_epoch()).count();
+}
+
+void KernelProfiler::Stop(const char *kernel_name, const std::string &params,
+                          bool fallback, double start, const KernelCost &cost)
+{
+   const double elapsed = Start() - start;
+   internal::KernelProfile &profile = internal::KernelProfile::Instance();
+   std::lock_guard<std::mutex> lock(profile.mutex);
+   // remember the rank in case MPI is finalized before the report
+   if (profile.counters.empty()) { profile.Rank(); }
+   internal::KernelCounters &c = profile.counters[ {kernel_name, params}];
+   c.fallback = fallback;
+   c.calls++;
+   c.total += elapsed;
+   c.min = std::min(c.min, elapsed);
+   c.max = std::max(c.max, elapsed);
+   c.bytes += cost.bytes;
+   c.flops += cost.flops;
+}
+
+void KernelProfiler::Print(std::ostream &os, Format fmt)
+{
+   internal::KernelProfile &profile = internal::KernelProfile::Instance();
+   std::lock_guard<std::mutex> lock(profile.mutex);
+   const auto &counters = profile.counters;
+   const std::ios::fmtflags flags = os.flags();
+   const std::streamsize precision = os.precision(6);
+   if (fmt == Format::CSV)
+   {
+      os << "kernel,params,fallback,calls,total_s,min_s,max_s,"
+         "bytes,flops,GB/s,GFLOP/s\n";
+   }
+   else
+   {
+      os << "{\n  \"kernels\": [";
+   }
+   bool first = true;
+   for (const auto &entry : counters)
+   {
+      const std::string &name = entry.first.first;
+      const std::string &params = entry.first.second;
+      const internal::KernelCounters &c = entry.second;
+      const double gbs = (c.total > 0.0) ? 1e-9*c.bytes/c.total : 0.0;
+      const double gflops = (c.total > 0.0) ? 1e-9*c.flops/c.total : 0.0;
+      if (fmt == Format::CSV)
+      {
+         os << '"' << name << "\",\"" << params << "\","
+            << c.fallback << ',' << c.calls << ',' << c.total << ','
+            << c.min << ',' << c.max << ',' << c.bytes << ',' << c.flops
+            << ',' << gbs << ',' << gflops << '\n';
+      }
+      else
+      {
+         os << (first ? "\n" : ",\n")
+            << "    {\"kernel\": " << internal::JSONString(name)
+            << ", \"params\": [" << params << ']'
+            << ", \"fallback\": " << (c.fallback ? "true" : "false")
+            << ", \"calls\": " << c.calls
+            << ", \"total_s\": " << c.total
+            << ", \"min_s\": " << c.min
+            << ", \"max_s\": " << c.max
+            << ", \"bytes\": " << c.bytes
+            << ", \"flops\": " << c.flops
+            << ", \"GB/s\": " << gbs
+            << ", \"GFLOP/s\": " << gflops << '}';
+      }
+      first = false;
+   }
+   if (fmt == Format::JSON) { os << "\n  ]\n}\n"; }
+   os.flush();
+   os.flags(flags);
+   os.precision(precision);
+}
+
+} // namespace mfem
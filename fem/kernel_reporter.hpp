@@ -97,6 +97,61 @@ public:
    }
 };
 
+/// @brief Estimated amount of data moved and floating-point operations
+/// performed by one call to a kernel, see KernelProfiler.
+struct KernelCost
+{
+   double bytes; ///< Number of bytes read and written.
+   double flops; ///< Number of floating-point operations.
+
+   explicit KernelCost(double bytes_ = 0.0, double flops_ = 0.0)
+      : bytes(bytes_), flops(flops_) { }
+};
+
+/// @brief Singleton class collecting performance counters of the kernels
+/// registered with MFEM_REGISTER_KERNELS.
+///
+/// For each kernel and each set of dispatch parameters (e.g. dim, D1D, Q1D),
+/// the number of calls, the total, minimum and maximum wall time, and the
+/// estimated number of bytes moved and of floating-point operations (see
+/// KernelCost) are recorded. When the kernels run on a GPU, the device is
+/// synchronized before and after each call so that the timings are meaningful.
+///
+/// @note This class is only enabled when the environment variable
+/// MFEM_PROFILE_KERNELS is set to a value other than 'NO' or if
+/// KernelProfiler::Enable() is called. If the value of MFEM_PROFILE_KERNELS
+/// ends with '.csv' or '.json', the report is written at program exit to that
+/// file in the corresponding format (with the MPI rank appended to the file
+/// name in parallel runs); otherwise, a JSON report is written to mfem::out.
+class KernelProfiler
+{
+public:
+   /// Output formats of the report.
+   enum class Format { JSON, CSV };
+
+   /// Enable the collection of performance counters.
+   static void Enable();
+   /// Disable the collection of performance counters.
+   static void Disable();
+   /// Return true if the performance counters are being collected.
+   static bool IsEnabled() { return enabled; }
+   /// Clear all counters collected so far.
+   static void Clear();
+   /// Write the report of all counters collected so far to @a os.
+   static void Print(std::ostream &os, Format fmt = Format::JSON);
+
+   /// @brief Return a time stamp (in seconds) marking the start of a kernel
+   /// call.
+   static double Start();
+   /// @brief Record a call to the kernel @a kernel_name with dispatch
+   /// parameters @a params, started at time @a start (see Start()).
+   static void Stop(const char *kernel_name, const std::string &params,
+                    bool fallback, double start, const KernelCost &cost);
+
+private:
+   static MFEM_EXPORT bool enabled;
+};
+
 } // namespace mfem
 
 #endif
@@ -214,7 +214,11 @@ const Vector &NonlinearForm::Prolongate(const Vector &x) const
 
 void NonlinearForm::Mult(const Vector &x, Vector &y) const
 {
-   const Vector &px = Prolongate(x);
+   MultProlongated(Prolongate(x), y);
+}
+
+void NonlinearForm::MultProlongated(const Vector &px, Vector &y) const
+{
    if (P) { aux2.SetSize(P->Height()); }
 
    // If we are in parallel, ParNonLinearForm::Mult uses the aux2 vector. In
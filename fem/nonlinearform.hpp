@@ -75,6 +75,10 @@ protected:
    bool Serial() const { return (!P || cP); }
    const Vector &Prolongate(const Vector &x) const;
 
+   /** @brief Compute the local action of the form on the prolongated vector
+       @a px, see Mult(). In parallel, the result is stored in #aux2. */
+   void MultProlongated(const Vector &px, Vector &y) const;
+
 public:
    /// Construct a NonlinearForm on the given FiniteElementSpace, @a f.
    /** As an Operator, the NonlinearForm has input and output size equal to the
@@ -90,12 +90,14 @@ ParGridFunction::ParGridFunction(ParMesh *pmesh, std::istream &input)
 
 void ParGridFunction::Update()
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::Update();
 }
 
 void ParGridFunction::SetSpace(FiniteElementSpace *f)
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::SetSpace(f);
    pfes = dynamic_cast<ParFiniteElementSpace*>(f);
@@ -104,6 +106,7 @@ void ParGridFunction::SetSpace(FiniteElementSpace *f)
 
 void ParGridFunction::SetSpace(ParFiniteElementSpace *f)
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::SetSpace(f);
    pfes = f;
@@ -111,6 +114,7 @@ void ParGridFunction::SetSpace(ParFiniteElementSpace *f)
 
 void ParGridFunction::MakeRef(FiniteElementSpace *f, real_t *v)
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::MakeRef(f, v);
    pfes = dynamic_cast<ParFiniteElementSpace*>(f);
@@ -119,6 +123,7 @@ void ParGridFunction::MakeRef(FiniteElementSpace *f, real_t *v)
 
 void ParGridFunction::MakeRef(ParFiniteElementSpace *f, real_t *v)
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::MakeRef(f, v);
    pfes = f;
@@ -126,6 +131,7 @@ void ParGridFunction::MakeRef(ParFiniteElementSpace *f, real_t *v)
 
 void ParGridFunction::MakeRef(FiniteElementSpace *f, Vector &v, int v_offset)
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::MakeRef(f, v, v_offset);
    pfes = dynamic_cast<ParFiniteElementSpace*>(f);
@@ -134,6 +140,7 @@ void ParGridFunction::MakeRef(FiniteElementSpace *f, Vector &v, int v_offset)
 
 void ParGridFunction::MakeRef(ParFiniteElementSpace *f, Vector &v, int v_offset)
 {
+   ExchangeFaceNbrDataEnd();
    face_nbr_data.Destroy();
    GridFunction::MakeRef(f, v, v_offset);
    pfes = f;
@@ -214,6 +221,15 @@ HypreParVector *ParGridFunction::ParallelAssemble() const
 
 void ParGridFunction::ExchangeFaceNbrData()
 {
+   ExchangeFaceNbrDataBegin();
+   ExchangeFaceNbrDataEnd();
+}
+
+void ParGridFunction::ExchangeFaceNbrDataBegin()
+{
+   MFEM_VERIFY(face_nbr_requests.empty(),
+               "the face-neighbor exchange is already in progress");
+
    pfes->ExchangeFaceNbrData();
 
    if (pfes->GetFaceNbrVSize() <= 0)
@@ -233,10 +249,9 @@ void ParGridFunction::ExchangeFaceNbrData()
    MPI_Comm MyComm = pfes->GetComm();
 
    int num_face_nbrs = pmesh->GetNFaceNeighbors();
-   MPI_Request *requests = new MPI_Request[2*num_face_nbrs];
-   MPI_Request *send_requests = requests;
-   MPI_Request *recv_requests = requests + num_face_nbrs;
-   MPI_Status  *statuses = new MPI_Status[num_face_nbrs];
+   face_nbr_requests.resize(2*num_face_nbrs);
+   MPI_Request *send_requests = face_nbr_requests.data();
+   MPI_Request *recv_requests = send_requests + num_face_nbrs;
 
    auto d_data = this->Read();
    auto d_send_data = send_data.Write();
@@ -265,12 +280,15 @@ void ParGridFunction::ExchangeFaceNbrData()
                 recv_offset[fn+1] - recv_offset[fn],
                 MPITypeMap<real_t>::mpi_type, nbr_rank, tag, MyComm, &recv_requests[fn]);
    }
+}
 
-   MPI_Waitall(num_face_nbrs, send_requests, statuses);
-   MPI_Waitall(num_face_nbrs, recv_requests, statuses);
+void ParGridFunction::ExchangeFaceNbrDataEnd()
+{
+   if (face_nbr_requests.empty()) { return; }
 
-   delete [] statuses;
-   delete [] requests;
+   MPI_Waitall(static_cast<int>(face_nbr_requests.size()),
+               face_nbr_requests.data(), MPI_STATUSES_IGNORE);
+   face_nbr_requests.clear();
 }
 
 real_t ParGridFunction::GetValue(int i, const IntegrationPoint &ip, int vdim)
@@ -21,6 +21,7 @@
 #include "gridfunc.hpp"
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace mfem
 {
@@ -60,6 +61,12 @@ protected:
    //TODO: Use temporary memory to avoid CUDA malloc allocation cost.
    Vector send_data;
 
+   /** @brief Send and receive requests of a face-neighbor exchange started
+       by ExchangeFaceNbrDataBegin(), empty if no exchange is in progress.
+       The methods that destroy #face_nbr_data, and the destructor, complete a
+       pending exchange first. */
+   std::vector<MPI_Request> face_nbr_requests;
+
    void ProjectBdrCoefficient(Coefficient *coeff[], VectorCoefficient *vcoeff,
                               const Array<int> &attr);
 
@@ -221,7 +228,24 @@ public:
    /// Returns a new vector assembled on the true dofs.
    HypreParVector *ParallelAssemble() const;
 
+   /** @brief Exchange the data of the face-neighbor elements, see
+       FaceNbrData(). Equivalent to ExchangeFaceNbrDataBegin() followed by
+       ExchangeFaceNbrDataEnd(). */
    void ExchangeFaceNbrData();
+
+   /** @brief Start the exchange of the face-neighbor data with non-blocking
+       MPI calls. */
+   /** The data of the ParGridFunction is copied into the send buffer before
+       this method returns, so it may be read, but FaceNbrData() must not be
+       used until ExchangeFaceNbrDataEnd() is called. In the meantime, the
+       caller can perform the computations that do not involve face-neighbor
+       elements, e.g. on the local elements and interior faces. */
+   void ExchangeFaceNbrDataBegin();
+
+   /** @brief Complete the exchange started by ExchangeFaceNbrDataBegin(). Does
+       nothing if no exchange is in progress. */
+   void ExchangeFaceNbrDataEnd();
+
    Vector &FaceNbrData() { return face_nbr_data; }
    const Vector &FaceNbrData() const { return face_nbr_data; }
 
@@ -631,7 +655,8 @@ public:
    /// Merge the local grid functions
    void SaveAsOne(std::ostream &out = mfem::out) const;
 
-   virtual ~ParGridFunction() = default;
+   /// Completes a face-neighbor exchange that is still in progress.
+   virtual ~ParGridFunction() { ExchangeFaceNbrDataEnd(); }
 };
 
 
@@ -47,11 +47,21 @@ real_t ParNonlinearForm::GetParGridFunctionEnergy(const Vector &x) const
 
 void ParNonlinearForm::Mult(const Vector &x, Vector &y) const
 {
-   NonlinearForm::Mult(x, y); // x --(P)--> aux1 --(A_local)--> aux2
+   const Vector &px = Prolongate(x); // x --(P)--> aux1
 
    if (fnfi.Size())
    {
       MFEM_VERIFY(!NonlinearForm::ext, "Not implemented (extensions + faces");
+      // Start the face-neighbor exchange, overlapped with the local terms
+      aux1.HostReadWrite();
+      X.MakeRef(aux1, 0); // aux1 contains P.x
+      X.ExchangeFaceNbrDataBegin();
+   }
+
+   MultProlongated(px, y); // aux1 --(A_local)--> aux2
+
+   if (fnfi.Size())
+   {
       // Terms over shared interior faces in parallel.
       ParFiniteElementSpace *pfes = ParFESpace();
       ParMesh *pmesh = pfes->GetParMesh();
@@ -60,9 +70,7 @@ void ParNonlinearForm::Mult(const Vector &x, Vector &y) const
       Array<int> vdofs1, vdofs2;
       Vector el_x, el_y;
 
-      aux1.HostReadWrite();
-      X.MakeRef(aux1, 0); // aux1 contains P.x
-      X.ExchangeFaceNbrData();
+      X.ExchangeFaceNbrDataEnd();
       const int n_shared_faces = pmesh->GetNSharedFaces();
       for (int i = 0; i < n_shared_faces; i++)
       {
@@ -17,6 +17,7 @@
 #include "qspace.hpp"
 #include "fe/face_map_utils.hpp"
 #include "../general/forall.hpp"
+#include "../general/annotation.hpp"
 
 #include <climits>
 
@@ -105,6 +106,7 @@ ElementRestriction::ElementRestriction(const FiniteElementSpace &f,
 
 void ElementRestriction::Mult(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_FUNCTION;
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -178,6 +180,7 @@ void ElementRestriction::TAddMultTranspose(const Vector& x, Vector& y) const
 
 void ElementRestriction::MultTranspose(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_FUNCTION;
    constexpr bool ADD = false;
    TAddMultTranspose<ADD>(x, y);
 }
@@ -0,0 +1,241 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "annotation.hpp"
+
+#ifndef MFEM_USE_CALIPER
+
+#include "globals.hpp"
+#ifdef MFEM_USE_MPI
+#include "communication.hpp"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+struct TraceEvent
+{
+   const char *name;
+   std::uint64_t time, duration; // in nanoseconds
+   char phase; // 'B': begin, 'E': end, 'X': complete
+};
+
+// Ring buffer of events, written only by its owner thread. The events with
+// indices in [start, count) are valid; Clear() only moves 'start'.
+struct TraceBuffer
+{
+   int tid;
+   std::vector<TraceEvent> events;
+   std::atomic<std::uint64_t> count{0}; // total number of events recorded
+   std::atomic<std::uint64_t> start{0}; // index of the first valid event
+
+   TraceBuffer(int tid_, int size) : tid(tid_), events(size) { }
+};
+
+class Trace
+{
+public:
+   std::mutex mtx; // protects the members below, not the buffers
+   std::vector<std::unique_ptr<TraceBuffer>> buffers;
+   std::set<std::string> names;
+   std::string filename;
+   int buffer_size = 1 << 16;
+   // MPI rank and size, updated while recording: MPI may be finalized when
+   // the trace is written at program exit.
+   int rank = 0, size = 1;
+
+   void UpdateRank()
+   {
+#ifdef MFEM_USE_MPI
+      if (Mpi::IsInitialized() && !Mpi::IsFinalized())
+      {
+         rank = Mpi::WorldRank();
+         size = Mpi::WorldSize();
+      }
+#endif
+   }
+
+   static Trace &Instance()
+   {
+      static Trace instance;
+      return instance;
+   }
+
+   TraceBuffer *NewBuffer()
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      UpdateRank();
+      buffers.emplace_back(new TraceBuffer(int(buffers.size()), buffer_size));
+      return buffers.back().get();
+   }
+
+   ~Trace()
+   {
+      if (filename.empty()) { return; }
+      std::string fname = filename;
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         UpdateRank();
+      }
+      if (size > 1)
+      {
+         size_t dot = fname.rfind('.');
+         if (dot == std::string::npos) { dot = fname.size(); }
+         fname.insert(dot, "." + std::to_string(rank));
+      }
+      std::ofstream ofs(fname);
+      TraceRecorder::Write(ofs);
+   }
+};
+
+static thread_local TraceBuffer *trace_buffer = nullptr;
+
+static bool TraceEnv()
+{
+   const char *env = GetEnv("MFEM_TRACE");
+   if (!env || !*env) { return false; }
+   Trace::Instance().filename = env;
+   return true;
+}
+
+static void WriteJSONString(std::ostream &os, const char *str)
+{
+   os << '"';
+   for (const char *c = str; *c; c++)
+   {
+      if (*c == '"' || *c == '\\') { os << '\\'; }
+      os << *c;
+   }
+   os << '"';
+}
+
+} // namespace internal
+
+bool TraceRecorder::enabled = internal::TraceEnv();
+
+void TraceRecorder::Enable(const std::string &filename)
+{
+   internal::Trace &trace = internal::Trace::Instance();
+   {
+      std::lock_guard<std::mutex> lock(trace.mtx);
+      trace.filename = filename;
+   }
+   Now(); // set the time origin
+   enabled = true;
+}
+
+void TraceRecorder::SetBufferSize(int num_events)
+{
+   internal::Trace &trace = internal::Trace::Instance();
+   std::lock_guard<std::mutex> lock(trace.mtx);
+   trace.buffer_size = num_events > 0 ? num_events : 1;
+}
+
+void TraceRecorder::Clear()
+{
+   internal::Trace &trace = internal::Trace::Instance();
+   std::lock_guard<std::mutex> lock(trace.mtx);
+   for (auto &buf : trace.buffers) { buf->start.store(buf->count.load()); }
+}
+
+std::uint64_t TraceRecorder::Now()
+{
+   using clock = std::chrono::steady_clock;
+   static const clock::time_point origin = clock::now();
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             clock::now() - origin).count();
+}
+
+const char *TraceRecorder::Intern(const std::string &name)
+{
+   internal::Trace &trace = internal::Trace::Instance();
+   std::lock_guard<std::mutex> lock(trace.mtx);
+   return trace.names.insert(name).first->c_str();
+}
+
+void TraceRecorder::Record(const char *name, char phase, std::uint64_t time,
+                           std::uint64_t duration)
+{
+   internal::TraceBuffer *buf = internal::trace_buffer;
+   if (!buf)
+   {
+      buf = internal::trace_buffer = internal::Trace::Instance().NewBuffer();
+   }
+   const std::uint64_t count = buf->count.load(std::memory_order_relaxed);
+   // Refresh the MPI rank once in a while, in case MPI was initialized after
+   // the buffer was created.
+   if ((count & 0xfff) == 0 && buf->tid == 0)
+   {
+      internal::Trace &trace = internal::Trace::Instance();
+      std::lock_guard<std::mutex> lock(trace.mtx);
+      trace.UpdateRank();
+   }
+   internal::TraceEvent &ev = buf->events[count % buf->events.size()];
+   ev.name = name;
+   ev.time = time;
+   ev.duration = duration;
+   ev.phase = phase;
+   // publish the event to Write()
+   buf->count.store(count + 1, std::memory_order_release);
+}
+
+void TraceRecorder::Write(std::ostream &os)
+{
+   internal::Trace &trace = internal::Trace::Instance();
+   std::lock_guard<std::mutex> lock(trace.mtx);
+   trace.UpdateRank();
+   const int pid = trace.rank;
+   os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+   bool first = true;
+   for (const auto &buf : trace.buffers)
+   {
+      const std::uint64_t size = buf->events.size();
+      const std::uint64_t count = buf->count.load(std::memory_order_acquire);
+      const std::uint64_t begin =
+         std::max(buf->start.load(), (count > size) ? count - size : 0);
+      for (std::uint64_t i = begin; i < count; i++)
+      {
+         const internal::TraceEvent &ev = buf->events[i % size];
+         os << (first ? "\n" : ",\n") << "{\"name\": ";
+         internal::WriteJSONString(os, ev.name);
+         // Chrome trace timestamps are in microseconds
+         os << ", \"ph\": \"" << ev.phase << "\", \"ts\": " << ev.time/1000
+            << '.' << (ev.time % 1000)/100 << (ev.time % 100)/10
+            << ev.time % 10;
+         if (ev.phase == 'X')
+         {
+            os << ", \"dur\": " << ev.duration/1000 << '.'
+               << (ev.duration % 1000)/100 << (ev.duration % 100)/10
+               << ev.duration % 10;
+         }
+         os << ", \"pid\": " << pid << ", \"tid\": " << buf->tid << '}';
+         first = false;
+      }
+   }
+   os << "\n]}\n";
+   os.flush();
+}
+
+} // namespace mfem
+
+#endif // MFEM_USE_CALIPER
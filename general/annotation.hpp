@@ -27,10 +27,92 @@
 
 #else
 
-#define MFEM_PERF_FUNCTION
-#define MFEM_PERF_BEGIN(s)
-#define MFEM_PERF_END(s)
-#define MFEM_PERF_SCOPE(name)
+#include <cstdint>
+#include <string>
+#include <ostream>
+
+namespace mfem
+{
+
+/** @brief Native timeline recorder used by the MFEM_PERF_* macros when MFEM is
+    built without Caliper. */
+/** The events are stored in a fixed-size ring buffer owned by each thread, so
+    recording an event does not take any lock. When the buffer of a thread is
+    full, its oldest events are overwritten.
+
+    The recorder is enabled by setting the environment variable MFEM_TRACE to
+    the name of the output file, or by calling Enable(). At program exit, the
+    recorded events are written in the Chrome trace (JSON) format, which can
+    be viewed with Perfetto (https://ui.perfetto.dev) or chrome://tracing. In
+    parallel runs, the MPI rank is used as the process id of the events and is
+    inserted before the extension of the file name, e.g. 'trace.3.json'.
+
+    Event names must be string literals or std::string objects; other
+    character pointers must remain valid until the trace is written. */
+class TraceRecorder
+{
+public:
+   /// Enable the recording; the trace is written to @a filename at exit.
+   static void Enable(const std::string &filename);
+   /// Disable the recording. The events recorded so far are kept.
+   static void Disable() { enabled = false; }
+   /// Return true if events are being recorded.
+   static bool IsEnabled() { return enabled; }
+   /// Set the capacity (in events) of the buffers created after this call.
+   static void SetBufferSize(int num_events);
+   /// Remove all recorded events. Can be called while other threads record.
+   static void Clear();
+   /** @brief Write the recorded events to @a os in the Chrome trace format.
+       The other threads should not record events during the call, since the
+       oldest events of a full buffer may be overwritten while being read. */
+   static void Write(std::ostream &os);
+
+   /// Record the beginning of the region @a name.
+   static void Begin(const char *name)
+   { if (enabled) { Record(name, 'B', Now(), 0); } }
+   static void Begin(const std::string &name)
+   { if (enabled) { Record(Intern(name), 'B', Now(), 0); } }
+   /// Record the end of the region @a name.
+   static void End(const char *name)
+   { if (enabled) { Record(name, 'E', Now(), 0); } }
+   static void End(const std::string &name)
+   { if (enabled) { Record(Intern(name), 'E', Now(), 0); } }
+
+   /// Records the lifetime of the object as a single (complete) event.
+   class Scope
+   {
+      const char *name;
+      std::uint64_t start;
+   public:
+      explicit Scope(const char *name_)
+         : name(enabled ? name_ : nullptr), start(name ? Now() : 0) { }
+      explicit Scope(const std::string &name_)
+         : name(enabled ? Intern(name_) : nullptr), start(name ? Now() : 0) { }
+      ~Scope() { if (name) { Record(name, 'X', start, Now() - start); } }
+   };
+
+private:
+   static MFEM_EXPORT bool enabled;
+
+   /// Time in nanoseconds since the first call.
+   static std::uint64_t Now();
+   /// Return a pointer to a persistent copy of @a name.
+   static const char *Intern(const std::string &name);
+   static void Record(const char *name, char phase, std::uint64_t time,
+                      std::uint64_t duration);
+};
+
+} // namespace mfem
+
+#define MFEM_PERF_CONCAT_(a, b) a##b
+#define MFEM_PERF_CONCAT(a, b) MFEM_PERF_CONCAT_(a, b)
+
+#define MFEM_PERF_FUNCTION \
+   mfem::TraceRecorder::Scope mfem_perf_function_scope(__func__)
+#define MFEM_PERF_BEGIN(s) mfem::TraceRecorder::Begin(s)
+#define MFEM_PERF_END(s) mfem::TraceRecorder::End(s)
+#define MFEM_PERF_SCOPE(name) \
+   mfem::TraceRecorder::Scope MFEM_PERF_CONCAT(mfem_perf_scope_, __LINE__)(name)
 
 #endif
 
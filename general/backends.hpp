@@ -94,6 +94,14 @@ MFEM_HOST_DEVICE T AtomicAdd(T &add, const T val)
 #if ((defined(MFEM_USE_CUDA) && defined(__CUDA_ARCH__)) || \
      (defined(MFEM_USE_HIP)  && defined(__HIP_DEVICE_COMPILE__)))
    return atomicAdd(&add,val);
+#elif defined(__GNUC__)
+   // Host atomic update, needed by the OpenMP and the std::thread backends.
+   T old, upd;
+   __atomic_load(&add, &old, __ATOMIC_RELAXED);
+   do { upd = old + val; }
+   while (!__atomic_compare_exchange(&add, &old, &upd, true,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+   return old;
 #else
    T old = add;
 #ifdef MFEM_USE_OPENMP
@@ -353,6 +353,9 @@ const MPI_Datatype MPITypeMap<float>::mpi_type = MPI_FLOAT;
 const MPI_Datatype MPITypeMap<double>::mpi_type = MPI_DOUBLE;
 
 
+GroupCommunicator::Mode GroupCommunicator::default_mode =
+   GroupCommunicator::byNeighbor;
+
 GroupCommunicator::GroupCommunicator(const GroupTopology &gt, Mode m)
    : gtopo(gt), mode(m)
 {
@@ -363,6 +366,10 @@ GroupCommunicator::GroupCommunicator(const GroupTopology &gt, Mode m)
    num_requests = 0;
    request_marker = NULL;
    buf_offsets = NULL;
+   nbr_comm = MPI_COMM_NULL;
+#if MPI_VERSION < 3
+   if (mode == byNeighborCollective) { mode = byNeighbor; }
+#endif
 }
 
 void GroupCommunicator::Create(const Array<int> &ldof_group)
@@ -417,6 +424,8 @@ void GroupCommunicator::Finalize()
       }
    }
 
+   // The neighborhood collective uses one request, see BcastBegin().
+   request_counter = max(request_counter, 1);
    requests = new MPI_Request[request_counter];
    // statuses = new MPI_Status[request_counter];
    request_marker = new int[request_counter];
@@ -498,6 +507,49 @@ void GroupCommunicator::Finalize()
          }
       }
    }
+
+#if MPI_VERSION >= 3
+   if (mode == byNeighborCollective)
+   {
+      // All neighbors are both sources and destinations, with zero counts if
+      // no data is exchanged, so that the graph is symmetric.
+      const int num_nbrs = gtopo.GetNumNeighbors() - 1;
+      Array<int> nbr_ranks(num_nbrs);
+      nbr_send_counts.SetSize(num_nbrs);
+      nbr_recv_counts.SetSize(num_nbrs);
+      for (int nbr = 1; nbr <= num_nbrs; nbr++)
+      {
+         nbr_ranks[nbr-1] = gtopo.GetNeighborRank(nbr);
+         nbr_send_counts[nbr-1] = nbr_recv_counts[nbr-1] = 0;
+         for (int i = 0; i < nbr_send_groups.RowSize(nbr); i++)
+         {
+            nbr_send_counts[nbr-1] +=
+               group_ldof.RowSize(nbr_send_groups.GetRow(nbr)[i]);
+         }
+         for (int i = 0; i < nbr_recv_groups.RowSize(nbr); i++)
+         {
+            nbr_recv_counts[nbr-1] +=
+               group_ldof.RowSize(nbr_recv_groups.GetRow(nbr)[i]);
+         }
+      }
+      nbr_send_displs.SetSize(num_nbrs + 1);
+      nbr_recv_displs.SetSize(num_nbrs + 1);
+      nbr_send_displs[0] = nbr_recv_displs[0] = 0;
+      for (int k = 0; k < num_nbrs; k++)
+      {
+         nbr_send_displs[k+1] = nbr_send_displs[k] + nbr_send_counts[k];
+         nbr_recv_displs[k+1] = nbr_recv_displs[k] + nbr_recv_counts[k];
+      }
+      MFEM_ASSERT(nbr_send_displs[num_nbrs] + nbr_recv_displs[num_nbrs] ==
+                  group_buf_size, "");
+      MPI_Dist_graph_create_adjacent(gtopo.GetComm(),
+                                     num_nbrs, nbr_ranks.GetData(),
+                                     MPI_UNWEIGHTED,
+                                     num_nbrs, nbr_ranks.GetData(),
+                                     MPI_UNWEIGHTED,
+                                     MPI_INFO_NULL, 0, &nbr_comm);
+   }
+#endif
 }
 
 void GroupCommunicator::SetLTDofTable(const Array<int> &ldof_ltdof)
@@ -713,7 +765,9 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 {
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
-   if (group_buf_size == 0) { return; }
+   // The neighborhood collective is collective over nbr_comm, so it is posted
+   // (with zero counts) also by the ranks without shared data.
+   if (group_buf_size == 0 && mode != byNeighborCollective) { return; }
 
    int request_counter = 0;
    switch (mode)
@@ -839,6 +893,33 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
          break;
       }
+
+      case byNeighborCollective: // ***** Neighborhood collective *****
+      {
+#if MPI_VERSION >= 3
+         // The sent data is followed by the received data in group_buf
+         group_buf.SetSize(group_buf_size*sizeof(T));
+         T *buf = (T *)group_buf.GetData();
+         for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+         {
+            const int *grp_list = nbr_send_groups.GetRow(nbr);
+            for (int i = 0; i < nbr_send_groups.RowSize(nbr); i++)
+            {
+               buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
+            }
+         }
+         T *send_buf = (T *)group_buf.GetData();
+         MPI_Ineighbor_alltoallv(send_buf, nbr_send_counts.GetData(),
+                                 nbr_send_displs.GetData(),
+                                 MPITypeMap<T>::mpi_type,
+                                 buf, nbr_recv_counts.GetData(),
+                                 nbr_recv_displs.GetData(),
+                                 MPITypeMap<T>::mpi_type,
+                                 nbr_comm, &requests[0]);
+         request_counter = 1;
+#endif
+         break;
+      }
    }
 
    comm_lock = 1; // 1 - locked for Bcast
@@ -849,7 +930,8 @@ template <class T>
 void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 {
    if (comm_lock == 0) { return; }
-   // The above also handles the case (group_buf_size == 0).
+   // The above also handles the case (group_buf_size == 0), except in the
+   // byNeighborCollective mode.
    MFEM_VERIFY(comm_lock == 1, "object is NOT locked for Bcast");
 
    switch (mode)
@@ -901,6 +983,21 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
          }
          break;
       }
+
+      case byNeighborCollective: // ***** Neighborhood collective *****
+      {
+         MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+         const T *buf = (T*)group_buf.GetData() + nbr_send_displs.Last();
+         for (int nbr = 1; nbr < nbr_recv_groups.Size(); nbr++)
+         {
+            const int *grp_list = nbr_recv_groups.GetRow(nbr);
+            for (int i = 0; i < nbr_recv_groups.RowSize(nbr); i++)
+            {
+               buf = CopyGroupFromBuffer(buf, ldata, grp_list[i], layout);
+            }
+         }
+         break;
+      }
    }
 
    comm_lock = 0; // 0 - no lock
@@ -912,7 +1009,9 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
 {
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
-   if (group_buf_size == 0) { return; }
+   // The neighborhood collective is collective over nbr_comm, so it is posted
+   // (with zero counts) also by the ranks without shared data.
+   if (group_buf_size == 0 && mode != byNeighborCollective) { return; }
 
    int request_counter = 0;
    group_buf.SetSize(group_buf_size*sizeof(T));
@@ -1020,6 +1119,32 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
          break;
       }
+
+      case byNeighborCollective: // ***** Neighborhood collective *****
+      {
+#if MPI_VERSION >= 3
+         // In Reduce operation: send_groups <--> recv_groups
+         for (int nbr = 1; nbr < nbr_recv_groups.Size(); nbr++)
+         {
+            const int *grp_list = nbr_recv_groups.GetRow(nbr);
+            for (int i = 0; i < nbr_recv_groups.RowSize(nbr); i++)
+            {
+               const int layout = 0; // ldata is an array on all ldofs
+               buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
+            }
+         }
+         T *send_buf = (T *)group_buf.GetData();
+         MPI_Ineighbor_alltoallv(send_buf, nbr_recv_counts.GetData(),
+                                 nbr_recv_displs.GetData(),
+                                 MPITypeMap<T>::mpi_type,
+                                 buf, nbr_send_counts.GetData(),
+                                 nbr_send_displs.GetData(),
+                                 MPITypeMap<T>::mpi_type,
+                                 nbr_comm, &requests[0]);
+         request_counter = 1;
+#endif
+         break;
+      }
    }
 
    comm_lock = 2;
@@ -1031,7 +1156,8 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
                                   void (*Op)(OpData<T>)) const
 {
    if (comm_lock == 0) { return; }
-   // The above also handles the case (group_buf_size == 0).
+   // The above also handles the case (group_buf_size == 0), except in the
+   // byNeighborCollective mode.
    MFEM_VERIFY(comm_lock == 2, "object is NOT locked for Reduce");
 
    switch (mode)
@@ -1090,6 +1216,22 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
          }
          break;
       }
+
+      case byNeighborCollective: // ***** Neighborhood collective *****
+      {
+         MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+         // In Reduce operation: send_groups <--> recv_groups
+         const T *buf = (T*)group_buf.GetData() + nbr_recv_displs.Last();
+         for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+         {
+            const int *grp_list = nbr_send_groups.GetRow(nbr);
+            for (int i = 0; i < nbr_send_groups.RowSize(nbr); i++)
+            {
+               buf = ReduceGroupFromBuffer(buf, ldata, grp_list[i], layout, Op);
+            }
+         }
+         break;
+      }
    }
 
    comm_lock = 0; // 0 - no lock
@@ -1179,7 +1321,7 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
    int num_sends = 0, num_recvs = 0;
    size_t mem_sends = 0, mem_recvs = 0;
    int num_master_groups = 0, num_empty_groups = 0;
-   int num_active_neighbors = 0; // for mode == byNeighbor
+   int num_active_neighbors = 0; // for mode != byGroup
    switch (mode)
    {
       case byGroup:
@@ -1206,6 +1348,7 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
          break;
 
       case byNeighbor:
+      case byNeighborCollective:
          for (int gr = 1; gr < group_ldof.Size(); gr++)
          {
             const int nldofs = group_ldof.RowSize(gr);
@@ -1260,7 +1403,8 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
    }
    os << "Rank " << myid << ":\n"
       "   mode             = " <<
-      (mode == byGroup ? "byGroup" : "byNeighbor") << "\n"
+      (mode == byGroup ? "byGroup" : mode == byNeighbor ? "byNeighbor" :
+       "byNeighborCollective") << "\n"
       "   number of sends  = " << num_sends <<
       " (" << mem_sends << " bytes)\n"
       "   number of recvs  = " << num_recvs <<
@@ -1270,7 +1414,7 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
       num_master_groups << " + " <<
       group_ldof.Size()-num_master_groups-num_empty_groups << " + " <<
       num_empty_groups << " (master + slave + empty)\n";
-   if (mode == byNeighbor)
+   if (mode != byGroup)
    {
       os <<
          "   num neighbors    = " << nbr_send_groups.Size() << " = " <<
@@ -1292,6 +1436,12 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
 
 GroupCommunicator::~GroupCommunicator()
 {
+   int mpi_finalized;
+   MPI_Finalized(&mpi_finalized);
+   if (nbr_comm != MPI_COMM_NULL && !mpi_finalized)
+   {
+      MPI_Comm_free(&nbr_comm);
+   }
    delete [] buf_offsets;
    delete [] request_marker;
    // delete [] statuses;
@@ -227,8 +227,14 @@ public:
    enum Mode
    {
       byGroup,    ///< Communications are performed one group at a time.
-      byNeighbor  /**< Communications are performed one neighbor at a time,
+      byNeighbor, /**< Communications are performed one neighbor at a time,
                        aggregating over groups. */
+      byNeighborCollective /**< Communications are performed with one
+                                non-blocking neighborhood collective,
+                                MPI_Ineighbor_alltoallv(), over a distributed
+                                graph communicator of the neighbors, created
+                                once by Finalize(). Requires MPI-3, otherwise
+                                byNeighbor is used. */
    };
 
 protected:
@@ -247,6 +253,16 @@ protected:
    int *buf_offsets; // size = max(number of groups, number of neighbors)
    Table nbr_send_groups, nbr_recv_groups; // nbr 0 = me
 
+   // Mode byNeighborCollective: graph communicator of the neighbors 1, 2, ...
+   // and counts and displacements (with the total at the end) of the data
+   // sent to and received from each neighbor in Bcast. In Reduce, the roles
+   // of the send and receive arrays are exchanged.
+   MPI_Comm nbr_comm;
+   Array<int> nbr_send_counts, nbr_send_displs;
+   Array<int> nbr_recv_counts, nbr_recv_displs;
+
+   static Mode default_mode;
+
 public:
    /// Construct a GroupCommunicator object.
    /** The object must be initialized before it can be used to perform any
@@ -255,7 +271,15 @@ public:
        - initialize the Table reference returned by GroupLDofTable() and then
          call Finalize().
    */
-   GroupCommunicator(const GroupTopology &gt, Mode m = byNeighbor);
+   GroupCommunicator(const GroupTopology &gt, Mode m = GetDefaultMode());
+
+   /** @brief Set the mode used by the GroupCommunicator objects constructed
+       without an explicit mode, e.g. in ParFiniteElementSpace. The default is
+       byNeighbor. */
+   static void SetDefaultMode(Mode m) { default_mode = m; }
+
+   /// Get the mode used when no mode is given to the constructor.
+   static Mode GetDefaultMode() { return default_mode; }
 
    /** @brief Initialize the communicator from a local-dof to group map.
        Finalize() is called internally. */
@@ -329,7 +353,11 @@ public:
                                   int layout, void (*Op)(OpData<T>)) const;
 
    /// Begin a broadcast within each group where the master is the root.
-   /** For a description of @a layout, see CopyGroupToBuffer(). */
+   /** For a description of @a layout, see CopyGroupToBuffer().
+
+       The communication proceeds until BcastEnd() is called, so computations
+       that do not involve the shared entries of @a ldata can be performed in
+       between. */
    template <class T> void BcastBegin(T *ldata, int layout) const;
 
    /** @brief Finalize a broadcast started with BcastBegin().
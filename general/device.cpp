@@ -47,7 +47,7 @@ static const Backend::Id backend_list[Backend::NUM_BACKENDS] =
 {
    Backend::CEED_CUDA, Backend::OCCA_CUDA, Backend::RAJA_CUDA, Backend::CUDA,
    Backend::CEED_HIP, Backend::RAJA_HIP, Backend::HIP, Backend::DEBUG_DEVICE,
-   Backend::OCCA_OMP, Backend::RAJA_OMP, Backend::OMP,
+   Backend::OCCA_OMP, Backend::RAJA_OMP, Backend::OMP, Backend::CPU_THREADS,
    Backend::CEED_CPU, Backend::OCCA_CPU, Backend::RAJA_CPU, Backend::CPU
 };
 
@@ -56,7 +56,7 @@ static const char *backend_name[Backend::NUM_BACKENDS] =
 {
    "ceed-cuda", "occa-cuda", "raja-cuda", "cuda",
    "ceed-hip", "raja-hip", "hip", "debug",
-   "occa-omp", "raja-omp", "omp",
+   "occa-omp", "raja-omp", "omp", "cpu-threads",
    "ceed-cpu", "occa-cpu", "raja-cpu", "cpu"
 };
 
@@ -93,6 +93,12 @@ Device::Device()
          host_mem_type = MemoryType::HOST_64;
          device_mem_type = MemoryType::HOST_64;
       }
+      else if (mem_backend == "hostpool")
+      {
+         mem_host_env = true;
+         host_mem_type = MemoryType::HOST_POOL;
+         device_mem_type = MemoryType::HOST_POOL;
+      }
       else if (mem_backend == "umpire")
       {
          mem_host_env = true;
@@ -221,6 +227,14 @@ void Device::Configure(const std::string &device, const int device_id)
          std::map<std::string, Backend::Id>::iterator it = bmap.find(backend);
          MFEM_VERIFY(it != bmap.end(), "invalid backend name: '" << backend << '\'');
          Get().MarkBackend(it->second);
+         // The 'cpu-threads' option is the number of threads
+         if (it->second == Backend::CPU_THREADS)
+         {
+            const int num_threads = atoi(boption.c_str());
+            MFEM_VERIFY(num_threads > 0, "invalid number of threads: '"
+                        << boption << '\'');
+            ThreadPool::Configure(num_threads);
+         }
       }
       if (end == device.size()) { break; }
       beg = end + 1;
@@ -316,6 +330,10 @@ void Device::Print(std::ostream &os)
       os << "libCEED backend: " << ceed_backend << '\n';
    }
 #endif
+   if (Allows(Backend::CPU_THREADS))
+   {
+      os << "Number of threads: " << ThreadPool::Global().NumThreads() << '\n';
+   }
    os << "Memory configuration: "
       << MemoryTypeName[static_cast<int>(host_mem_type)];
    if (Device::Allows(Backend::DEVICE_MASK))
@@ -594,6 +612,8 @@ void Device::Setup(const int device_id)
       }
    }
    if (Allows(Backend::DEBUG_DEVICE)) { ngpu = 1; }
+   // Start the worker threads now, rather than in the first kernel
+   if (Allows(Backend::CPU_THREADS)) { ThreadPool::Global(); }
 }
 
 } // mfem
@@ -73,7 +73,11 @@ struct Backend
           (using separate host/device memory pools and host <-> device
           transfers) without any GPU hardware. As 'DEBUG' is sometimes used
           as a macro, `_DEVICE` has been added to avoid conflicts. */
-      DEBUG_DEVICE = 1 << 14
+      DEBUG_DEVICE = 1 << 14,
+      /** @brief [host] Native multithreaded backend: a persistent pool of
+          std::thread workers with work-stealing scheduling, see ThreadPool.
+          Always available, does not require MFEM_USE_OPENMP = YES. */
+      CPU_THREADS = 1 << 15
    };
 
    /** @brief Additional useful constants. For example, the *_MASK constants can
@@ -81,7 +85,7 @@ struct Backend
    enum
    {
       /// Number of backends: from (1 << 0) to (1 << (NUM_BACKENDS-1)).
-      NUM_BACKENDS = 15,
+      NUM_BACKENDS = 16,
 
       /// Biwise-OR of all CPU backends
       CPU_MASK = CPU | RAJA_CPU | OCCA_CPU | CEED_CPU,
@@ -202,7 +206,7 @@ public:
        * The current backend priority from highest to lowest is:
          'ceed-cuda', 'occa-cuda', 'raja-cuda', 'cuda',
          'ceed-hip', 'hip', 'debug',
-         'occa-omp', 'raja-omp', 'omp',
+         'occa-omp', 'raja-omp', 'omp', 'cpu-threads',
          'ceed-cpu', 'occa-cpu', 'raja-cpu', 'cpu'.
        * Multiple backends can be configured at the same time.
        * Only one 'occa-*' backend can be configured at a time.
@@ -220,6 +224,9 @@ public:
          and evaluation of operators and enables the 'hip' backend to avoid
          transfers between host and device.
        * The 'debug' backend should not be combined with other device backends.
+       * The backend 'cpu-threads' accepts the number of threads as an option,
+         e.g. 'cpu-threads:16'. Without it, the environment variable
+         MFEM_NUM_THREADS or the number of hardware threads is used.
    */
    void Configure(const std::string &device, const int dev = 0);
 
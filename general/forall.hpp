@@ -18,6 +18,7 @@
 #include "backends.hpp"
 #include "device.hpp"
 #include "mem_manager.hpp"
+#include "threads.hpp"
 #include "../linalg/dtensor.hpp"
 #ifdef MFEM_USE_MPI
 #include <_hypre_utilities.h>
@@ -178,7 +179,8 @@ private:
 #endif
 
 // Implementation of MFEM's "parallel for" (forall) device/host kernel
-// interfaces supporting RAJA, CUDA, OpenMP, and sequential backends.
+// interfaces supporting RAJA, CUDA, OpenMP, std::thread, and sequential
+// backends.
 
 // The MFEM_FORALL wrapper
 #define MFEM_FORALL(i,N,...) \
@@ -730,6 +732,9 @@ inline void ForallWrap(const bool use_dev, const int N,
    if (Device::Allows(Backend::OMP)) { return OmpWrap(N, h_body); }
 #endif
 
+   // If Backend::CPU_THREADS is allowed, use it
+   if (Device::Allows(Backend::CPU_THREADS)) { return ThreadsWrap(N, h_body); }
+
 #ifdef MFEM_USE_RAJA
    // If Backend::RAJA_CPU is allowed, use it
    if (Device::Allows(Backend::RAJA_CPU)) { return RajaSeqWrap(N, h_body); }
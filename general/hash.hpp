@@ -16,7 +16,12 @@
 #include "array.hpp"
 #include "globals.hpp"
 #include <type_traits>
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace mfem
 {
@@ -39,6 +44,25 @@ struct Hashed4
    int next;
 };
 
+namespace internal
+{
+
+/** Return true if the first three ints of the 16-byte arrays @a a and @a b
+    are equal: with SSE2, they are compared with a single vector operation. */
+inline bool HashKeysEqual(const int *a, const int *b)
+{
+#ifdef __SSE2__
+   const __m128i eq =
+      _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)),
+                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(b)));
+   return (_mm_movemask_epi8(eq) & 0xfff) == 0xfff;
+#else
+   return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+#endif
+}
+
+} // namespace internal
+
 
 /** HashTable is a container for items that require associative access through
  *  pairs (or quadruples) of indices:
@@ -72,11 +96,18 @@ struct Hashed4
  *   The data structure and implementation is based on a BlockArray<T> which
  *   provides an efficient item storage that avoids heap fragmentation, and
  *   index-based item access. The hash table implemented on top of the
- *   BlockArray provides fast associative (key -> value) access by grouping
- *   items into bins (buckets) of O(1) size.
+ *   BlockArray provides fast associative (key -> value) access with open
+ *   addressing and linear probing: a probe table stores the keys and the ids
+ *   of the items in contiguous 16-byte slots, so that a lookup usually costs
+ *   a single cache miss and does not access the items themselves. The keys
+ *   are compared with SSE2 instructions when available.
  *   - "id" denotes the index of an item in the underlying BlockArray<T>,
- *   - "idx" denotes the index of a bin, determined by hashing a key with
- *     the function `Hash`.
+ *   - the first slot of the probe sequence of a key is determined by hashing
+ *     the key with the function `Hash`.
+ *
+ *   Deleting an item shifts back the following slots of its probe sequence,
+ *   so the table does not accumulate tombstones. After many deletions (e.g.
+ *   after derefinement), Compact() shrinks the probe table.
  */
 template<typename T>
 class HashTable : public BlockArray<T>
@@ -89,9 +120,12 @@ public:
 
        @param[in] block_size The size of the storage blocks of the underlying
                              BlockArray<T>.
-       @param[in] init_hash_size The initial size of the hash table. Must be
-                                 a power of 2. */
-   HashTable(int block_size = 16*1024, int init_hash_size = 32*1024);
+       @param[in] init_hash_size The initial number of slots of the probe
+                                 table. Must be a power of 2. The default
+                                 8K slots of 16 bytes use the same 128 KB as
+                                 the former 32K-bin table of ints; the table
+                                 grows as needed. */
+   HashTable(int block_size = 16*1024, int init_hash_size = 8*1024);
    /// @brief Deep copy
    HashTable(const HashTable& other);
    /// @brief Copy assignment not supported
@@ -218,6 +252,23 @@ public:
        @warning This method should only be called if T inherits from Hashed4. */
    int FindId(int p1, int p2, int p3, int p4 = -1) const;
 
+   /** @brief Bulk version of GetId(): get the ids of the items with the keys
+       in @a keys, creating the items that do not exist.
+
+       @param[in] keys The keys: 2 entries per key (p1, p2) if T inherits from
+                       Hashed2, 4 entries per key (p1, p2, p3, p4) with an
+                       optional p4 = -1 if T inherits from Hashed4.
+       @param[out] ids The ids of the items, one per key.
+
+       The keys are processed in batches, hashing and prefetching the probe
+       sequences of a whole batch first, so that the cache misses of the
+       lookups overlap. */
+   void GetIds(const Array<int> &keys, Array<int> &ids);
+
+   /** @brief Bulk version of FindId(): find the ids of the items with the
+       keys in @a keys (see GetIds()), or -1 for the keys that do not exist. */
+   void FindIds(const Array<int> &keys, Array<int> &ids) const;
+
    /// @brief Return the number of elements currently stored in the HashTable.
    int Size() const { return Base::Size() - unused.Size(); }
 
@@ -244,6 +295,12 @@ public:
    /// @brief Remove all items.
    void DeleteAll();
 
+   /** @brief Shrink the probe table to fit the current number of items.
+
+       The ids of the items are not changed. This can be called after a large
+       number of items have been deleted, e.g. after derefinement. */
+   void Compact();
+
    /** @brief Allocate an item at 'id'. Enlarge the underlying BlockArray if
        necessary.
 
@@ -252,7 +309,8 @@ public:
        @param[in] p2 Second part of the key.
 
        @warning This is a special purpose method used when loading data from a
-       file. Does nothing if the slot 'id' has already been allocated. */
+       file. Does nothing if the slot 'id' has already been allocated. Aborts
+       if another item already has the key (p1, p2). */
    void Alloc(int id, int p1, int p2);
 
    /** @brief Reinitialize the internal list of unallocated items.
@@ -268,6 +326,8 @@ public:
        @param[in] new_p1 First part of the new key.
        @param[in] new_p2 Second part of the new key.
 
+       Aborts if another item already has the new key.
+
        @warning This method should only be called if T inherits from Hashed2. */
    void Reparent(int id, int new_p1, int new_p2);
 
@@ -281,6 +341,8 @@ public:
        @param[in] new_p3 Third part of the new key.
        @param[in] new_p4 Fourth part of the new key (optional).
 
+       Aborts if another item already has the new key.
+
        @warning This method should only be called if T inherits from Hashed4. */
    void Reparent(int id, int new_p1, int new_p2, int new_p3, int new_p4 = -1);
 
@@ -290,7 +352,7 @@ public:
    /// @brief Write details of the memory usage to the mfem output stream.
    void PrintMemoryDetail() const;
 
-   /// @brief Print a histogram of bin sizes for debugging purposes.
+   /// @brief Print a histogram of probe lengths for debugging purposes.
    void PrintStats() const;
 
    class iterator : public Base::iterator
@@ -342,114 +404,107 @@ public:
    const_iterator cend() const { return const_iterator(); }
 
 protected:
-   /** The hash table: each bin is a linked list of items. For each non-empty
-       bin, this arrays stores the 'id' of the first item in the list, or -1
-       if the bin is empty. */
-   int* table;
-
-   /** mask = table_size-1. Used for fast modulo operation in Hash(), to wrap
-       the raw hashed index around the current table size (which must be a power
-       of two). */
+   /** A slot of the probe table: the key of an item, with sorted parts
+       (p3 = -1 for Hashed2 items), and its id, or -1 for an empty slot. The
+       slot is 16 bytes, so that the keys can be compared as a vector. */
+   struct Slot
+   {
+      int p1, p2, p3;
+      int id;
+   };
+
+   /// The probe table.
+   Slot *slots;
+
+   /** mask = table_size-1. Used for fast modulo operation, to wrap the slot
+       index around the current table size (which must be a power of two). */
    int mask;
 
+   /// Number of used slots in the probe table.
+   int num_slots_used;
+
    /** List of deleted items in the BlockArray<T>. New items are created with
        these ids first, before they are appended to the block array. */
    Array<int> unused;
 
-   /** @brief hash function for Hashed2 items.
-
-       @param[in] p1 First part of the key.
-       @param[in] p2 Second part of the key.
-       @return The hash key "idx" identifying a bin/bucket.
-
-       NOTE: the constants are arbitrary
-       @warning This method should only be called if T inherits from Hashed2. */
-   inline int Hash(size_t p1, size_t p2) const
-   { return (984120265ul*p1 + 125965121ul*p2) & mask; }
-
-   /** @brief hash function for Hashed4 items.
-
-       @param[in] p1 First part of the key.
-       @param[in] p2 Second part of the key.
-       @param[in] p3 Third part of the key.
-       @return The hash key "idx" identifying a bin/bucket.
-
-       NOTE: The constants are arbitrary.
-       NOTE: p4 is not hashed nor stored as p1, p2, p3 identify a face uniquely.
-       @warning This method should only be called if T inherits from Hashed4. */
-   inline int Hash(size_t p1, size_t p2, size_t p3) const
-   { return (984120265ul*p1 + 125965121ul*p2 + 495698413ul*p3) & mask; }
-
-   // Delete() and Reparent() use one of these:
-   /// @brief Hash function for items of type T that inherit from Hashed2.
-   inline int Hash(const Hashed2& item) const
-   { return Hash(item.p1, item.p2); }
-
-   /// @brief Hash function for items of type T that inherit from Hashed4.
-   inline int Hash(const Hashed4& item) const
-   { return Hash(item.p1, item.p2, item.p3); }
-
-   /** @brief Search the index of the item associated to the key (p1,p2)
-       starting from the item with index @a id.
-
-       @param[in] id Index of the item in the underlying BlockArray<T>.
-       @param[in] p1 First part of the key.
-       @param[in] p2 Second part of the key.
-       @return The index "id" of the key in the BlockArray<T>.
+   /// @brief Return the slot with key (p1,p2), with sorted parts.
+   static inline Slot MakeKey(int p1, int p2)
+   {
+      if (p1 > p2) { std::swap(p1, p2); }
+      return Slot{p1, p2, -1, 0};
+   }
 
-       @warning This method should only be called if T inherits from Hashed2. */
-   int SearchList(int id, int p1, int p2) const;
+   /// @brief Return the slot with key (p1,p2,p3,p4), with sorted parts.
+   /** NOTE: p4 is not hashed nor stored as p1, p2, p3 identify a face
+       uniquely. */
+   static inline Slot MakeKey(int p1, int p2, int p3, int p4);
 
-   /** @brief Search the index of the item associated to the key (p1,p2,p3,(p4))
-       starting from the item with index @a id.
+   /// @brief Return the key of an item of type T that inherits from Hashed2.
+   static inline Slot ItemKey(const Hashed2 &item)
+   { return Slot{item.p1, item.p2, -1, 0}; }
 
-       @param[in] id Index of the item in the underlying BlockArray<T>.
-       @param[in] p1 First part of the key.
-       @param[in] p2 Second part of the key.
-       @param[in] p3 Third part of the key.
-       @return The index "id" of the key in the BlockArray<T>.
+   /// @brief Return the key of an item of type T that inherits from Hashed4.
+   static inline Slot ItemKey(const Hashed4 &item)
+   { return Slot{item.p1, item.p2, item.p3, 0}; }
 
-       @warning This method should only be called if T inherits from Hashed4. */
-   int SearchList(int id, int p1, int p2, int p3) const;
+   /// @brief Set the key of an item of type T that inherits from Hashed2.
+   static inline void SetItemKey(Hashed2 &item, const Slot &k)
+   { item.p1 = k.p1; item.p2 = k.p2; }
 
-   /** @brief Insert the item 'id' into bin 'idx'.
+   /// @brief Set the key of an item of type T that inherits from Hashed4.
+   static inline void SetItemKey(Hashed4 &item, const Slot &k)
+   { item.p1 = k.p1; item.p2 = k.p2; item.p3 = k.p3; }
 
-       @param[in] idx The bin/bucket index.
-       @param[in] id The index of the item in the BlockArray<T>.
-       @param[in] item The item to insert at the beginning of the linked list.
+   /** @brief Hash function, mapping the key @a k to the first slot of its
+       probe sequence.
 
-       @warning The method only works with bin 'idx' and does not check the
-                overall fill factor of the hash table. If appropriate,
-                use CheckRehash() for that. */
-   inline void Insert(int idx, int id, T &item);
+       NOTE: the constants are arbitrary. The final multiplication mixes all
+       the bits of the key into the high bits of the result. */
+   inline int Hash(const Slot &k) const
+   {
+      const std::uint64_t h = 984120265ull*std::uint32_t(k.p1) +
+                              125965121ull*std::uint32_t(k.p2) +
+                              495698413ull*std::uint32_t(k.p3);
+      return int((h * 0x9e3779b97f4a7c15ull) >> 32) & mask;
+   }
 
-   /** @brief Unlink an item @a id from the linked list of bin @a idx.
+   /** @brief Search the key @a k in the probe sequence starting at slot
+       @a i. Return true if the key is found, with @a i set to its slot;
+       otherwise, @a i is set to the empty slot ending the probe sequence. */
+   inline bool Probe(const Slot &k, int &i) const;
 
-       @param[in] idx The bin/bucket index.
-       @param[in] id The index of the item in the BlockArray<T>.
+   /** @brief Insert the item @a id with key @a k in the probe table at the
+       empty slot @a i, returned by Probe(). The table is grown if necessary.
+       */
+   inline void Insert(const Slot &k, int i, int id);
 
-       @warning The method aborts if the item is not found. */
-   void Unlink(int idx, int id);
+   /** @brief Remove the key @a k of item @a id from the probe table.
 
-   /** @brief Check table fill factor and resize if necessary.
+       The following slots of the probe sequence are shifted back, so that
+       no tombstones are needed. The method aborts if the key is not found. */
+   void Unlink(const Slot &k, int id);
 
-       The method checks the average size of the bins (i.e., the fill factor).
-       If the fill factor is > 2, the table is enlarged (see DoRehash()). */
-   inline void CheckRehash();
+   /** @brief Return the id of a new item with key @a k, to be inserted in
+       the probe table at slot @a i (the end of its probe sequence). */
+   inline int NewItem(const Slot &k, int i);
 
-   /** @brief Double the size of the hash table (i.e., double the number of bins)
-       and reinsert all items into the new bins.
+   /** @brief Sort and hash the keys of the batch of keys starting at key
+       @a b (see GetIds()) and prefetch the start of their probe sequences.
+       Return the number of keys in the batch. */
+   inline int HashBatch(const Array<int> &keys, int b, Slot *k,
+                        int *start) const;
 
-       NOTE: Rehashing is computationally expensive (O(N) in the number of items),
-       but since it is only done rarely (when the number of items doubles),
-       the amortized complexity of inserting an item is still O(1). */
-   void DoRehash();
+   /** @brief Resize the probe table to @a new_size slots (a power of two) and
+       reinsert all keys.
 
-   /** @brief Return the size of the bin "idx".
+       NOTE: Rehashing is computationally expensive (O(N) in the number of
+       items), but since it is only done rarely (when the number of items
+       doubles), the amortized complexity of inserting an item is still O(1).
+       */
+   void DoRehash(int new_size);
 
-       @param[in] idx The index of the bin.
-       @return The size of the bin. */
-   int BinSize(int idx) const;
+   /// @brief Return the distance of slot @a i from the start of its probe.
+   int ProbeLength(int i) const { return (i - Hash(slots[i])) & mask; }
 };
 
 
@@ -540,27 +595,25 @@ HashTable<T>::HashTable(int block_size, int init_hash_size)
    mask = init_hash_size-1;
    MFEM_VERIFY(!(init_hash_size & mask), "init_size must be a power of two.");
 
-   table = new int[init_hash_size];
-   for (int i = 0; i < init_hash_size; i++)
-   {
-      table[i] = -1;
-   }
+   slots = new Slot[init_hash_size];
+   for (int i = 0; i < init_hash_size; i++) { slots[i].id = -1; }
+   num_slots_used = 0;
 }
 
 template<typename T>
 HashTable<T>::HashTable(const HashTable& other)
-   : Base(other), mask(other.mask)
+   : Base(other), mask(other.mask), num_slots_used(other.num_slots_used)
 {
    int size = mask+1;
-   table = new int[size];
-   memcpy(table, other.table, size*sizeof(int));
+   slots = new Slot[size];
+   memcpy(slots, other.slots, size*sizeof(Slot));
    other.unused.Copy(unused);
 }
 
 template<typename T>
 HashTable<T>::~HashTable()
 {
-   delete [] table;
+   delete [] slots;
 }
 
 namespace internal
@@ -593,61 +646,110 @@ inline void sort4_ext(int &a, int &b, int &c, int &d)
    }
 }
 
+// Number of keys whose probe sequences are prefetched ahead in the bulk
+// HashTable operations.
+enum { hash_batch_size = 16 };
+
+inline void HashPrefetch(const void *p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   __builtin_prefetch(p);
+#else
+   (void) p;
+#endif
+}
+
 } // internal
 
 template<typename T>
-inline T* HashTable<T>::Get(int p1, int p2)
+inline typename HashTable<T>::Slot
+HashTable<T>::MakeKey(int p1, int p2, int p3, int p4)
 {
-   return &(Base::At(GetId(p1, p2)));
+   internal::sort4_ext(p1, p2, p3, p4);
+   return Slot{p1, p2, p3, 0};
 }
 
 template<typename T>
-inline T* HashTable<T>::Get(int p1, int p2, int p3, int p4)
+inline bool HashTable<T>::Probe(const Slot &k, int &i) const
 {
-   return &(Base::At(GetId(p1, p2, p3, p4)));
+   // linear probing: the probe sequence is contiguous in memory
+   for ( ; slots[i].id >= 0; i = (i+1) & mask)
+   {
+      if (internal::HashKeysEqual(&slots[i].p1, &k.p1)) { return true; }
+   }
+   return false;
 }
 
 template<typename T>
-int HashTable<T>::GetId(int p1, int p2)
+inline void HashTable<T>::Insert(const Slot &k, int i, int id)
 {
-   // search for the item in the hashtable
-   if (p1 > p2) { std::swap(p1, p2); }
-   int idx = Hash(p1, p2);
-   int id = SearchList(table[idx], p1, p2);
-   if (id >= 0) { return id; }
-
-   // not found - use an unused item or create a new one
-   int new_id;
-   if (unused.Size())
+   // Grow the table when it is 3/4 full, so that the probe sequences stay
+   // short.
+   if (4*(num_slots_used + 1) > 3*(mask+1))
    {
-      new_id = unused.Last();
-      unused.DeleteLast();
+      DoRehash(2*(mask+1));
+      i = Hash(k);
+      Probe(k, i);
    }
-   else
+   slots[i] = k;
+   slots[i].id = id;
+   num_slots_used++;
+}
+
+template<typename T>
+void HashTable<T>::Unlink(const Slot &k, int id)
+{
+   int i = Hash(k);
+   MFEM_VERIFY(Probe(k, i) && slots[i].id == id,
+               "HashTable<>::Unlink: item not found!");
+
+   // backward-shift deletion: move back the following slots of the cluster
+   // whose probe sequences pass through the freed slot
+   for (int j = (i+1) & mask; slots[j].id >= 0; j = (j+1) & mask)
    {
-      new_id = Base::Append();
+      const int start = Hash(slots[j]);
+      const bool stays = (i <= j) ? (i < start && start <= j)
+                         /*    */ : (i < start || start <= j);
+      if (!stays)
+      {
+         slots[i] = slots[j];
+         i = j;
+      }
    }
-   T& item = Base::At(new_id);
-   item.p1 = p1;
-   item.p2 = p2;
+   slots[i].id = -1;
+   num_slots_used--;
+}
 
-   // insert into hashtable
-   Insert(idx, new_id, item);
-   CheckRehash();
+template<typename T>
+void HashTable<T>::DoRehash(int new_size)
+{
+   Slot *old_slots = slots;
+   const int old_size = mask+1;
 
-   return new_id;
+   slots = new Slot[new_size];
+   for (int i = 0; i < new_size; i++) { slots[i].id = -1; }
+   mask = new_size-1;
+
+#if defined(MFEM_DEBUG) && !defined(MFEM_USE_MPI)
+   mfem::out << _MFEM_FUNC_NAME << ": rehashing to size " << new_size
+             << std::endl;
+#endif
+
+   // reinsert all keys
+   for (int j = 0; j < old_size; j++)
+   {
+      if (old_slots[j].id < 0) { continue; }
+      int i = Hash(old_slots[j]);
+      while (slots[i].id >= 0) { i = (i+1) & mask; }
+      slots[i] = old_slots[j];
+   }
+   delete [] old_slots;
 }
 
 template<typename T>
-int HashTable<T>::GetId(int p1, int p2, int p3, int p4)
+inline int HashTable<T>::NewItem(const Slot &k, int i)
 {
-   // search for the item in the hashtable
-   internal::sort4_ext(p1, p2, p3, p4);
-   int idx = Hash(p1, p2, p3);
-   int id = SearchList(table[idx], p1, p2, p3);
-   if (id >= 0) { return id; }
-
-   // not found - use an unused item or create a new one
+   // use an unused item or create a new one
    int new_id;
    if (unused.Size())
    {
@@ -659,17 +761,44 @@ int HashTable<T>::GetId(int p1, int p2, int p3, int p4)
       new_id = Base::Append();
    }
    T& item = Base::At(new_id);
-   item.p1 = p1;
-   item.p2 = p2;
-   item.p3 = p3;
+   SetItemKey(item, k);
+   item.next = -1;
 
    // insert into hashtable
-   Insert(idx, new_id, item);
-   CheckRehash();
-
+   Insert(k, i, new_id);
    return new_id;
 }
 
+template<typename T>
+inline T* HashTable<T>::Get(int p1, int p2)
+{
+   return &(Base::At(GetId(p1, p2)));
+}
+
+template<typename T>
+inline T* HashTable<T>::Get(int p1, int p2, int p3, int p4)
+{
+   return &(Base::At(GetId(p1, p2, p3, p4)));
+}
+
+template<typename T>
+int HashTable<T>::GetId(int p1, int p2)
+{
+   // search for the item in the hashtable
+   const Slot k = MakeKey(p1, p2);
+   int i = Hash(k);
+   return Probe(k, i) ? slots[i].id : NewItem(k, i);
+}
+
+template<typename T>
+int HashTable<T>::GetId(int p1, int p2, int p3, int p4)
+{
+   // search for the item in the hashtable
+   const Slot k = MakeKey(p1, p2, p3, p4);
+   int i = Hash(k);
+   return Probe(k, i) ? slots[i].id : NewItem(k, i);
+}
+
 template<typename T>
 inline T* HashTable<T>::Find(int p1, int p2)
 {
@@ -701,107 +830,84 @@ inline const T* HashTable<T>::Find(int p1, int p2, int p3, int p4) const
 template<typename T>
 int HashTable<T>::FindId(int p1, int p2) const
 {
-   if (p1 > p2) { std::swap(p1, p2); }
-   return SearchList(table[Hash(p1, p2)], p1, p2);
+   const Slot k = MakeKey(p1, p2);
+   int i = Hash(k);
+   return Probe(k, i) ? slots[i].id : -1;
 }
 
 template<typename T>
 int HashTable<T>::FindId(int p1, int p2, int p3, int p4) const
 {
-   internal::sort4_ext(p1, p2, p3, p4);
-   return SearchList(table[Hash(p1, p2, p3)], p1, p2, p3);
-}
-
-template<typename T>
-int HashTable<T>::SearchList(int id, int p1, int p2) const
-{
-   while (id >= 0)
-   {
-      const T& item = Base::At(id);
-      if (item.p1 == p1 && item.p2 == p2) { return id; }
-      id = item.next;
-   }
-   return -1;
-}
-
-template<typename T>
-int HashTable<T>::SearchList(int id, int p1, int p2, int p3) const
-{
-   while (id >= 0)
-   {
-      const T& item = Base::At(id);
-      if (item.p1 == p1 && item.p2 == p2 && item.p3 == p3) { return id; }
-      id = item.next;
-   }
-   return -1;
+   const Slot k = MakeKey(p1, p2, p3, p4);
+   int i = Hash(k);
+   return Probe(k, i) ? slots[i].id : -1;
 }
 
 template<typename T>
-inline void HashTable<T>::CheckRehash()
+inline int HashTable<T>::HashBatch(const Array<int> &keys, int b, Slot *k,
+                                   int *start) const
 {
-   const int fill_factor = 2;
-
-   // is the table overfull?
-   if (Base::Size() > (mask+1) * fill_factor)
+   const bool hashed4 = std::is_base_of<Hashed4, T>::value;
+   const int stride = hashed4 ? 4 : 2;
+   const int nb = std::min(int(internal::hash_batch_size),
+                           keys.Size()/stride - b);
+   for (int j = 0; j < nb; j++)
    {
-      DoRehash();
+      const int *p = keys.GetData() + stride*(b + j);
+      k[j] = hashed4 ? MakeKey(p[0], p[1], p[2], p[3]) : MakeKey(p[0], p[1]);
+      start[j] = Hash(k[j]);
+      internal::HashPrefetch(slots + start[j]);
    }
+   return nb;
 }
 
 template<typename T>
-void HashTable<T>::DoRehash()
+void HashTable<T>::GetIds(const Array<int> &keys, Array<int> &ids)
 {
-   delete [] table;
-
-   // double the table size
-   int new_table_size = 2*(mask+1);
-   table = new int[new_table_size];
-   for (int i = 0; i < new_table_size; i++) { table[i] = -1; }
-   mask = new_table_size-1;
-
-#if defined(MFEM_DEBUG) && !defined(MFEM_USE_MPI)
-   mfem::out << _MFEM_FUNC_NAME << ": rehashing to size " << new_table_size
-             << std::endl;
-#endif
+   const int stride = std::is_base_of<Hashed4, T>::value ? 4 : 2;
+   MFEM_VERIFY(keys.Size() % stride == 0, "invalid size of the key array");
+   ids.SetSize(keys.Size() / stride);
 
-   // reinsert all items
-   for (iterator it = begin(); it != end(); ++it)
+   Slot k[internal::hash_batch_size];
+   int start[internal::hash_batch_size];
+   for (int b = 0; b < ids.Size(); b += internal::hash_batch_size)
    {
-      Insert(Hash(*it), it.index(), *it);
+      const int batch_mask = mask;
+      const int nb = HashBatch(keys, b, k, start);
+      for (int j = 0; j < nb; j++)
+      {
+         // the table may have been resized by the previous insertions
+         int i = (mask == batch_mask) ? start[j] : Hash(k[j]);
+         ids[b + j] = Probe(k[j], i) ? slots[i].id : NewItem(k[j], i);
+      }
    }
 }
 
 template<typename T>
-inline void HashTable<T>::Insert(int idx, int id, T &item)
+void HashTable<T>::FindIds(const Array<int> &keys, Array<int> &ids) const
 {
-   // add item at the beginning of the linked list
-   item.next = table[idx];
-   table[idx] = id;
-}
+   const int stride = std::is_base_of<Hashed4, T>::value ? 4 : 2;
+   MFEM_VERIFY(keys.Size() % stride == 0, "invalid size of the key array");
+   ids.SetSize(keys.Size() / stride);
 
-template<typename T>
-void HashTable<T>::Unlink(int idx, int id)
-{
-   // remove item from the linked list
-   int* p_id = table + idx;
-   while (*p_id >= 0)
+   Slot k[internal::hash_batch_size];
+   int start[internal::hash_batch_size];
+   for (int b = 0; b < ids.Size(); b += internal::hash_batch_size)
    {
-      T& item = Base::At(*p_id);
-      if (*p_id == id)
+      const int nb = HashBatch(keys, b, k, start);
+      for (int j = 0; j < nb; j++)
       {
-         *p_id = item.next;
-         return;
+         int i = start[j];
+         ids[b + j] = Probe(k[j], i) ? slots[i].id : -1;
       }
-      p_id = &(item.next);
    }
-   MFEM_ABORT("HashTable<>::Unlink: item not found!");
 }
 
 template<typename T>
 void HashTable<T>::Delete(int id)
 {
    T& item = Base::At(id);
-   Unlink(Hash(item), id);
+   Unlink(ItemKey(item), id);
    item.next = -2;    // mark item as unused
    unused.Append(id); // add its id to the unused ids
 }
@@ -810,10 +916,20 @@ template<typename T>
 void HashTable<T>::DeleteAll()
 {
    Base::DeleteAll();
-   for (int i = 0; i <= mask; i++) { table[i] = -1; }
+   for (int i = 0; i <= mask; i++) { slots[i].id = -1; }
+   num_slots_used = 0;
    unused.DeleteAll();
 }
 
+template<typename T>
+void HashTable<T>::Compact()
+{
+   // the smallest table that is at most half full
+   int new_size = 32;
+   while (new_size < 2*num_slots_used) { new_size *= 2; }
+   if (new_size < mask+1) { DoRehash(new_size); }
+}
+
 template<typename T>
 void HashTable<T>::Alloc(int id, int p1, int p2)
 {
@@ -826,12 +942,15 @@ void HashTable<T>::Alloc(int id, int p1, int p2)
    T& item = Base::At(id);
    if (item.next == -2)
    {
+      const Slot k = MakeKey(p1, p2);
       item.next = -1;
       item.p1 = p1;
       item.p2 = p2;
 
-      Insert(Hash(p1, p2), id, item);
-      CheckRehash();
+      int i = Hash(k);
+      MFEM_VERIFY(!Probe(k, i), "HashTable<>::Alloc: an item with the key ("
+                  << p1 << ", " << p2 << ") already exists!");
+      Insert(k, i, id);
    }
 }
 
@@ -849,15 +968,15 @@ template<typename T>
 void HashTable<T>::Reparent(int id, int new_p1, int new_p2)
 {
    T& item = Base::At(id);
-   Unlink(Hash(item), id);
-
-   if (new_p1 > new_p2) { std::swap(new_p1, new_p2); }
-   item.p1 = new_p1;
-   item.p2 = new_p2;
+   Unlink(ItemKey(item), id);
 
    // reinsert under new parent IDs
-   int new_idx = Hash(new_p1, new_p2);
-   Insert(new_idx, id, item);
+   const Slot k = MakeKey(new_p1, new_p2);
+   SetItemKey(item, k);
+   int i = Hash(k);
+   MFEM_VERIFY(!Probe(k, i), "HashTable<>::Reparent: an item with the new "
+               "key already exists!");
+   Insert(k, i, id);
 }
 
 template<typename T>
@@ -865,45 +984,30 @@ void HashTable<T>::Reparent(int id,
                             int new_p1, int new_p2, int new_p3, int new_p4)
 {
    T& item = Base::At(id);
-   Unlink(Hash(item), id);
-
-   internal::sort4_ext(new_p1, new_p2, new_p3, new_p4);
-   item.p1 = new_p1;
-   item.p2 = new_p2;
-   item.p3 = new_p3;
+   Unlink(ItemKey(item), id);
 
    // reinsert under new parent IDs
-   int new_idx = Hash(new_p1, new_p2, new_p3);
-   Insert(new_idx, id, item);
+   const Slot k = MakeKey(new_p1, new_p2, new_p3, new_p4);
+   SetItemKey(item, k);
+   int i = Hash(k);
+   MFEM_VERIFY(!Probe(k, i), "HashTable<>::Reparent: an item with the new "
+               "key already exists!");
+   Insert(k, i, id);
 }
 
 template<typename T>
 std::size_t HashTable<T>::MemoryUsage() const
 {
-   return (mask+1) * sizeof(int) + Base::MemoryUsage() + unused.MemoryUsage();
+   return (mask+1) * sizeof(Slot) + Base::MemoryUsage() + unused.MemoryUsage();
 }
 
 template<typename T>
 void HashTable<T>::PrintMemoryDetail() const
 {
-   mfem::out << Base::MemoryUsage() << " + " << (mask+1) * sizeof(int)
+   mfem::out << Base::MemoryUsage() << " + " << (mask+1) * sizeof(Slot)
              << " + " << unused.MemoryUsage();
 }
 
-template<typename T>
-int HashTable<T>::BinSize(int idx) const
-{
-   int count = 0;
-   int id = table[idx];
-   while (id >= 0)
-   {
-      const T& item = Base::At(id);
-      id = item.next;
-      count++;
-   }
-   return count;
-}
-
 template<typename T>
 void HashTable<T>::PrintStats() const
 {
@@ -919,16 +1023,17 @@ void HashTable<T>::PrintStats() const
 
    for (int i = 0; i < table_size; i++)
    {
-      int bs = BinSize(i);
-      if (bs >= H) { bs = H-1; }
-      hist[bs]++;
+      if (slots[i].id < 0) { continue; }
+      int pl = ProbeLength(i);
+      if (pl >= H) { pl = H-1; }
+      hist[pl]++;
    }
 
-   mfem::out << "Bin size histogram:\n";
+   mfem::out << "Probe length histogram:\n";
    for (int i = 0; i < H; i++)
    {
-      mfem::out << "  size " << i << ": "
-                << hist[i] << " bins" << std::endl;
+      mfem::out << "  length " << i << ": "
+                << hist[i] << " items" << std::endl;
    }
 }
 
@@ -0,0 +1,400 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "jit.hpp"
+#include "globals.hpp"
+#include "error.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+// The compiled code runs on the host only.
+#if (defined(__unix__) || defined(__APPLE__)) && \
+    !defined(MFEM_USE_CUDA) && !defined(MFEM_USE_HIP)
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define MFEM_JIT_ENVIRON (*_NSGetEnviron())
+#else
+extern char **environ;
+#define MFEM_JIT_ENVIRON environ
+#endif
+#define MFEM_JIT_SUPPORTED
+#endif
+
+namespace mfem
+{
+
+namespace internal
+{
+
+static bool JitEnv()
+{
+   const char *env = GetEnv("MFEM_JIT");
+   return env && *env && std::string(env) != "NO";
+}
+
+static std::string JitEnv(const char *name, const char *default_value)
+{
+   const char *env = GetEnv(name);
+   return (env && *env) ? env : default_value;
+}
+
+// Append the words of @a str, separated by white space, to @a args.
+static void JitSplit(const std::string &str, std::vector<std::string> &args)
+{
+   std::istringstream words(str);
+   for (std::string w; words >> w; ) { args.push_back(w); }
+}
+
+// The compiler and its arguments, without the input and output files.
+static std::vector<std::string> JitArgs()
+{
+   std::vector<std::string> args;
+   JitSplit(JitEnv("MFEM_JIT_CXX", "c++"), args);
+   JitSplit(JitEnv("MFEM_JIT_FLAGS", "-O3 -std=c++11"), args);
+   args.push_back("-fPIC");
+   args.push_back("-shared");
+#ifdef MFEM_CONFIG_FILE
+   args.push_back(std::string("-DMFEM_CONFIG_FILE=\"") + MFEM_CONFIG_FILE + '"');
+#endif
+   // MFEM_JIT_SOURCE_DIR and MFEM_JIT_INSTALL_DIR are private definitions of
+   // the build system, set only when compiling this file.
+#ifdef MFEM_JIT_SOURCE_DIR
+   args.push_back(std::string("-I") + MFEM_JIT_SOURCE_DIR);
+#endif
+#ifdef MFEM_JIT_INSTALL_DIR
+   args.push_back(std::string("-I") + MFEM_JIT_INSTALL_DIR + "/include");
+   args.push_back(std::string("-I") + MFEM_JIT_INSTALL_DIR + "/include/mfem");
+#endif
+   return args;
+}
+
+// 64-bit FNV-1a hash: unlike std::hash, it does not change between runs and
+// standard libraries, so it can be used to name the cached files.
+static std::string JitHash(const std::string &str)
+{
+   std::uint64_t h = 0xcbf29ce484222325ull;
+   for (unsigned char c : str) { h = (h ^ c) * 0x100000001b3ull; }
+   char buf[17];
+   std::snprintf(buf, sizeof(buf), "%016llx", (unsigned long long) h);
+   return buf;
+}
+
+#ifdef MFEM_JIT_SUPPORTED
+
+static std::string ReadFile(const std::string &path)
+{
+   std::ifstream ifs(path);
+   std::ostringstream contents;
+   contents << ifs.rdbuf();
+   return contents.str();
+}
+
+// The MFEM version and configuration, part of the key of the cached files: a
+// shared object compiled for another build of MFEM is not reused.
+static std::string JitBuildId()
+{
+   std::ostringstream id;
+   id << "MFEM_VERSION " << MFEM_VERSION << '\n';
+#ifdef MFEM_GIT_STRING
+   id << "MFEM_GIT_STRING " << MFEM_GIT_STRING << '\n';
+#endif
+#if defined(MFEM_CONFIG_FILE)
+   id << ReadFile(MFEM_CONFIG_FILE);
+#elif defined(MFEM_JIT_SOURCE_DIR)
+   id << ReadFile(MFEM_JIT_SOURCE_DIR "/config/_config.hpp");
+#endif
+   return id.str();
+}
+
+static bool FileExists(const std::string &path)
+{
+   struct stat st;
+   return stat(path.c_str(), &st) == 0;
+}
+
+// The modification time of the file @a path in nanoseconds, or -1 if the file
+// does not exist.
+static long long ModificationTime(const std::string &path)
+{
+   struct stat st;
+   if (stat(path.c_str(), &st) != 0) { return -1; }
+#ifdef __APPLE__
+   const struct timespec &t = st.st_mtimespec;
+#else
+   const struct timespec &t = st.st_mtim;
+#endif
+   return t.tv_sec*1000000000LL + t.tv_nsec;
+}
+
+// Return true if the shared object @a so exists and is newer than all the
+// files it was compiled from, listed in the dependency file @a deps written by
+// the compiler, in the make format "target: source header1 header2 ...".
+static bool IsUpToDate(const std::string &so, const std::string &deps)
+{
+   const long long so_time = ModificationTime(so);
+   if (so_time < 0) { return false; }
+
+   const std::string contents = ReadFile(deps);
+   size_t pos = contents.find(": ");
+   if (pos == std::string::npos) { return false; }
+   std::vector<std::string> files;
+   std::string file;
+   for (pos += 2; pos <= contents.size(); pos++)
+   {
+      const char c = (pos < contents.size()) ? contents[pos] : '\n';
+      if (c == '\\' && pos + 1 < contents.size())
+      {
+         // Escaped space in a file name, or line continuation
+         if (contents[++pos] != '\n') { file += contents[pos]; }
+      }
+      else if (!std::isspace(static_cast<unsigned char>(c))) { file += c; }
+      else if (!file.empty()) { files.push_back(file); file.clear(); }
+   }
+   // The first file is the temporary source, which was removed.
+   if (files.empty()) { return false; }
+   for (size_t i = 1; i < files.size(); i++)
+   {
+      const long long time = ModificationTime(files[i]);
+      if (time < 0 || time > so_time) { return false; }
+   }
+   return true;
+}
+
+// Create the directory @a dir and its parents, if they do not exist.
+static void MakeDirectory(const std::string &dir)
+{
+   for (size_t pos = dir.find('/', 1); ; pos = dir.find('/', pos + 1))
+   {
+      const std::string sub = dir.substr(0, pos);
+      if (!FileExists(sub)) { mkdir(sub.c_str(), 0755); }
+      if (pos == std::string::npos) { break; }
+   }
+}
+
+// Run @a args without a shell, with the standard output and error redirected
+// to the file @a log. Return true if the command exits with status 0, and set
+// @a error otherwise.
+static bool Run(const std::vector<std::string> &args, const std::string &log,
+                std::string &error)
+{
+   std::vector<char*> argv;
+   for (const std::string &a : args)
+   {
+      argv.push_back(const_cast<char*>(a.c_str()));
+   }
+   argv.push_back(nullptr);
+
+   posix_spawn_file_actions_t actions;
+   posix_spawn_file_actions_init(&actions);
+   posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, log.c_str(),
+                                    O_WRONLY | O_CREAT | O_TRUNC, 0644);
+   posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+   pid_t pid;
+   const int err = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(),
+                                MFEM_JIT_ENVIRON);
+   posix_spawn_file_actions_destroy(&actions);
+   if (err != 0)
+   {
+      error = std::string("cannot execute ") + args[0] + ": " + strerror(err);
+      return false;
+   }
+   int status;
+   while (waitpid(pid, &status, 0) < 0)
+   {
+      if (errno != EINTR) { error = strerror(errno); return false; }
+   }
+   if (WIFEXITED(status) && WEXITSTATUS(status) == 0) { return true; }
+   // The shell convention for a command that could not be executed.
+   error = (WIFEXITED(status) && WEXITSTATUS(status) == 127) ?
+           "cannot execute " + args[0] : "the compiler failed";
+   return false;
+}
+
+class Jit
+{
+public:
+   std::mutex mtx;
+   // Loaded symbols (nullptr for failures), by hash of the source and symbol.
+   std::map<std::string, void*> symbols;
+   // The cache directory set with JitCompiler::SetCacheDirectory().
+   std::string cache_dir;
+
+   static Jit &Instance()
+   {
+      static Jit instance;
+      return instance;
+   }
+
+   // Compile @a source into the shared object @a so, return true on success.
+   // The temporary files are removed in all cases.
+   bool Compile(const std::string &source, const std::vector<std::string> &args,
+                const std::string &dir, const std::string &hash,
+                const std::string &so)
+   {
+      MakeDirectory(dir);
+      // Use temporary names, so that concurrent processes (e.g. MPI ranks)
+      // compiling the same source do not interfere.
+      const std::string tmp = dir + "/" + hash + "." + std::to_string(getpid());
+      const std::string tmp_cpp = tmp + ".cpp", tmp_so = tmp + ".so",
+                        tmp_log = tmp + ".log", tmp_deps = tmp + ".d";
+      {
+         std::ofstream ofs(tmp_cpp);
+         ofs << source;
+         if (!ofs)
+         {
+            MFEM_WARNING("JIT compilation failed: cannot write " << tmp_cpp);
+            std::remove(tmp_cpp.c_str());
+            return false;
+         }
+      }
+      std::vector<std::string> cmd(args);
+      // List the included headers, see IsUpToDate()
+      cmd.push_back("-MD");
+      cmd.push_back("-MF");
+      cmd.push_back(tmp_deps);
+      cmd.push_back("-o");
+      cmd.push_back(tmp_so);
+      cmd.push_back(tmp_cpp);
+      std::string error;
+      bool ok = Run(cmd, tmp_log, error);
+      if (!ok)
+      {
+         std::ifstream ifs(tmp_log);
+         std::ostringstream output;
+         output << ifs.rdbuf();
+         MFEM_WARNING("JIT compilation failed (" << error << "): "
+                      << JitCompiler::Command() << '\n' << output.str());
+      }
+      else if (std::rename(tmp_deps.c_str(), (so + ".d").c_str()) != 0 ||
+               std::rename(tmp_so.c_str(), so.c_str()) != 0)
+      {
+         MFEM_WARNING("JIT compilation failed: cannot rename the compiled "
+                      "files to " << so << ": " << strerror(errno));
+         ok = false;
+      }
+      std::remove(tmp_cpp.c_str());
+      std::remove(tmp_log.c_str());
+      if (!ok)
+      {
+         std::remove(tmp_so.c_str());
+         std::remove(tmp_deps.c_str());
+      }
+      return ok;
+   }
+};
+
+#endif // MFEM_JIT_SUPPORTED
+
+} // namespace internal
+
+bool JitCompiler::enabled = internal::JitEnv();
+
+bool JitCompiler::IsEnabled()
+{
+#ifdef MFEM_JIT_SUPPORTED
+   return enabled;
+#else
+   return false;
+#endif
+}
+
+bool JitCompiler::IsCompilerAvailable()
+{
+#ifdef MFEM_JIT_SUPPORTED
+   std::vector<std::string> cmd;
+   internal::JitSplit(internal::JitEnv("MFEM_JIT_CXX", "c++"), cmd);
+   cmd.push_back("--version");
+   std::string error;
+   return internal::Run(cmd, "/dev/null", error);
+#else
+   return false;
+#endif
+}
+
+void JitCompiler::SetCacheDirectory(const std::string &dir)
+{
+#ifdef MFEM_JIT_SUPPORTED
+   internal::Jit &jit = internal::Jit::Instance();
+   std::lock_guard<std::mutex> lock(jit.mtx);
+   jit.cache_dir = dir;
+#else
+   MFEM_CONTRACT_VAR(dir);
+#endif
+}
+
+std::string JitCompiler::Command()
+{
+   std::string cmd;
+   for (const std::string &a : internal::JitArgs())
+   {
+      cmd += (cmd.empty() ? "" : " ") + a;
+   }
+   return cmd;
+}
+
+void *JitCompiler::Lookup(const std::string &source, const char *symbol)
+{
+#ifdef MFEM_JIT_SUPPORTED
+   internal::Jit &jit = internal::Jit::Instance();
+   std::lock_guard<std::mutex> lock(jit.mtx);
+
+   const std::vector<std::string> args = internal::JitArgs();
+   static const std::string build_id = internal::JitBuildId();
+   const std::string hash =
+      internal::JitHash(Command() + '\n' + build_id + '\n' + source);
+   const std::string key = hash + ':' + symbol;
+   const auto it = jit.symbols.find(key);
+   if (it != jit.symbols.end()) { return it->second; }
+
+   void *&sym = jit.symbols[key];
+   const std::string dir = jit.cache_dir.empty() ?
+                           internal::JitEnv("MFEM_JIT_CACHE", ".mfem_jit") :
+                           jit.cache_dir;
+   const std::string so = dir + "/" + hash + ".so";
+   // Recompile when the MFEM headers changed since the last compilation
+   if (!internal::IsUpToDate(so, so + ".d") &&
+       !jit.Compile(source, args, dir, hash, so))
+   {
+      return sym = nullptr;
+   }
+   // The handle is never closed: the symbol is used until the program exits.
+   void *handle = dlopen(so.c_str(), RTLD_NOW | RTLD_LOCAL);
+   if (!handle)
+   {
+      MFEM_WARNING("Cannot load " << so << ": " << dlerror());
+      return sym = nullptr;
+   }
+   sym = dlsym(handle, symbol);
+   if (!sym) { MFEM_WARNING("Symbol " << symbol << " not found in " << so); }
+   return sym;
+#else
+   MFEM_CONTRACT_VAR(source);
+   MFEM_CONTRACT_VAR(symbol);
+   return nullptr;
+#endif
+}
+
+} // namespace mfem
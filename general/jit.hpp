@@ -0,0 +1,80 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_JIT_HPP
+#define MFEM_JIT_HPP
+
+#include "../config/config.hpp"
+#include <string>
+
+namespace mfem
+{
+
+/** @brief Runtime compilation of C++ sources into shared objects, used to
+    instantiate the kernel specializations missing from the dispatch tables,
+    see KernelDispatchTable. */
+/** The compilation is disabled by default. It is enabled by setting the
+    environment variable MFEM_JIT to a value other than 'NO', or by calling
+    Enable(). The following environment variables are also used:
+
+    - MFEM_JIT_CXX: the host compiler, 'c++' by default.
+    - MFEM_JIT_FLAGS: the compiler flags, '-O3 -std=c++11' by default. The
+      flags '-fPIC -shared' and the include paths of MFEM are always added.
+    - MFEM_JIT_CACHE: the directory of the compiled shared objects,
+      '.mfem_jit' by default, see also SetCacheDirectory().
+
+    The compiler is executed directly, without a shell: MFEM_JIT_CXX and
+    MFEM_JIT_FLAGS are split at white space, and no shell quoting or expansion
+    is applied to them or to the paths.
+
+    The shared objects are cached on disk, with a name given by a hash of the
+    source, of the compiler command, and of the MFEM version and configuration
+    header, so a source is compiled only once across runs. A cached shared
+    object is compiled again when one of the headers it includes is newer. The temporary source and log files of the compilation are
+    removed. The MFEM symbols used by the compiled code are resolved when the
+    shared object is loaded: MFEM must be built as a shared library, or the
+    executable must be linked with '-rdynamic'. If the compilation or the
+    loading fails, a warning with the compiler output is printed and nullptr
+    is returned, so that the caller can use its generic code path.
+
+    The compilation is only supported on POSIX systems, in builds without
+    CUDA or HIP. */
+class JitCompiler
+{
+public:
+   /// Enable or disable the runtime compilation.
+   static void Enable(bool enable = true) { enabled = enable; }
+   /// Return true if the runtime compilation is enabled and supported.
+   static bool IsEnabled();
+
+   /** @brief Compile @a source (if not in the cache), load the shared object
+       and return the address of the symbol @a symbol. */
+   /** The symbol should be declared extern "C" in @a source. Returns nullptr
+       on failure. This function is thread-safe. */
+   static void *Lookup(const std::string &source, const char *symbol);
+
+   /// Return the compiler command line, without the input and output files.
+   static std::string Command();
+
+   /// Return true if the compiler given by MFEM_JIT_CXX can be executed.
+   static bool IsCompilerAvailable();
+
+   /** @brief Set the directory of the compiled shared objects, overriding
+       MFEM_JIT_CACHE. An empty @a dir restores the default. */
+   static void SetCacheDirectory(const std::string &dir);
+
+private:
+   static MFEM_EXPORT bool enabled;
+};
+
+} // namespace mfem
+
+#endif // MFEM_JIT_HPP
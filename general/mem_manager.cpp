@@ -14,9 +14,17 @@
 
 #include <list>
 #include <cstring> // std::memcpy, std::memcmp
-#include <unordered_map>
 #include <algorithm> // std::max
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
 
 // Uncomment to try _WIN32 platform
 //#define _WIN32
@@ -26,6 +34,12 @@
 #include <unistd.h>
 #include <signal.h>
 #include <sys/mman.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#ifdef SYS_mbind
+#define MFEM_HAVE_NUMA_SYSCALLS
+#endif
+#endif
 #define mfem_memalign(p,a,s) posix_memalign(p,a,s)
 #define mfem_aligned_free free
 #else
@@ -80,10 +94,12 @@ bool MemoryClassContainsType(MemoryClass mc, MemoryType mt)
       case MemoryClass::HOST_32:
          return (mt == MemoryType::HOST_32 ||
                  mt == MemoryType::HOST_64 ||
-                 mt == MemoryType::HOST_DEBUG);
+                 mt == MemoryType::HOST_DEBUG ||
+                 mt == MemoryType::HOST_POOL);
       case MemoryClass::HOST_64:
          return (mt == MemoryType::HOST_64 ||
-                 mt == MemoryType::HOST_DEBUG);
+                 mt == MemoryType::HOST_DEBUG ||
+                 mt == MemoryType::HOST_POOL);
       case MemoryClass::DEVICE: return IsDeviceMemory(mt);
       case MemoryClass::MANAGED:
          return (mt == MemoryType::MANAGED);
@@ -185,9 +201,182 @@ struct Alias
    MemoryType h_mt;
 };
 
+/** @brief Map from pointers to values of type T, used for the registered
+    Memory and Alias objects. */
+/** The index is a flat open-addressing hash table with linear probing and
+    backward-shift deletion, so a lookup is a multiplicative hash followed by a
+    scan of a few consecutive slots, without any allocation, lock, or writes to
+    shared data: concurrent lookups are safe. Insertions and removals require
+    exclusive access, as before. (The lookup statistics of debug builds are
+    relaxed atomic counters.)
+
+    The entries are stored in a separate pool of fixed-size blocks and are never
+    moved, since the Alias objects keep pointers to the Memory objects. The
+    subset of the std::unordered_map interface used by the MemoryManager is
+    provided. */
+template <typename T>
+class PointerMap
+{
+public:
+   using value_type = std::pair<const void *const, T>;
+
+   class iterator
+   {
+      friend class PointerMap;
+      value_type *const *slot, *const *end;
+      iterator(value_type *const *s, value_type *const *e) : slot(s), end(e)
+      { while (slot != end && !*slot) { slot++; } }
+   public:
+      value_type &operator*() const { return **slot; }
+      value_type *operator->() const { return *slot; }
+      iterator &operator++()
+      {
+         do { slot++; } while (slot != end && !*slot);
+         return *this;
+      }
+      bool operator==(const iterator &it) const { return slot == it.slot; }
+      bool operator!=(const iterator &it) const { return slot != it.slot; }
+   };
+
+   PointerMap() { Rehash(min_capacity); }
+
+   ~PointerMap() { for (value_type *e : slots) { if (e) { e->~value_type(); } } }
+
+   PointerMap(const PointerMap &) = delete;
+   PointerMap &operator=(const PointerMap &) = delete;
+
+   std::size_t size() const { return count; }
+
+   iterator begin() const { return iterator(slots.data(), End()); }
+
+   iterator end() const { return iterator(End(), End()); }
+
+   iterator find(const void *key) const
+   {
+      std::size_t i = Hash(key);
+      std::size_t num_probes = 1;
+      for ( ; slots[i] && slots[i]->first != key; i = (i + 1) & mask)
+      {
+         num_probes++;
+      }
+#ifdef MFEM_DEBUG
+      lookups.fetch_add(1, std::memory_order_relaxed);
+      probes.fetch_add(num_probes, std::memory_order_relaxed);
+#endif
+      (void) num_probes;
+      return slots[i] ? iterator(slots.data() + i, End()) : end();
+   }
+
+   T &at(const void *key) const
+   {
+      const iterator it = find(key);
+      MFEM_VERIFY(it != end(), "unknown pointer " << key);
+      return it->second;
+   }
+
+   /// Insert (@a key, @a value) if @a key is not present.
+   std::pair<iterator, bool> emplace(const void *key, const T &value)
+   {
+      const iterator it = find(key);
+      if (it != end()) { return std::make_pair(it, false); }
+      if (2*(count + 1) > slots.size()) { Rehash(2*slots.size()); }
+      std::size_t i = Hash(key);
+      while (slots[i]) { i = (i + 1) & mask; }
+      slots[i] = new (Allocate()) value_type(key, value);
+      count++;
+      return std::make_pair(iterator(slots.data() + i, End()), true);
+   }
+
+   void erase(iterator it)
+   {
+      std::size_t i = it.slot - slots.data();
+      value_type *e = slots[i];
+      e->~value_type();
+      free_list.push_back(e);
+      count--;
+      // Backward-shift deletion: move back the following entries of the probe
+      // sequence that are not at their home slot, so that no tombstones are
+      // needed and the lookups stay short.
+      for (std::size_t j = (i + 1) & mask; slots[j]; j = (j + 1) & mask)
+      {
+         const std::size_t home = Hash(slots[j]->first);
+         if (((j - home) & mask) >= ((j - i) & mask))
+         {
+            slots[i] = slots[j];
+            i = j;
+         }
+      }
+      slots[i] = nullptr;
+   }
+
+   /// Make room for @a n entries without reallocating the index.
+   void reserve(std::size_t n)
+   {
+      std::size_t capacity = slots.size();
+      while (capacity < 2*n) { capacity *= 2; }
+      if (capacity != slots.size()) { Rehash(capacity); }
+   }
+
+   /// Number of lookups and of slots inspected (counted in debug builds).
+   std::size_t num_lookups() const { return lookups.load(); }
+   std::size_t num_probes() const { return probes.load(); }
+
+private:
+   static constexpr std::size_t min_capacity = 64;
+   static constexpr std::size_t block_size = 256;
+
+   struct alignas(value_type) Storage { char bytes[sizeof(value_type)]; };
+
+   std::vector<value_type*> slots;
+   std::size_t mask = 0, count = 0;
+   int shift = 64;
+   std::vector<std::unique_ptr<Storage[]>> blocks;
+   std::vector<void*> free_list;
+   mutable std::atomic<std::size_t> lookups{0}, probes{0};
+
+   value_type *const *End() const { return slots.data() + slots.size(); }
+
+   // Fibonacci hashing of the address; the lowest bits are dropped since the
+   // registered pointers are aligned.
+   std::size_t Hash(const void *key) const
+   {
+      const std::uint64_t k = reinterpret_cast<std::uintptr_t>(key) >> 3;
+      return std::size_t((k * 0x9e3779b97f4a7c15ull) >> shift);
+   }
+
+   void *Allocate()
+   {
+      if (free_list.empty())
+      {
+         blocks.emplace_back(new Storage[block_size]);
+         Storage *b = blocks.back().get();
+         for (std::size_t k = block_size; k--; ) { free_list.push_back(b + k); }
+      }
+      void *p = free_list.back();
+      free_list.pop_back();
+      return p;
+   }
+
+   void Rehash(std::size_t capacity)
+   {
+      std::vector<value_type*> old(capacity, nullptr);
+      old.swap(slots);
+      mask = capacity - 1;
+      shift = 64;
+      for (std::size_t c = capacity; c > 1; c >>= 1) { shift--; }
+      for (value_type *e : old)
+      {
+         if (!e) { continue; }
+         std::size_t i = Hash(e->first);
+         while (slots[i]) { i = (i + 1) & mask; }
+         slots[i] = e;
+      }
+   }
+};
+
 /// Maps for the Memory and the Alias classes
-typedef std::unordered_map<const void*, Memory> MemoryMap;
-typedef std::unordered_map<const void*, Alias> AliasMap;
+typedef PointerMap<Memory> MemoryMap;
+typedef PointerMap<Alias> AliasMap;
 
 struct Maps
 {
@@ -243,13 +432,110 @@ struct NoHostMemorySpace : public HostMemorySpace
    void Alloc(void**, const size_t) override { mfem_error("! Host Alloc error"); }
 };
 
+static HostMemoryPolicy HostMemoryPolicyEnv()
+{
+   HostMemoryPolicy policy;
+   if (const char *env = GetEnv("MFEM_HUGE_PAGES"))
+   {
+      policy.huge_page_threshold = std::strtoull(env, nullptr, 10);
+   }
+   if (const char *env = GetEnv("MFEM_NUMA"))
+   {
+      const std::string numa(env);
+      if (numa == "interleave") { policy.numa = HostMemoryPolicy::NUMA::INTERLEAVE; }
+      else if (numa == "local") { policy.numa = HostMemoryPolicy::NUMA::LOCAL; }
+   }
+   return policy;
+}
+
+static HostMemoryPolicy &GetHostPolicy()
+{
+   static HostMemoryPolicy policy = HostMemoryPolicyEnv();
+   return policy;
+}
+
+#ifdef MFEM_HAVE_NUMA_SYSCALLS
+// Mask of the online NUMA nodes, read from sysfs, e.g. "0-1,3".
+static const std::vector<unsigned long> &NumaNodeMask()
+{
+   static const std::vector<unsigned long> mask = []
+   {
+      std::vector<unsigned long> m;
+      std::ifstream ifs("/sys/devices/system/node/online");
+      int first, last;
+      char sep;
+      while (ifs >> first)
+      {
+         last = first;
+         if (ifs.peek() == '-') { ifs >> sep >> last; }
+         for (int n = first; n <= last; n++)
+         {
+            const std::size_t bits = 8*sizeof(unsigned long);
+            if (m.size() <= n/bits) { m.resize(n/bits + 1, 0ul); }
+            m[n/bits] |= 1ul << (n % bits);
+         }
+         if (ifs.peek() == ',') { ifs >> sep; }
+      }
+      return m;
+   }();
+   return mask;
+}
+#endif
+
+/// Allocate @a bytes of host memory aligned at @a align bytes, with the
+/// HostMemoryPolicy.
+static void PolicyAlignedAlloc(void **ptr, size_t align, size_t bytes)
+{
+   const HostMemoryPolicy &policy = GetHostPolicy();
+   constexpr size_t huge_page = size_t(1) << 21;
+   const bool huge = policy.huge_page_threshold > 0 &&
+                     bytes >= policy.huge_page_threshold;
+   // The whole 2 MB pages are owned by the allocation, so that the advice
+   // does not apply to other allocations.
+   const size_t alloc_bytes = huge ? (bytes + huge_page - 1) & ~(huge_page - 1) :
+                              bytes;
+   if (mfem_memalign(ptr, huge ? huge_page : align, alloc_bytes) != 0)
+   {
+      throw ::std::bad_alloc();
+   }
+#ifdef MADV_HUGEPAGE
+   if (huge) { madvise(*ptr, alloc_bytes, MADV_HUGEPAGE); }
+#endif
+#ifdef MFEM_HAVE_NUMA_SYSCALLS
+   if (policy.numa != HostMemoryPolicy::NUMA::DEFAULT &&
+       bytes >= policy.numa_threshold)
+   {
+      // The policy applies to the pages entirely in the allocation, which have
+      // not been touched yet for large allocations.
+      const uintptr_t page = sysconf(_SC_PAGESIZE);
+      const uintptr_t a = ((uintptr_t) *ptr + page - 1) & ~(page - 1);
+      const uintptr_t b = ((uintptr_t) *ptr + bytes) & ~(page - 1);
+      if (b > a)
+      {
+         constexpr int mpol_interleave = 3, mpol_local = 4;
+         const bool interleave =
+            policy.numa == HostMemoryPolicy::NUMA::INTERLEAVE;
+         const std::vector<unsigned long> &mask = NumaNodeMask();
+         const unsigned long max_node = 8*sizeof(unsigned long)*mask.size()+1;
+         if (!interleave || !mask.empty())
+         {
+            syscall(SYS_mbind, (void*) a, b - a,
+                    interleave ? mpol_interleave : mpol_local,
+                    interleave ? mask.data() : nullptr,
+                    interleave ? max_node : 0ul, 0u);
+         }
+      }
+   }
+#endif
+}
+
 /// The aligned 32 host memory space
 class Aligned32HostMemorySpace : public HostMemorySpace
 {
 public:
    Aligned32HostMemorySpace(): HostMemorySpace() { }
    void Alloc(void **ptr, size_t bytes) override
-   { if (mfem_memalign(ptr, 32, bytes) != 0) { throw ::std::bad_alloc(); } }
+   { PolicyAlignedAlloc(ptr, 32, bytes); }
    void Dealloc(void *ptr) override { mfem_aligned_free(ptr); }
 };
 
@@ -259,10 +545,249 @@ class Aligned64HostMemorySpace : public HostMemorySpace
 public:
    Aligned64HostMemorySpace(): HostMemorySpace() { }
    void Alloc(void **ptr, size_t bytes) override
-   { if (mfem_memalign(ptr, 64, bytes) != 0) { throw ::std::bad_alloc(); } }
+   { PolicyAlignedAlloc(ptr, 64, bytes); }
    void Dealloc(void *ptr) override { mfem_aligned_free(ptr); }
 };
 
+/// Caching pool of 64-byte aligned host blocks, used by HOST_POOL
+class HostPool
+{
+public:
+   static constexpr std::size_t header = 64; // keeps the 64-byte alignment
+   static constexpr int num_classes = 1 + 4*22; // 64 bytes up to 256 MB
+   static constexpr std::size_t max_local = 32; // per thread and size class
+
+   // Per-thread free lists. The owner thread and Release() access them under
+   // the spin lock 'busy', which is uncontended except during Release(). The
+   // pool mutex is never acquired while 'busy' is held.
+   struct Cache
+   {
+      std::atomic<bool> busy{false};
+      std::vector<void*> lists[num_classes];
+
+      void Lock() { while (busy.exchange(true, std::memory_order_acquire)) { } }
+      void Unlock() { busy.store(false, std::memory_order_release); }
+   };
+
+   // When a thread exits, the blocks of its cache are returned to the global
+   // lists. The blocks freed after that (e.g. by static destructors, for the
+   // main thread) go directly to the global lists.
+   struct CacheOwner
+   {
+      ~CacheOwner()
+      {
+         cache_done = true;
+         if (!cache) { return; }
+         HostPool &pool = Get();
+         std::lock_guard<std::mutex> lock(pool.mtx);
+         pool.caches.erase(std::find(pool.caches.begin(), pool.caches.end(),
+                                     cache));
+         for (int c = 0; c < num_classes; c++)
+         {
+            pool.lists[c].insert(pool.lists[c].end(), cache->lists[c].begin(),
+                                 cache->lists[c].end());
+         }
+         delete cache;
+         cache = nullptr;
+      }
+   };
+
+   // The pool is never destroyed: blocks may be freed by static destructors.
+   static HostPool &Get()
+   {
+      static HostPool *pool = new HostPool;
+      return *pool;
+   }
+
+   // Size class of @a bytes: 64 bytes, then four classes per power of two,
+   // 1.25, 1.5, 1.75 and 2 times 2^e; -1 for the sizes that are not cached.
+   static int Class(std::size_t bytes)
+   {
+      if (bytes <= 64) { return 0; }
+      const std::size_t b = bytes - 1;
+      int e = 0;
+      while ((b >> e) > 1) { e++; }
+      if (e >= 28) { return -1; }
+      return 1 + 4*(e - 6) + int((b >> (e - 2)) - 4);
+   }
+
+   static std::size_t ClassSize(int c)
+   {
+      if (c == 0) { return 64; }
+      const int e = 6 + (c - 1)/4;
+      return std::size_t(5 + (c - 1)%4) << (e - 2);
+   }
+
+   void *Alloc(std::size_t bytes)
+   {
+      const int c = Class(bytes);
+      const std::size_t size = (c < 0) ? bytes : ClassSize(c);
+      num_allocs++;
+      AddMax(in_use, max_in_use, size);
+      char *block = (c >= 0) ? static_cast<char*>(Pop(c)) : nullptr;
+      if (block) { num_reused++; }
+      else
+      {
+         void *p;
+         PolicyAlignedAlloc(&p, header, header + size);
+         block = static_cast<char*>(p);
+         AddMax(reserved, max_reserved, size);
+         int *h = reinterpret_cast<int*>(block);
+         h[0] = c;
+         std::memcpy(block + sizeof(std::size_t), &size, sizeof(size));
+      }
+      return block + header;
+   }
+
+   void Dealloc(void *ptr)
+   {
+      char *block = static_cast<char*>(ptr) - header;
+      const int c = *reinterpret_cast<int*>(block);
+      std::size_t size;
+      std::memcpy(&size, block + sizeof(std::size_t), sizeof(size));
+      in_use -= size;
+      if (c < 0)
+      {
+         reserved -= size;
+         mfem_aligned_free(block);
+         return;
+      }
+      Cache *local_cache = LocalCache();
+      if (!local_cache)
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         lists[c].push_back(block);
+         return;
+      }
+      // Spill half of a full local list to the global list.
+      void *spill[max_local];
+      std::size_t num_spill = 0;
+      local_cache->Lock();
+      std::vector<void*> &local = local_cache->lists[c];
+      local.push_back(block);
+      if (local.size() > max_local)
+      {
+         num_spill = local.size() - max_local/2;
+         std::copy(local.begin() + max_local/2, local.end(), spill);
+         local.resize(max_local/2);
+      }
+      local_cache->Unlock();
+      if (num_spill)
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         lists[c].insert(lists[c].end(), spill, spill + num_spill);
+      }
+   }
+
+   // Free the cached blocks of all threads.
+   void Release()
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      auto release = [this](std::vector<void*> &list, int c)
+      {
+         for (void *block : list) { mfem_aligned_free(block); }
+         reserved -= list.size()*ClassSize(c);
+         list.clear();
+      };
+      for (int c = 0; c < num_classes; c++) { release(lists[c], c); }
+      for (Cache *thread_cache : caches)
+      {
+         thread_cache->Lock();
+         for (int c = 0; c < num_classes; c++)
+         {
+            release(thread_cache->lists[c], c);
+         }
+         thread_cache->Unlock();
+      }
+   }
+
+   HostPoolStats Stats() const
+   {
+      return HostPoolStats{num_allocs, num_reused, in_use, max_in_use,
+                           reserved, max_reserved};
+   }
+
+private:
+   std::mutex mtx; // protects the global lists and 'caches'
+   std::vector<void*> lists[num_classes];
+   std::vector<Cache*> caches; // the caches of the running threads
+   std::atomic<std::size_t> num_allocs{0}, num_reused{0};
+   std::atomic<std::size_t> in_use{0}, max_in_use{0};
+   std::atomic<std::size_t> reserved{0}, max_reserved{0};
+   // Trivially destructible, so they can be used after the CacheOwner of the
+   // thread has been destroyed.
+   static thread_local Cache *cache;
+   static thread_local bool cache_done;
+
+   static Cache *LocalCache()
+   {
+      // Constructed at the first call in each thread.
+      static thread_local CacheOwner owner;
+      if (!cache && !cache_done)
+      {
+         cache = new Cache;
+         HostPool &pool = Get();
+         std::lock_guard<std::mutex> lock(pool.mtx);
+         pool.caches.push_back(cache);
+      }
+      return cache;
+   }
+
+   // Return a cached block of class @a c, or nullptr. A local list that is
+   // empty is refilled with up to half of its capacity from the global list.
+   void *Pop(int c)
+   {
+      Cache *local_cache = LocalCache();
+      if (local_cache)
+      {
+         local_cache->Lock();
+         std::vector<void*> &local = local_cache->lists[c];
+         void *block = nullptr;
+         if (!local.empty()) { block = local.back(); local.pop_back(); }
+         local_cache->Unlock();
+         if (block) { return block; }
+      }
+      void *refill[max_local/2];
+      std::size_t n = 0;
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         std::vector<void*> &global = lists[c];
+         n = std::min(global.size(), local_cache ? max_local/2 : 1);
+         std::copy(global.end() - n, global.end(), refill);
+         global.resize(global.size() - n);
+      }
+      if (n == 0) { return nullptr; }
+      if (n > 1)
+      {
+         local_cache->Lock();
+         local_cache->lists[c].insert(local_cache->lists[c].end(), refill,
+                                      refill + n - 1);
+         local_cache->Unlock();
+      }
+      return refill[n - 1];
+   }
+
+   static void AddMax(std::atomic<std::size_t> &value,
+                      std::atomic<std::size_t> &max, std::size_t inc)
+   {
+      const std::size_t v = (value += inc);
+      std::size_t m = max.load(std::memory_order_relaxed);
+      while (v > m && !max.compare_exchange_weak(m, v)) { }
+   }
+};
+
+thread_local HostPool::Cache *HostPool::cache = nullptr;
+thread_local bool HostPool::cache_done = false;
+
+/// The host memory space using the caching HostPool
+class PoolHostMemorySpace : public HostMemorySpace
+{
+public:
+   void Alloc(void **ptr, size_t bytes) override
+   { *ptr = HostPool::Get().Alloc(bytes); }
+   void Dealloc(void *ptr) override { HostPool::Get().Dealloc(ptr); }
+};
+
 #ifndef _WIN32
 static uintptr_t pagesize = 0;
 static uintptr_t pagemask = 0;
@@ -755,6 +1280,7 @@ private:
          case MT::HOST_UMPIRE: return new NoHostMemorySpace();
 #endif
          case MT::HOST_PINNED: return new HostPinnedMemorySpace();
+         case MT::HOST_POOL: return new PoolHostMemorySpace();
          default: MFEM_ABORT("Unknown host memory controller!");
       }
       return nullptr;
@@ -1713,6 +2239,48 @@ int MemoryManager::PrintAliases(std::ostream &os)
    return n_out;
 }
 
+HostPoolStats MemoryManager::GetHostPoolStats()
+{
+   return internal::HostPool::Get().Stats();
+}
+
+void MemoryManager::ReleaseHostPool() { internal::HostPool::Get().Release(); }
+
+void MemoryManager::SetHostMemoryPolicy(const HostMemoryPolicy &policy)
+{
+   internal::GetHostPolicy() = policy;
+}
+
+const HostMemoryPolicy &MemoryManager::GetHostMemoryPolicy()
+{
+   return internal::GetHostPolicy();
+}
+
+void MemoryManager::Reserve(std::size_t num_ptrs, std::size_t num_aliases)
+{
+   maps->memories.reserve(num_ptrs);
+   maps->aliases.reserve(num_aliases);
+}
+
+void MemoryManager::PrintStats(std::ostream &os)
+{
+   auto print = [&](const char *name, std::size_t size, std::size_t lookups,
+                    std::size_t probes)
+   {
+      os << name << size;
+#ifdef MFEM_DEBUG
+      os << ", lookups: " << lookups << ", probes per lookup: "
+         << (lookups ? double(probes)/lookups : 0.0);
+#endif
+      os << '\n';
+   };
+   print("registered pointers: ", maps->memories.size(),
+         maps->memories.num_lookups(), maps->memories.num_probes());
+   print("registered aliases : ", maps->aliases.size(),
+         maps->aliases.num_lookups(), maps->aliases.num_probes());
+   os << std::flush;
+}
+
 int MemoryManager::CompareHostAndDevice_(void *h_ptr, size_t size,
                                          unsigned flags)
 {
@@ -1784,6 +2352,7 @@ MemoryType MemoryManager::dual_map[MemoryTypeSize] =
    /* HOST_DEBUG      */  MemoryType::DEVICE_DEBUG,
    /* HOST_UMPIRE     */  MemoryType::DEVICE_UMPIRE,
    /* HOST_PINNED     */  MemoryType::DEVICE,
+   /* HOST_POOL       */  MemoryType::DEVICE,
    /* MANAGED         */  MemoryType::MANAGED,
    /* DEVICE          */  MemoryType::HOST,
    /* DEVICE_DEBUG    */  MemoryType::HOST_DEBUG,
@@ -1801,6 +2370,7 @@ const char * MemoryManager::d_umpire_2_name = "MFEM_DEVICE_2";
 const char *MemoryTypeName[MemoryTypeSize] =
 {
    "host-std", "host-32", "host-64", "host-debug", "host-umpire", "host-pinned",
+   "host-pool",
 #if defined(MFEM_USE_CUDA)
    "cuda-uvm",
    "cuda",
@@ -44,6 +44,11 @@ enum class MemoryType
    HOST_UMPIRE,    /**< Host memory; using an Umpire allocator which can be set
                         with MemoryManager::SetUmpireHostAllocatorName */
    HOST_PINNED,    ///< Host memory: pinned (page-locked)
+   HOST_POOL,      /**< Host memory; aligned at 64 bytes, from a caching pool
+                        with size classes, see MemoryManager::GetHostPoolStats.
+                        Opt-in: used only when requested explicitly, or as the
+                        host memory type set with Device::SetMemoryTypes() or
+                        MFEM_MEMORY=hostpool. */
    MANAGED,        /**< Managed memory; using CUDA or HIP *MallocManaged
                         and *Free */
    DEVICE,         ///< Device memory; using CUDA or HIP *Malloc and *Free
@@ -80,9 +85,10 @@ extern MFEM_EXPORT const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, HOST_PINNED, MANAGED } */
-   HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
-   HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
+                                 HOST_UMPIRE, HOST_PINNED, HOST_POOL,
+                                 MANAGED } */
+   HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG, HOST_POOL }
+   HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG, HOST_POOL }
    DEVICE,  /**< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE,
                                  DEVICE_UMPIRE_2, MANAGED } */
    MANAGED  ///< Memory types: { MANAGED }
@@ -113,6 +119,51 @@ bool MemoryClassContainsType(MemoryClass mc, MemoryType mt);
     HOST < HOST_32 < HOST_64 < DEVICE < MANAGED. */
 MemoryClass operator*(MemoryClass mc1, MemoryClass mc2);
 
+/// Placement policy of the large host allocations, see
+/// MemoryManager::SetHostMemoryPolicy().
+/** The policy applies to the memory types allocated by the memory manager
+    with an explicit alignment: HOST_32, HOST_64 and HOST_POOL. To use it for
+    all the host data, e.g. the partial assembly data and the vectors, select
+    one of them as the host memory type, e.g. with Device::SetMemoryTypes() or
+    with the environment variable MFEM_MEMORY=host64. It is only effective on
+    Linux; on other systems, the allocations are not modified.
+
+    The default policy is set by the environment variables MFEM_HUGE_PAGES,
+    giving the huge page threshold in bytes, and MFEM_NUMA, set to
+    'interleave' or 'local'. */
+struct HostMemoryPolicy
+{
+   /// NUMA placement of the pages of the large allocations
+   enum class NUMA
+   {
+      DEFAULT,    ///< The policy of the process (usually first-touch)
+      INTERLEAVE, ///< Pages distributed round-robin over all NUMA nodes
+      LOCAL       ///< Pages on the node of the thread that touches them first
+   };
+
+   /** @brief Allocations of at least this many bytes are aligned at 2 MB and
+       use transparent huge pages; 0 disables the huge pages. */
+   std::size_t huge_page_threshold = 0;
+   /// NUMA placement of the allocations of at least @a numa_threshold bytes.
+   NUMA numa = NUMA::DEFAULT;
+   std::size_t numa_threshold = std::size_t(1) << 21;
+};
+
+/// Statistics of the host memory pool used by MemoryType::HOST_POOL.
+/** The pool rounds the allocation sizes up to one of four size classes per
+    power of two and caches the freed blocks in per-thread free lists, so that
+    the repeated allocations of temporaries with the same sizes do not go
+    through the system allocator. The sizes below are the rounded sizes. */
+struct HostPoolStats
+{
+   std::size_t num_allocs;      ///< Total number of allocations
+   std::size_t num_reused;      ///< Number of allocations using a cached block
+   std::size_t bytes_in_use;    ///< Bytes currently allocated
+   std::size_t max_bytes_in_use;   ///< High-water mark of bytes_in_use
+   std::size_t bytes_reserved;  ///< Bytes in use or cached by the pool
+   std::size_t max_bytes_reserved; ///< High-water mark of bytes_reserved
+};
+
 /// Class used by MFEM to store pointers to host and/or device memory.
 /** The template class parameter, T, must be a plain-old-data (POD) type.
 
@@ -794,6 +845,7 @@ public:
        HOST_DEBUG      | DEVICE_DEBUG
        HOST_UMPIRE     | DEVICE_UMPIRE
        HOST_PINNED     | DEVICE
+       HOST_POOL       | DEVICE
        MANAGED         | MANAGED
        DEVICE          | HOST
        DEVICE_DEBUG    | HOST_DEBUG
@@ -858,7 +910,28 @@ public:
    /// returning the number of printed pointers
    int PrintAliases(std::ostream &out = mfem::out);
 
+   /** @brief Make room in the registry for @a num_ptrs pointers and
+       @a num_aliases aliases, e.g. before registering many aliases. */
+   void Reserve(std::size_t num_ptrs, std::size_t num_aliases);
+
+   /** @brief Print the number of registered pointers and aliases, and the
+       average number of slots inspected per lookup (counted in debug builds). */
+   void PrintStats(std::ostream &out = mfem::out);
+
    static MemoryType GetHostMemoryType() { return host_mem_type; }
+
+   /// Return the statistics of the MemoryType::HOST_POOL allocations.
+   static HostPoolStats GetHostPoolStats();
+
+   /** @brief Free the blocks cached by the MemoryType::HOST_POOL allocator,
+       including the ones cached by other threads. */
+   static void ReleaseHostPool();
+
+   /// Set the placement policy of the large host allocations.
+   static void SetHostMemoryPolicy(const HostMemoryPolicy &policy);
+
+   /// Return the placement policy of the large host allocations.
+   static const HostMemoryPolicy &GetHostMemoryPolicy();
    static MemoryType GetDeviceMemoryType() { return device_mem_type; }
 
 #ifdef MFEM_USE_ENZYME
@@ -13,11 +13,194 @@
 #define MFEM_SORT_PAIRS
 
 #include "../config/config.hpp"
+#include "threads.hpp"
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
 namespace mfem
 {
 
+namespace internal
+{
+
+// Arrays smaller than this are sorted with std::sort.
+const int radix_sort_min_size = 256;
+
+// Arrays smaller than this are sorted sequentially.
+const int radix_sort_threads_min_size = 1 << 16;
+
+// Map an integer to an unsigned integer with the same order.
+template <typename I>
+inline std::uint64_t RadixKey(I k)
+{
+   static_assert(std::is_integral<I>::value, "integer keys expected");
+   return std::is_signed<I>::value ?
+          std::uint64_t(std::int64_t(k)) ^ (std::uint64_t(1) << 63) :
+          std::uint64_t(k);
+}
+
+// Return true if x < y in the lexicographic order of the keys.
+template <class T>
+inline bool RadixLess(const T &, const T &) { return false; }
+
+template <class T, class Key, class... Keys>
+inline bool RadixLess(const T &x, const T &y, Key key, Keys... keys)
+{
+   const std::uint64_t kx = RadixKey(key(x)), ky = RadixKey(key(y));
+   return (kx != ky) ? (kx < ky) : RadixLess(x, y, keys...);
+}
+
+// Stable insertion sort, for nearly sorted arrays. Gives up, returning false,
+// after max_moves moves; the array is then partially sorted.
+template <class T, class... Keys>
+bool InsertionSort(T *a, int n, long max_moves, Keys... keys)
+{
+   long moves = 0;
+   for (int i = 1; i < n; i++)
+   {
+      if (!RadixLess(a[i], a[i-1], keys...)) { continue; }
+      T x = a[i];
+      int j = i;
+      do
+      {
+         a[j] = a[j-1];
+         j--;
+      }
+      while (j > 0 && RadixLess(x, a[j-1], keys...) && ++moves < max_moves);
+      a[j] = x;
+      if (moves >= max_moves) { return false; }
+   }
+   return true;
+}
+
+// One stable LSD radix sort of a with respect to key, with 8-bit digits. Only
+// the digits that differ between the smallest and the largest key are sorted.
+// If pool is not null, the histograms and the scatter are computed by blocks
+// of the array, one per thread.
+template <class T, class Key>
+void RadixSortByKey(T *a, int n, std::vector<T> &buf, mfem::ThreadPool *pool,
+                    Key key)
+{
+   if (n < 2) { return; }
+   std::uint64_t kmin = RadixKey(key(a[0])), kmax = kmin;
+   for (int i = 1; i < n; i++)
+   {
+      const std::uint64_t k = RadixKey(key(a[i]));
+      kmin = std::min(kmin, k);
+      kmax = std::max(kmax, k);
+   }
+   const std::uint64_t range = kmax - kmin;
+
+   const int nb = pool ? pool->NumThreads() : 1;
+   std::vector<int> count(256*nb);
+   buf.resize(n);
+   T *src = a, *dst = buf.data();
+   for (int shift = 0; shift < 64 && (range >> shift); shift += 8)
+   {
+      auto digit = [&](const T &x)
+      { return int(((RadixKey(key(x)) - kmin) >> shift) & 255); };
+
+      // Histogram of the digits in each block
+      auto histogram = [&](int b)
+      {
+         int *c = count.data() + 256*b;
+         std::fill(c, c + 256, 0);
+         for (int i = int(std::int64_t(n)*b/nb);
+              i < int(std::int64_t(n)*(b+1)/nb); i++) { c[digit(src[i])]++; }
+      };
+      if (pool) { pool->ParallelFor(nb, histogram); }
+      else { histogram(0); }
+
+      // Offsets, ordered by digit and then by block; skip the digits that are
+      // the same for all entries.
+      int sum = 0;
+      bool skip = false;
+      for (int d = 0; d < 256 && !skip; d++)
+      {
+         for (int b = 0; b < nb; b++)
+         {
+            const int c = count[256*b + d];
+            skip = skip || (c == n);
+            count[256*b + d] = sum;
+            sum += c;
+         }
+      }
+      if (skip) { continue; }
+
+      auto scatter = [&](int b)
+      {
+         int *c = count.data() + 256*b;
+         for (int i = int(std::int64_t(n)*b/nb);
+              i < int(std::int64_t(n)*(b+1)/nb); i++)
+         {
+            dst[c[digit(src[i])]++] = src[i];
+         }
+      };
+      if (pool) { pool->ParallelFor(nb, scatter); }
+      else { scatter(0); }
+      std::swap(src, dst);
+   }
+   if (src != a) { std::copy(src, src + n, a); }
+}
+
+template <class T>
+inline void RadixSortKeys(T *, int, std::vector<T> &, mfem::ThreadPool *) { }
+
+// LSD: sort by the least significant key first.
+template <class T, class Key, class... Keys>
+inline void RadixSortKeys(T *a, int n, std::vector<T> &buf,
+                          mfem::ThreadPool *pool, Key key, Keys... keys)
+{
+   RadixSortKeys(a, n, buf, pool, keys...);
+   RadixSortByKey(a, n, buf, pool, key);
+}
+
+} // namespace internal
+
+/** @brief Stable sort of the array @a items of size @a size, in the
+    lexicographic order of the integer keys given by the functions @a keys,
+    from the most significant to the least significant. */
+/** The array is first checked for (nearly) sorted input, which is handled in
+    linear time. Small arrays are sorted with a comparison sort. Otherwise, an
+    LSD radix sort with 8-bit digits is used, sorting only the digits that vary
+    between the smallest and the largest key. If Backend::CPU_THREADS is
+    enabled and the array is large, the radix sort uses the threads of
+    ThreadPool::Global().
+
+    Example: sort by the key @a one of an array of Pair<int,int>:
+    @code
+    RadixSort(pairs, n, [](const Pair<int,int> &p) { return p.one; });
+    @endcode */
+template <class T, class... Keys>
+void RadixSort(T *items, int size, Keys... keys)
+{
+   if (size < 2) { return; }
+   int descents = 0;
+   for (int i = 1; i < size; i++)
+   {
+      descents += internal::RadixLess(items[i], items[i-1], keys...);
+   }
+   if (descents == 0) { return; }
+   if (64*long(descents) < size &&
+       internal::InsertionSort(items, size, 8*long(size), keys...))
+   {
+      return;
+   }
+   if (size < internal::radix_sort_min_size)
+   {
+      std::stable_sort(items, items + size, [&](const T &x, const T &y)
+      { return internal::RadixLess(x, y, keys...); });
+      return;
+   }
+   std::vector<T> buf;
+   internal::RadixSortKeys(items, size, buf,
+                           ThreadPool::GlobalFor(
+                              size, internal::radix_sort_threads_min_size),
+                           keys...);
+}
+
 /// A pair of objects
 template <class A, class B>
 class Pair
@@ -45,11 +228,29 @@ bool operator==(const Pair<A,B> &p, const Pair<A,B> &q)
    return (p.one == q.one);
 }
 
+namespace internal
+{
+
+template <class A, class B>
+void SortPairs(Pair<A, B> *pairs, int size, std::true_type)
+{
+   RadixSort(pairs, size, [](const Pair<A, B> &p) { return p.one; });
+}
+
+template <class A, class B>
+void SortPairs(Pair<A, B> *pairs, int size, std::false_type)
+{
+   std::sort(pairs, pairs + size);
+}
+
+} // namespace internal
+
 /// Sort an array of Pairs with respect to the first element
+/** For integer keys, RadixSort() is used and the sort is stable. */
 template <class A, class B>
 void SortPairs (Pair<A, B> *pairs, int size)
 {
-   std::sort(pairs, pairs + size);
+   internal::SortPairs(pairs, size, std::is_integral<A>());
 }
 
 /// A triple of objects
@@ -76,11 +277,36 @@ bool operator<(const Triple<A,B,C> &p, const Triple<A,B,C> &q)
             (p.two < q.two || (!(q.two < p.two) && p.three < q.three))));
 }
 
+namespace internal
+{
+
+template <class A, class B, class C>
+void SortTriple(Triple<A, B, C> *triples, int size, std::true_type)
+{
+   typedef Triple<A, B, C> T;
+   RadixSort(triples, size, [](const T &t) { return t.one; },
+             [](const T &t) { return t.two; },
+             [](const T &t) { return t.three; });
+}
+
+template <class A, class B, class C>
+void SortTriple(Triple<A, B, C> *triples, int size, std::false_type)
+{
+   std::sort(triples, triples + size);
+}
+
+} // namespace internal
+
 /// @brief Lexicographic sort for arrays of class Triple.
+/** For integer entries, RadixSort() is used and the sort is stable. */
 template <class A, class B, class C>
 void SortTriple (Triple<A, B, C> *triples, int size)
 {
-   std::sort(triples, triples + size);
+   internal::SortTriple(triples, size,
+                        std::integral_constant<bool,
+                        std::is_integral<A>::value &&
+                        std::is_integral<B>::value &&
+                        std::is_integral<C>::value>());
 }
 
 }
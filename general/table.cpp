@@ -16,8 +16,14 @@
 #include "error.hpp"
 
 #include "../general/mem_manager.hpp"
+#include "threads.hpp"
+#include "backends.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 namespace mfem
 {
@@ -483,6 +489,163 @@ Table::~Table ()
    J.Delete();
 }
 
+namespace internal
+{
+
+// Minimal number of entries of a Table for its construction to use the
+// threads of the ThreadPool::Global() pool.
+static const int table_threads_min_size = 1 << 14;
+
+// Range [begin,end) of the b-th of nb contiguous blocks of [0,n).
+static inline void TableBlock(int n, int nb, int b, int &begin, int &end)
+{
+   begin = int((std::int64_t(n)*b)/nb);
+   end = int((std::int64_t(n)*(b+1))/nb);
+}
+
+// Replace the row sizes a[1],...,a[n] by the row offsets a[0],...,a[n], with
+// a[0] = 0, using a two-pass blocked scan. The offsets are accumulated in
+// 64-bit integers, so that an overflow of the int offsets is detected.
+static void TablePrefixSum(mfem::ThreadPool &pool, int *a, int n)
+{
+   const int nb = pool.NumThreads();
+   std::vector<std::int64_t> sums(nb+1, 0);
+   a[0] = 0;
+   pool.ParallelFor(nb, [&](int b)
+   {
+      int begin, end;
+      TableBlock(n, nb, b, begin, end);
+      std::int64_t s = 0;
+      for (int i = begin; i < end; i++) { s += a[i+1]; }
+      sums[b+1] = s;
+   });
+   for (int b = 0; b < nb; b++) { sums[b+1] += sums[b]; }
+   MFEM_VERIFY(sums[nb] <= INT_MAX, "the number of entries of the Table, "
+               << sums[nb] << ", exceeds the range of int");
+   pool.ParallelFor(nb, [&](int b)
+   {
+      int begin, end;
+      TableBlock(n, nb, b, begin, end);
+      int s = int(sums[b]);
+      for (int i = begin; i < end; i++) { a[i+1] = (s += a[i+1]); }
+   });
+}
+
+// Threaded version of Transpose(). The column indices are scattered with
+// atomic updates of the row offsets of At and each row of At is then sorted,
+// so the result is identical to the one of the sequential version.
+static void TransposeThreads(mfem::ThreadPool &pool, const Table &A,
+                             Table &At, int ncols_A)
+{
+   const int *i_A     = A.GetI();
+   const int *j_A     = A.GetJ();
+   const int  nrows_A = A.Size();
+   const int  nnz_A   = i_A[nrows_A];
+
+   At.SetDims(ncols_A, nnz_A);
+
+   int *i_At = At.GetI();
+   int *j_At = At.GetJ();
+
+   pool.ParallelFor(ncols_A+1, [=](int i) { i_At[i] = 0; });
+   pool.ParallelFor(nnz_A, [=](int k) { AtomicAdd(i_At[j_A[k]+1], 1); });
+   TablePrefixSum(pool, i_At, ncols_A);
+
+   std::vector<int> pos(ncols_A);
+   int *d_pos = pos.data();
+   pool.ParallelFor(ncols_A, [=](int i) { d_pos[i] = i_At[i]; });
+   pool.ParallelFor(nrows_A, [=](int i)
+   {
+      for (int j = i_A[i]; j < i_A[i+1]; j++)
+      {
+         j_At[AtomicAdd(d_pos[j_A[j]], 1)] = i;
+      }
+   });
+   pool.ParallelFor(ncols_A, [=](int i)
+   {
+      std::sort(j_At + i_At[i], j_At + i_At[i+1]);
+   });
+}
+
+// Threaded version of Mult(). The rows of C are split into one block per
+// thread, each with its own marker array, and are built in two passes: the
+// first one computes the row sizes and the second one fills the column
+// indices, in the same order as in the sequential version.
+static void MultThreads(mfem::ThreadPool &pool, const Table &A,
+                        const Table &B, Table &C)
+{
+   const int *i_A     = A.GetI();
+   const int *j_A     = A.GetJ();
+   const int *i_B     = B.GetI();
+   const int *j_B     = B.GetJ();
+   const int  nrows_A = A.Size();
+   const int  ncols_B = B.Width();
+   const int  nb      = pool.NumThreads();
+
+   C.SetDims(nrows_A, 0);
+   int *i_C = C.GetI();
+
+   std::vector<std::vector<int>> markers(nb);
+   pool.ParallelFor(nb, [&](int b)
+   {
+      int begin, end;
+      TableBlock(nrows_A, nb, b, begin, end);
+      std::vector<int> &B_marker = markers[b];
+      B_marker.assign(ncols_B, -1);
+      for (int i = begin; i < end; i++)
+      {
+         int counter = 0;
+         for (int j = i_A[i]; j < i_A[i+1]; j++)
+         {
+            const int k = j_A[j];
+            for (int l = i_B[k]; l < i_B[k+1]; l++)
+            {
+               const int m = j_B[l];
+               if (B_marker[m] != i)
+               {
+                  B_marker[m] = i;
+                  counter++;
+               }
+            }
+         }
+         i_C[i+1] = counter;
+      }
+   });
+   TablePrefixSum(pool, i_C, nrows_A);
+
+   Memory<int> &J = C.GetJMemory();
+   J.Delete();
+   (i_C[nrows_A] > 0) ? J.New(i_C[nrows_A]) : J.Reset();
+   int *j_C = C.GetJ();
+
+   pool.ParallelFor(nb, [&](int b)
+   {
+      int begin, end;
+      TableBlock(nrows_A, nb, b, begin, end);
+      std::vector<int> &B_marker = markers[b];
+      std::fill(B_marker.begin(), B_marker.end(), -1);
+      for (int i = begin; i < end; i++)
+      {
+         int counter = i_C[i];
+         for (int j = i_A[i]; j < i_A[i+1]; j++)
+         {
+            const int k = j_A[j];
+            for (int l = i_B[k]; l < i_B[k+1]; l++)
+            {
+               const int m = j_B[l];
+               if (B_marker[m] != i)
+               {
+                  B_marker[m] = i;
+                  j_C[counter++] = m;
+               }
+            }
+         }
+      }
+   });
+}
+
+} // namespace internal
+
 void Transpose (const Table &A, Table &At, int ncols_A_)
 {
    const int *i_A     = A.GetI();
@@ -491,6 +654,13 @@ void Transpose (const Table &A, Table &At, int ncols_A_)
    const int  ncols_A = (ncols_A_ < 0) ? A.Width() : ncols_A_;
    const int  nnz_A   = i_A[nrows_A];
 
+   const int min_size = internal::table_threads_min_size;
+   if (ThreadPool *pool = ThreadPool::GlobalFor(nnz_A, min_size))
+   {
+      internal::TransposeThreads(*pool, A, At, ncols_A);
+      return;
+   }
+
    At.SetDims (ncols_A, nnz_A);
 
    int *i_At = At.GetI();
@@ -523,6 +693,12 @@ void Transpose (const Table &A, Table &At, int ncols_A_)
    i_At[0] = 0;
 }
 
+void Transpose(const Table &A, Table &At, ThreadPool &pool, int ncols_A_)
+{
+   internal::TransposeThreads(pool, A, At,
+                              (ncols_A_ < 0) ? A.Width() : ncols_A_);
+}
+
 Table * Transpose(const Table &A)
 {
    Table * At = new Table;
@@ -560,6 +736,13 @@ void Mult (const Table &A, const Table &B, Table &C)
    MFEM_VERIFY( ncols_A <= nrows_B, "Table size mismatch: ncols_A = " << ncols_A
                 << ", nrows_B = " << nrows_B);
 
+   const int min_size = internal::table_threads_min_size;
+   if (ThreadPool *pool = ThreadPool::GlobalFor(i_A[nrows_A], min_size))
+   {
+      internal::MultThreads(*pool, A, B, C);
+      return;
+   }
+
    Array<int> B_marker (ncols_B);
 
    for (i = 0; i < ncols_B; i++)
@@ -567,7 +750,7 @@ void Mult (const Table &A, const Table &B, Table &C)
       B_marker[i] = -1;
    }
 
-   int counter = 0;
+   std::int64_t nnz_C = 0;
    for (i = 0; i < nrows_A; i++)
    {
       for (j = i_A[i]; j < i_A[i+1]; j++)
@@ -579,13 +762,15 @@ void Mult (const Table &A, const Table &B, Table &C)
             if (B_marker[m] != i)
             {
                B_marker[m] = i;
-               counter++;
+               nnz_C++;
             }
          }
       }
    }
+   MFEM_VERIFY(nnz_C <= INT_MAX, "the number of entries of the Table, "
+               << nnz_C << ", exceeds the range of int");
 
-   C.SetDims (nrows_A, counter);
+   C.SetDims (nrows_A, int(nnz_C));
 
    for (i = 0; i < ncols_B; i++)
    {
@@ -594,7 +779,7 @@ void Mult (const Table &A, const Table &B, Table &C)
 
    int *i_C = C.GetI();
    int *j_C = C.GetJ();
-   counter = 0;
+   int counter = 0;
    for (i = 0; i < nrows_A; i++)
    {
       i_C[i] = counter;
@@ -616,6 +801,13 @@ void Mult (const Table &A, const Table &B, Table &C)
 }
 
 
+void Mult(const Table &A, const Table &B, Table &C, ThreadPool &pool)
+{
+   MFEM_VERIFY(A.Width() <= B.Size(), "Table size mismatch: ncols_A = "
+               << A.Width() << ", nrows_B = " << B.Size());
+   internal::MultThreads(pool, A, B, C);
+}
+
 Table * Mult (const Table &A, const Table &B)
 {
    Table * C = new Table;
@@ -23,6 +23,8 @@
 namespace mfem
 {
 
+class ThreadPool;
+
 /// Helper struct for defining a connectivity table, see Table::MakeFromList.
 struct Connection
 {
@@ -212,8 +214,14 @@ template <> inline void Swap<Table>(Table &a, Table &b)
 }
 
 ///  Transpose a Table
+/** If Backend::CPU_THREADS is enabled and @a A is large, the threads of
+    ThreadPool::Global() are used. The result does not depend on the number of
+    threads: the column (TYPE II) indices in each row of @a At are sorted. */
 void Transpose (const Table &A, Table &At, int ncols_A_ = -1);
 Table * Transpose (const Table &A);
+/// Transpose a Table using the threads of @a pool.
+void Transpose (const Table &A, Table &At, ThreadPool &pool,
+                int ncols_A_ = -1);
 
 ///  @brief Transpose an Array<int>.
 ///
@@ -224,8 +232,14 @@ Table * Transpose (const Table &A);
 void Transpose(const Array<int> &A, Table &At, int ncols_A_ = -1);
 
 ///  C = A * B  (as boolean matrices)
+/** If Backend::CPU_THREADS is enabled and @a A is large, the threads of
+    ThreadPool::Global() are used, with the same result as the sequential
+    version. An error is raised if the number of entries of @a C exceeds the
+    range of int. */
 void Mult (const Table &A, const Table &B, Table &C);
 Table * Mult (const Table &A, const Table &B);
+/// C = A * B (as boolean matrices) using the threads of @a pool.
+void Mult (const Table &A, const Table &B, Table &C, ThreadPool &pool);
 
 
 /** Data type STable. STable is similar to Table, but it's for symmetric
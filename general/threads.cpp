@@ -0,0 +1,323 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "threads.hpp"
+#include "device.hpp"
+#include "globals.hpp"
+#include "error.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <pthread.h>
+#include <sched.h>
+#define MFEM_THREADS_HAVE_AFFINITY
+#endif
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// Set while a thread executes a loop of a ThreadPool.
+static thread_local bool in_parallel = false;
+
+// Number of idle iterations a worker spins before blocking on the condition
+// variable. Kernels are usually launched back to back, so spinning for a short
+// while avoids the latency of a wake-up through the OS.
+static constexpr int spin_count = 1 << 14;
+
+// Each thread owns a sub-range [begin,end) of the current loop, packed in one
+// 64-bit word so that the owner (advancing 'begin') and the thieves (reducing
+// 'end') can both update it with a single compare-and-swap. The slices are
+// padded to two cache lines, so that two slices never share a line: operator
+// new[] does not honor over-aligned types before C++17.
+struct Slice
+{
+   std::atomic<std::uint64_t> range;
+   char pad[128 - sizeof(std::atomic<std::uint64_t>)];
+};
+
+static inline std::uint64_t Pack(int begin, int end)
+{
+   return (std::uint64_t(std::uint32_t(begin)) << 32) | std::uint32_t(end);
+}
+
+static inline int Begin(std::uint64_t r) { return int(r >> 32); }
+
+static inline int End(std::uint64_t r) { return int(r & 0xffffffffu); }
+
+class ThreadPool
+{
+   const int nt;
+   std::vector<std::thread> workers;
+   std::unique_ptr<Slice[]> slices;
+
+   // Current job.
+   mfem::ThreadPool::RangeFunction func = nullptr;
+   const void *ctx = nullptr;
+   int grain = 1;
+
+   std::mutex mtx;
+   std::condition_variable cv;
+   std::atomic<unsigned> generation{0};
+   std::atomic<int> pending{0};
+   std::atomic<bool> busy{false};
+   std::atomic<bool> stop{false};
+
+   // Pop the next chunk from the front of slice 'tid'.
+   bool Pop(int tid, int &b, int &e)
+   {
+      std::atomic<std::uint64_t> &r = slices[tid].range;
+      std::uint64_t cur = r.load(std::memory_order_relaxed);
+      while (Begin(cur) < End(cur))
+      {
+         b = Begin(cur);
+         e = std::min(b + grain, End(cur));
+         if (r.compare_exchange_weak(cur, Pack(e, End(cur)),
+                                     std::memory_order_relaxed))
+         {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   // Steal the back half of the largest remaining slice of another thread and
+   // make it the new slice of thread 'tid'.
+   bool Steal(int tid)
+   {
+      while (true)
+      {
+         int victim = -1, largest = 0;
+         std::uint64_t cur = 0;
+         for (int i = 1; i < nt; i++)
+         {
+            const int v = (tid + i) % nt;
+            const std::uint64_t r =
+               slices[v].range.load(std::memory_order_relaxed);
+            const int size = End(r) - Begin(r);
+            if (size > largest) { victim = v; largest = size; cur = r; }
+         }
+         if (victim < 0) { return false; }
+
+         const int mid = Begin(cur) + largest/2;
+         if (slices[victim].range.compare_exchange_strong(
+                cur, Pack(Begin(cur), mid), std::memory_order_relaxed))
+         {
+            slices[tid].range.store(Pack(mid, End(cur)),
+                                    std::memory_order_relaxed);
+            return true;
+         }
+      }
+   }
+
+   void Execute(int tid)
+   {
+      in_parallel = true;
+      int b, e;
+      do
+      {
+         while (Pop(tid, b, e)) { func(ctx, b, e); }
+      }
+      while (Steal(tid));
+      in_parallel = false;
+   }
+
+   void Work(int tid)
+   {
+      unsigned seen = 0;
+      while (true)
+      {
+         int spin = 0;
+         while (generation.load(std::memory_order_acquire) == seen &&
+                spin < spin_count)
+         {
+            spin++;
+            std::this_thread::yield();
+         }
+         if (generation.load(std::memory_order_acquire) == seen)
+         {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]
+            {
+               return stop || generation.load(std::memory_order_acquire) != seen;
+            });
+         }
+         if (stop) { return; }
+         seen = generation.load(std::memory_order_acquire);
+         Execute(tid);
+         pending.fetch_sub(1, std::memory_order_release);
+      }
+   }
+
+public:
+   explicit ThreadPool(int num_threads)
+      : nt(num_threads > 0 ? num_threads :
+           std::max(1, int(std::thread::hardware_concurrency()))),
+        slices(new Slice[nt])
+   {
+      for (int t = 0; t < nt; t++) { slices[t].range.store(0); }
+      workers.reserve(nt - 1);
+      for (int t = 1; t < nt; t++)
+      {
+         workers.emplace_back(&ThreadPool::Work, this, t);
+      }
+   }
+
+   ~ThreadPool()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         stop.store(true);
+      }
+      cv.notify_all();
+      for (std::thread &w : workers) { w.join(); }
+   }
+
+   int NumThreads() const { return nt; }
+
+   bool Bind()
+   {
+#ifdef MFEM_THREADS_HAVE_AFFINITY
+      cpu_set_t mask;
+      if (sched_getaffinity(0, sizeof(mask), &mask) != 0) { return false; }
+      std::vector<int> cpus;
+      for (int c = 0; c < CPU_SETSIZE; c++)
+      {
+         if (CPU_ISSET(c, &mask)) { cpus.push_back(c); }
+      }
+      if (cpus.empty()) { return false; }
+      bool ok = true;
+      for (int t = 0; t < nt; t++)
+      {
+         cpu_set_t cpu;
+         CPU_ZERO(&cpu);
+         CPU_SET(cpus[t % cpus.size()], &cpu);
+         const pthread_t th = (t == 0) ? pthread_self() :
+                              workers[t-1].native_handle();
+         ok = (pthread_setaffinity_np(th, sizeof(cpu), &cpu) == 0) && ok;
+      }
+      return ok;
+#else
+      return false;
+#endif
+   }
+
+   void Run(int N, mfem::ThreadPool::RangeFunction f, const void *c)
+   {
+      if (N <= 0) { return; }
+      if (nt == 1 || N == 1 || in_parallel || busy.exchange(true))
+      {
+         f(c, 0, N);
+         return;
+      }
+
+      func = f;
+      ctx = c;
+      // Chunks small enough to balance the load through stealing, but large
+      // enough to amortize the atomic operations.
+      grain = std::max(1, N/(16*nt));
+      for (int t = 0; t < nt; t++)
+      {
+         const int b = int((std::int64_t(N)*t)/nt);
+         const int e = int((std::int64_t(N)*(t+1))/nt);
+         slices[t].range.store(Pack(b, e), std::memory_order_relaxed);
+      }
+      pending.store(nt - 1, std::memory_order_relaxed);
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         generation.fetch_add(1, std::memory_order_release);
+      }
+      cv.notify_all();
+
+      Execute(0);
+
+      while (pending.load(std::memory_order_acquire) > 0)
+      {
+         std::this_thread::yield();
+      }
+      busy.store(false, std::memory_order_release);
+   }
+};
+
+static int global_num_threads = 0;
+static std::atomic<mfem::ThreadPool*> global_pool(nullptr);
+
+} // namespace internal
+
+ThreadPool::ThreadPool(int num_threads)
+   : P(new internal::ThreadPool(num_threads)) { }
+
+ThreadPool::~ThreadPool() = default;
+
+int ThreadPool::NumThreads() const { return P->NumThreads(); }
+
+bool ThreadPool::Bind() { return P->Bind(); }
+
+void ThreadPool::Run(int N, RangeFunction f, const void *ctx)
+{
+   P->Run(N, f, ctx);
+}
+
+bool ThreadPool::InParallel() { return internal::in_parallel; }
+
+ThreadPool &ThreadPool::Global()
+{
+   // The global pool is never destroyed: its (idle) workers are terminated at
+   // program exit, so kernels can still be launched from static destructors.
+   static ThreadPool *pool = []
+   {
+      int nt = internal::global_num_threads;
+      if (nt <= 0 && GetEnv("MFEM_NUM_THREADS"))
+      {
+         nt = std::atoi(GetEnv("MFEM_NUM_THREADS"));
+      }
+      ThreadPool *p = new ThreadPool(nt);
+      const char *bind = GetEnv("MFEM_THREADS_BIND");
+      if (bind && std::atoi(bind) != 0) { p->Bind(); }
+      internal::global_pool.store(p);
+      return p;
+   }();
+   return *pool;
+}
+
+void ThreadPool::Configure(int num_threads)
+{
+   const ThreadPool *pool = internal::global_pool.load();
+   if (pool && num_threads > 0 && num_threads != pool->NumThreads())
+   {
+      MFEM_WARNING("the global ThreadPool already has " << pool->NumThreads()
+                   << " threads, ignoring the request for " << num_threads);
+   }
+   internal::global_num_threads = num_threads;
+}
+
+ThreadPool *ThreadPool::GlobalFor(int size, int min_size)
+{
+   if (size < min_size || !Device::Allows(Backend::CPU_THREADS) ||
+       InParallel())
+   {
+      return nullptr;
+   }
+   ThreadPool &pool = Global();
+   return (pool.NumThreads() > 1) ? &pool : nullptr;
+}
+
+} // namespace mfem
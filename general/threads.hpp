@@ -0,0 +1,120 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_THREADS_HPP
+#define MFEM_THREADS_HPP
+
+#include "../config/config.hpp"
+#include <memory>
+#include <type_traits>
+
+namespace mfem
+{
+
+namespace internal
+{
+class ThreadPool;
+}
+
+/** @brief Persistent pool of std::thread workers with work-stealing loop
+    scheduling, used by Backend::CPU_THREADS. */
+/** A call to ParallelFor() splits the iteration range [0,N) into one contiguous
+    slice per thread (the calling thread is one of them). Each thread processes
+    its own slice front to back in small chunks and, once it runs out of work,
+    steals the back half of the largest remaining slice of another thread.
+
+    Since the initial slices only depend on N and on the number of threads,
+    a thread keeps touching the same part of an array from one kernel to the
+    next, unless load imbalance forces it to steal. Combined with the
+    first-touch page placement policy of the OS (and, optionally, with pinning
+    of the threads, see Bind()), this keeps most memory accesses NUMA-local.
+
+    Calls to ParallelFor() from inside a running loop, or from a second thread
+    while the pool is busy, are executed sequentially by the calling thread. */
+class ThreadPool
+{
+public:
+   /// Type of the functions executed by the pool on a sub-range [begin,end).
+   typedef void (*RangeFunction)(const void *ctx, int begin, int end);
+
+private:
+   std::unique_ptr<internal::ThreadPool> P; ///< Pointer to implementation.
+
+public:
+   /** @brief Create a pool with @a num_threads threads, including the calling
+       thread. If @a num_threads <= 0, use the number of hardware threads. */
+   explicit ThreadPool(int num_threads = 0);
+
+   ThreadPool(const ThreadPool &) = delete;
+   ThreadPool &operator=(const ThreadPool &) = delete;
+
+   /// Join all worker threads.
+   ~ThreadPool();
+
+   /// Return the number of threads, including the calling thread.
+   int NumThreads() const;
+
+   /** @brief Pin thread k of the pool to the k-th CPU (modulo the number of
+       CPUs) of the affinity mask of the process. */
+   /** The calling thread is pinned too. This is a no-op on platforms without
+       pthread_setaffinity_np(). Returns true on success. */
+   bool Bind();
+
+   /** @brief Execute @a f(ctx, begin, end) on disjoint sub-ranges covering
+       [0,N). Returns after all sub-ranges have been processed. */
+   void Run(int N, RangeFunction f, const void *ctx);
+
+   /// Execute @a body(k) for k in [0,N) using the threads of the pool.
+   template <typename lambda>
+   void ParallelFor(int N, lambda &&body)
+   {
+      typedef typename std::remove_reference<lambda>::type body_t;
+      Run(N, [](const void *ctx, int begin, int end)
+      {
+         const body_t &b = *static_cast<const body_t*>(ctx);
+         for (int k = begin; k < end; k++) { b(k); }
+      }, &body);
+   }
+
+   /// Return true if the calling thread is executing a ParallelFor() loop.
+   static bool InParallel();
+
+   /// Return the global pool used by Backend::CPU_THREADS.
+   /** The pool is created on first use. Its size is set by Configure() or,
+       otherwise, by the environment variable MFEM_NUM_THREADS. If the variable
+       MFEM_THREADS_BIND is set to a non-zero value, the threads are pinned with
+       Bind(). */
+   static ThreadPool &Global();
+
+   /** @brief Set the number of threads of the Global() pool. Must be called
+       before the first use of the pool, e.g. from Device::Configure(). */
+   /** The pool is never resized: once it exists, a different number of
+       threads is ignored with a warning. */
+   static void Configure(int num_threads);
+
+   /** @brief Return the Global() pool for a host algorithm working on @a size
+       entries, or nullptr if the algorithm should run sequentially. */
+   /** The pool is returned if Backend::CPU_THREADS is enabled, @a size is at
+       least @a min_size, the calling thread is not executing a ParallelFor()
+       loop and the pool has more than one thread. */
+   static ThreadPool *GlobalFor(int size, int min_size);
+};
+
+/// Backend::CPU_THREADS forall backend.
+template <typename HBODY>
+void ThreadsWrap(const int N, HBODY &&h_body)
+{
+   ThreadPool::Global().ParallelFor(N, h_body);
+}
+
+} // namespace mfem
+
+#endif // MFEM_THREADS_HPP
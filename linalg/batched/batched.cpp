@@ -11,6 +11,7 @@
 
 #include "batched.hpp"
 #include "native.hpp"
+#include "cpu_simd.hpp"
 #include "gpu_blas.hpp"
 #include "magma.hpp"
 
@@ -20,6 +21,7 @@ namespace mfem
 BatchedLinAlg::BatchedLinAlg()
 {
    backends[NATIVE].reset(new NativeBatchedLinAlg);
+   backends[CPU_SIMD].reset(new CPUSIMDBatchedLinAlg);
 
    if (Device::Allows(mfem::Backend::CUDA_MASK | mfem::Backend::HIP_MASK))
    {
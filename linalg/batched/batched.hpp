@@ -45,6 +45,10 @@ public:
       GPU_BLAS,
       /// MAGMA backend, only available if MFEM is compiled with MAGMA support.
       MAGMA,
+      /// @brief Host backend processing several matrices at once in SIMD lanes,
+      /// see CPUSIMDBatchedLinAlg. Not active by default, see
+      /// SetActiveBackend().
+      CPU_SIMD,
       /// Counter for the number of backends.
       NUM_BACKENDS
    };
@@ -0,0 +1,316 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../kernels.hpp"
+#include "../densemat_batch.hpp"
+#include "cpu_simd.hpp"
+#include "../../general/threads.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+typedef DenseMatrixBatch::vreal_t vreal_t;
+static constexpr int LANES = DenseMatrixBatch::lanes;
+
+// Execute f(i) for i in [0,N), with the threads of the global ThreadPool if
+// Backend::CPU_THREADS is enabled.
+template <typename lambda>
+static void ParallelFor(int N, lambda &&f)
+{
+   mfem::ThreadPool *pool = mfem::ThreadPool::GlobalFor(N, 2);
+   if (pool) { pool->ParallelFor(N, f); }
+   else { for (int i = 0; i < N; i++) { f(i); } }
+}
+
+// Copy the n x n matrices [b*LANES, (b+1)*LANES) of T into the block Ab. The
+// lanes beyond the n_mat matrices of T are set to the identity.
+static void GatherBlock(const real_t *T, int n, int n_mat, int b, vreal_t *Ab)
+{
+   for (int l = 0; l < LANES; l++)
+   {
+      const int k = b*LANES + l;
+      if (k < n_mat)
+      {
+         const real_t *Tk = T + k*n*n;
+         for (int i = 0; i < n*n; i++) { Ab[i][l] = Tk[i]; }
+      }
+      else
+      {
+         for (int i = 0; i < n*n; i++) { Ab[i][l] = (i%(n + 1) == 0); }
+      }
+   }
+}
+
+// Copy the block Ab into the n x n matrices [b*LANES, (b+1)*LANES) of T.
+static void ScatterBlock(const vreal_t *Ab, int n, int n_mat, int b, real_t *T)
+{
+   for (int l = 0; l < LANES && b*LANES + l < n_mat; l++)
+   {
+      real_t *Tk = T + (b*LANES + l)*n*n;
+      for (int i = 0; i < n*n; i++) { Tk[i] = Ab[i][l]; }
+   }
+}
+
+// LU factorization with partial pivoting of the n x n matrices of the block A.
+// The pivot of step i in lane l is stored in piv[i*LANES + l]. Returns false if
+// a pivot is zero.
+static bool LUFactorBlock(int n, vreal_t *A, int *piv)
+{
+   bool ok = true;
+   for (int i = 0; i < n; i++)
+   {
+      // Pivoting, independently in each lane
+      for (int l = 0; l < LANES; l++)
+      {
+         int p = i;
+         real_t a = std::abs(A[i + i*n][l]);
+         for (int j = i + 1; j < n; j++)
+         {
+            const real_t b = std::abs(A[j + i*n][l]);
+            if (b > a) { a = b; p = j; }
+         }
+         piv[i*LANES + l] = p;
+         if (p != i)
+         {
+            for (int j = 0; j < n; j++)
+            {
+               std::swap(A[i + j*n][l], A[p + j*n][l]);
+            }
+         }
+         ok = ok && (a > 0.0);
+      }
+
+      vreal_t a_ii_inv;
+      a_ii_inv = 1.0;
+      a_ii_inv /= A[i + i*n];
+      for (int j = i + 1; j < n; j++) { A[j + i*n] *= a_ii_inv; }
+      for (int k = i + 1; k < n; k++)
+      {
+         const vreal_t a_ik = A[i + k*n];
+         for (int j = i + 1; j < n; j++) { A[j + k*n] -= a_ik*A[j + i*n]; }
+      }
+   }
+   return ok;
+}
+
+// Replace the block vector x with A^{-1} x, given the LU factors and pivots of
+// the matrices of the block A from LUFactorBlock().
+static void LUSolveBlock(int n, const vreal_t *LU, const int *piv, vreal_t *x)
+{
+   // x <- P x
+   for (int i = 0; i < n; i++)
+   {
+      for (int l = 0; l < LANES; l++)
+      {
+         const int p = piv[i*LANES + l];
+         if (p != i) { std::swap(x[i][l], x[p][l]); }
+      }
+   }
+   // x <- L^{-1} x
+   for (int j = 0; j < n; j++)
+   {
+      const vreal_t x_j = x[j];
+      for (int i = j + 1; i < n; i++) { x[i] -= LU[i + j*n]*x_j; }
+   }
+   // x <- U^{-1} x
+   for (int j = n - 1; j >= 0; j--)
+   {
+      x[j] /= LU[j + j*n];
+      const vreal_t x_j = x[j];
+      for (int i = 0; i < j; i++) { x[i] -= LU[i + j*n]*x_j; }
+   }
+}
+
+} // namespace internal
+
+void CPUSIMDBatchedLinAlg::AddMult(const DenseTensor &A, const Vector &x,
+                                   Vector &y, real_t alpha, real_t beta,
+                                   Op op) const
+{
+   const bool tr = (op == Op::T);
+
+   const int m = A.SizeI();
+   const int n = A.SizeJ();
+   const int n_mat = A.SizeK();
+   const int k = x.Size() / (tr ? m : n) / n_mat;
+
+   const real_t *d_A = A.HostRead();
+   const real_t *d_x = x.HostRead();
+   real_t *d_y = beta == 0.0 ? y.HostWrite() : y.HostReadWrite();
+   const int nx = (tr ? m : n)*k, ny = (tr ? n : m)*k;
+
+   internal::ParallelFor(n_mat, [=](int i)
+   {
+      if (tr)
+      {
+         kernels::AddMultAtB(m, n, k, d_A + i*m*n, d_x + i*nx, d_y + i*ny,
+                             alpha, beta);
+      }
+      else
+      {
+         kernels::AddMult(m, k, n, d_A + i*m*n, d_x + i*nx, d_y + i*ny,
+                          alpha, beta);
+      }
+   });
+}
+
+void CPUSIMDBatchedLinAlg::Invert(DenseTensor &A) const
+{
+   const int n = A.SizeI();
+   const int n_mat = A.SizeK();
+   if (n_mat == 0) { return; }
+   DenseMatrixBatch LU(n, n, n_mat), Inv(n, n, n_mat);
+   Array<int> piv(n*DenseMatrixBatch::lanes*LU.NumBlocks());
+   Array<bool> ok(LU.NumBlocks());
+
+   using internal::vreal_t;
+   real_t *d_A = A.HostReadWrite();
+   vreal_t *d_LU = LU.GetBlock(0), *d_Inv = Inv.GetBlock(0);
+   int *d_piv = piv.HostWrite();
+   bool *d_ok = ok.HostWrite();
+   internal::ParallelFor(LU.NumBlocks(), [&](int b)
+   {
+      vreal_t *LUb = d_LU + b*n*n, *Invb = d_Inv + b*n*n;
+      int *pivb = d_piv + b*n*DenseMatrixBatch::lanes;
+      internal::GatherBlock(d_A, n, n_mat, b, LUb);
+      d_ok[b] = internal::LUFactorBlock(n, LUb, pivb);
+      // Column j of the inverse is A^{-1} e_j.
+      for (int j = 0; j < n; j++)
+      {
+         vreal_t *x = Invb + j*n;
+         for (int i = 0; i < n; i++) { x[i] = (i == j) ? 1.0 : 0.0; }
+         internal::LUSolveBlock(n, LUb, pivb, x);
+      }
+      internal::ScatterBlock(Invb, n, n_mat, b, d_A);
+   });
+   MFEM_VERIFY(std::all_of(d_ok, d_ok + ok.Size(), [](bool v) { return v; }),
+               "Batch LU factorization failed");
+}
+
+void CPUSIMDBatchedLinAlg::LUFactor(DenseTensor &A, Array<int> &P,
+                                    Factors &factors) const
+{
+   const int n = A.SizeI();
+   const int n_mat = A.SizeK();
+   P.SetSize(n*n_mat);
+   factors.LU.SetSize(n, n, n_mat);
+   if (n_mat == 0) { return; }
+   const int L = DenseMatrixBatch::lanes;
+   factors.piv.SetSize(n*L*factors.LU.NumBlocks());
+   Array<bool> ok(factors.LU.NumBlocks());
+
+   real_t *d_A = A.HostReadWrite();
+   internal::vreal_t *d_LU = factors.LU.GetBlock(0);
+   int *d_P = P.HostWrite();
+   int *d_piv = factors.piv.HostWrite();
+   bool *d_ok = ok.HostWrite();
+   internal::ParallelFor(factors.LU.NumBlocks(), [&](int b)
+   {
+      internal::vreal_t *LUb = d_LU + b*n*n;
+      int *pivb = d_piv + b*n*L;
+      internal::GatherBlock(d_A, n, n_mat, b, LUb);
+      d_ok[b] = internal::LUFactorBlock(n, LUb, pivb);
+      internal::ScatterBlock(LUb, n, n_mat, b, d_A);
+      for (int l = 0; l < L && b*L + l < n_mat; l++)
+      {
+         for (int i = 0; i < n; i++) { d_P[i + (b*L + l)*n] = pivb[i*L + l]; }
+      }
+   });
+   MFEM_VERIFY(std::all_of(d_ok, d_ok + ok.Size(), [](bool v) { return v; }),
+               "Batch LU factorization failed");
+}
+
+void CPUSIMDBatchedLinAlg::LUFactor(DenseTensor &A, Array<int> &P) const
+{
+   Factors factors;
+   LUFactor(A, P, factors);
+}
+
+void CPUSIMDBatchedLinAlg::LUSolve(const Factors &factors, Vector &x) const
+{
+   const int n = factors.Size();
+   const int n_mat = factors.NumMatrices();
+   if (n_mat == 0) { return; }
+   const int n_rhs = x.Size() / n / n_mat;
+   const int L = DenseMatrixBatch::lanes;
+   DenseMatrixBatch X(n, n_rhs, n_mat);
+
+   using internal::vreal_t;
+   const vreal_t *d_LU = factors.LU.GetBlock(0);
+   const int *d_piv = factors.piv.HostRead();
+   vreal_t *d_X = X.GetBlock(0);
+   real_t *d_x = x.HostReadWrite();
+   internal::ParallelFor(X.NumBlocks(), [&](int b)
+   {
+      const vreal_t *LUb = d_LU + b*n*n;
+      const int *pivb = d_piv + b*n*L;
+      vreal_t *Xb = d_X + b*n*n_rhs;
+      for (int l = 0; l < L; l++)
+      {
+         const int k = b*L + l;
+         for (int i = 0; i < n; i++)
+         {
+            for (int r = 0; r < n_rhs; r++)
+            {
+               Xb[i + r*n][l] = (k < n_mat) ? d_x[i + r*n + k*n*n_rhs] : 0.0;
+            }
+         }
+      }
+      for (int r = 0; r < n_rhs; r++)
+      {
+         internal::LUSolveBlock(n, LUb, pivb, Xb + r*n);
+      }
+      for (int l = 0; l < L && b*L + l < n_mat; l++)
+      {
+         const int k = b*L + l;
+         for (int i = 0; i < n*n_rhs; i++) { d_x[i + k*n*n_rhs] = Xb[i][l]; }
+      }
+   });
+}
+
+void CPUSIMDBatchedLinAlg::LUSolve(const DenseTensor &LU, const Array<int> &P,
+                                   Vector &x) const
+{
+   const int n = LU.SizeI();
+   const int n_mat = LU.SizeK();
+   if (n_mat == 0) { return; }
+   const int L = DenseMatrixBatch::lanes;
+
+   // Gather the factors and the pivots into the interleaved layout
+   Factors factors;
+   factors.LU.SetSize(n, n, n_mat);
+   factors.piv.SetSize(n*L*factors.LU.NumBlocks());
+   const real_t *d_LU = LU.HostRead();
+   const int *d_P = P.HostRead();
+   internal::vreal_t *d_LUb = factors.LU.GetBlock(0);
+   int *d_piv = factors.piv.HostWrite();
+   internal::ParallelFor(factors.LU.NumBlocks(), [&](int b)
+   {
+      internal::GatherBlock(d_LU, n, n_mat, b, d_LUb + b*n*n);
+      for (int l = 0; l < L; l++)
+      {
+         const int k = b*L + l;
+         for (int i = 0; i < n; i++)
+         {
+            d_piv[b*n*L + i*L + l] = (k < n_mat) ? d_P[i + k*n] : i;
+         }
+      }
+   });
+   LUSolve(factors, x);
+}
+
+}
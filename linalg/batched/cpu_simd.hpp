@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_CPU_SIMD_LINALG
+#define MFEM_CPU_SIMD_LINALG
+
+#include "batched.hpp"
+#include "../densemat_batch.hpp"
+
+namespace mfem
+{
+
+/** @brief Host backend of BatchedLinAlg that factors and solves
+    DenseMatrixBatch::lanes matrices at once, in the SIMD lanes of the
+    interleaved layout of DenseMatrixBatch. */
+/** The matrices are gathered block by block into the interleaved layout, and
+    the blocks are processed with the threads of ThreadPool::Global() when
+    Backend::CPU_THREADS is enabled. The pivots are chosen independently in
+    each lane, as in NativeBatchedLinAlg, and the LU factors and the pivots
+    have the same format, so that LUFactor() and LUSolve() may be mixed with
+    the NATIVE backend. The matrix products, which are limited by the memory
+    bandwidth, are computed matrix by matrix.
+
+    LUSolve() gathers the factors into the interleaved layout on every call.
+    To solve repeatedly with the same factors, keep them in the interleaved
+    layout with the Factors overloads of LUFactor() and LUSolve(). */
+class CPUSIMDBatchedLinAlg : public BatchedLinAlgBase
+{
+public:
+   /// LU factors and pivots of a batch of matrices in the interleaved layout.
+   class Factors
+   {
+      friend class CPUSIMDBatchedLinAlg;
+      DenseMatrixBatch LU;
+      Array<int> piv; ///< Pivots, interleaved as the lanes of LU.
+   public:
+      /// Size of the factored matrices.
+      int Size() const { return LU.Height(); }
+      /// Number of factored matrices.
+      int NumMatrices() const { return LU.NumMatrices(); }
+   };
+
+   void AddMult(const DenseTensor &A, const Vector &x, Vector &y,
+                real_t alpha, real_t beta, Op op) const override;
+   void Invert(DenseTensor &A) const override;
+   void LUFactor(DenseTensor &A, Array<int> &P) const override;
+   void LUSolve(const DenseTensor &LU, const Array<int> &P,
+                Vector &x) const override;
+
+   /** @brief Factor the matrices of @a A as LUFactor(DenseTensor&,
+       Array<int>&), and also store the factors and the pivots in the
+       interleaved layout in @a factors. */
+   void LUFactor(DenseTensor &A, Array<int> &P, Factors &factors) const;
+   /** @brief Replace @a x with the solutions of the systems factored in
+       @a factors, see BatchedLinAlg::LUSolve(). */
+   void LUSolve(const Factors &factors, Vector &x) const;
+};
+
+} // namespace mfem
+
+#endif
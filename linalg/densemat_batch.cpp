@@ -0,0 +1,384 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "densemat_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mfem
+{
+
+void DenseMatrixBatch::SetSize(int m, int n, int k)
+{
+   height = m;
+   width = n;
+   nmat = k;
+   nblocks = (k + lanes - 1)/lanes;
+   data.SetSize(nblocks*lanes*m*n, MemoryType::HOST_64);
+   data = 0.0;
+}
+
+DenseMatrixBatch &DenseMatrixBatch::operator=(const DenseMatrixBatch &other)
+{
+   if (this == &other) { return *this; }
+   if (height*width*nblocks != other.height*other.width*other.nblocks)
+   {
+      SetSize(other.height, other.width, other.nmat);
+   }
+   height = other.height;
+   width = other.width;
+   nmat = other.nmat;
+   nblocks = other.nblocks;
+   data = other.data;
+   return *this;
+}
+
+DenseMatrixBatch &DenseMatrixBatch::operator=(real_t value)
+{
+   data = value;
+   return *this;
+}
+
+void DenseMatrixBatch::SetMatrix(int k, const DenseMatrix &A)
+{
+   MFEM_ASSERT(A.Height() == height && A.Width() == width,
+               "incompatible matrix size");
+   vreal_t *Ab = GetBlock(k/lanes);
+   const int l = k%lanes;
+   for (int i = 0; i < height*width; i++) { Ab[i][l] = A.GetData()[i]; }
+}
+
+void DenseMatrixBatch::GetMatrix(int k, DenseMatrix &A) const
+{
+   A.SetSize(height, width);
+   const vreal_t *Ab = GetBlock(k/lanes);
+   const int l = k%lanes;
+   for (int i = 0; i < height*width; i++) { A.GetData()[i] = Ab[i][l]; }
+}
+
+void DenseMatrixBatch::CopyFrom(const DenseTensor &T)
+{
+   const int m = T.SizeI(), n = T.SizeJ(), nk = T.SizeK();
+   SetSize(m, n, nk);
+   const real_t *d_T = T.HostRead();
+   vreal_t *d_A = reinterpret_cast<vreal_t*>(data.HostReadWrite());
+   for (int k = 0; k < nk; k++)
+   {
+      vreal_t *Ab = d_A + (k/lanes)*m*n;
+      for (int i = 0; i < m*n; i++) { Ab[i][k%lanes] = d_T[i + k*m*n]; }
+   }
+}
+
+void DenseMatrixBatch::CopyTo(DenseTensor &T) const
+{
+   const int m = height, n = width;
+   T.SetSize(m, n, nmat);
+   real_t *d_T = T.HostWrite();
+   const vreal_t *d_A = reinterpret_cast<const vreal_t*>(data.HostRead());
+   for (int k = 0; k < nmat; k++)
+   {
+      const vreal_t *Ab = d_A + (k/lanes)*m*n;
+      for (int i = 0; i < m*n; i++) { d_T[i + k*m*n] = Ab[i][k%lanes]; }
+   }
+}
+
+namespace internal
+{
+
+typedef DenseMatrixBatch::vreal_t vreal_t;
+
+// C = A B (ADD = false) or C += a A B (ADD = true), for the blocks of M x K
+// matrices A and K x N matrices B.
+template <bool ADD, int T_M = 0, int T_K = 0, int T_N = 0>
+static void BatchMult(const int nblocks, const int m, const int k, const int n,
+                      const vreal_t *A, const vreal_t *B, vreal_t *C,
+                      const real_t a)
+{
+   const int M = T_M ? T_M : m;
+   const int K = T_K ? T_K : k;
+   const int N = T_N ? T_N : n;
+   for (int e = 0; e < nblocks; e++)
+   {
+      const vreal_t *Ae = A + e*M*K;
+      const vreal_t *Be = B + e*K*N;
+      vreal_t *Ce = C + e*M*N;
+      for (int j = 0; j < N; j++)
+      {
+         for (int i = 0; i < M; i++)
+         {
+            vreal_t s;
+            s = 0.0;
+            for (int l = 0; l < K; l++) { s.fma(Ae[i + l*M], Be[l + j*K]); }
+            if (ADD) { Ce[i + j*M].fma(s, a); }
+            else { Ce[i + j*M] = s; }
+         }
+      }
+   }
+}
+
+template <bool ADD>
+static void BatchMult(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+                      DenseMatrixBatch &C, real_t a)
+{
+   const int nb = A.NumBlocks();
+   const int m = A.Height(), k = A.Width(), n = B.Width();
+   const vreal_t *d_A = A.GetBlock(0), *d_B = B.GetBlock(0);
+   vreal_t *d_C = C.GetBlock(0);
+   const int id = (m == k && k == n) ? m : 0;
+   switch (id)
+   {
+      case 2: return BatchMult<ADD,2,2,2>(nb, m, k, n, d_A, d_B, d_C, a);
+      case 3: return BatchMult<ADD,3,3,3>(nb, m, k, n, d_A, d_B, d_C, a);
+      default: return BatchMult<ADD>(nb, m, k, n, d_A, d_B, d_C, a);
+   }
+}
+
+// ABt = A B^t (ADD = false) or ABt += a A B^t (ADD = true), for the blocks of
+// M x K matrices A and N x K matrices B.
+template <bool ADD, int T_M = 0, int T_N = 0>
+static void BatchMultABt(const int nblocks, const int m, const int n,
+                         const int k, const vreal_t *A, const vreal_t *B,
+                         vreal_t *C, const real_t a)
+{
+   const int M = T_M ? T_M : m;
+   const int N = T_N ? T_N : n;
+   for (int e = 0; e < nblocks; e++)
+   {
+      const vreal_t *Ae = A + e*M*k;
+      const vreal_t *Be = B + e*N*k;
+      vreal_t *Ce = C + e*M*N;
+      for (int j = 0; j < N; j++)
+      {
+         for (int i = 0; i < M; i++)
+         {
+            vreal_t s;
+            s = 0.0;
+            for (int l = 0; l < k; l++) { s.fma(Ae[i + l*M], Be[j + l*N]); }
+            if (ADD) { Ce[i + j*M].fma(s, a); }
+            else { Ce[i + j*M] = s; }
+         }
+      }
+   }
+}
+
+template <bool ADD>
+static void BatchMultABt(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+                         DenseMatrixBatch &C, real_t a)
+{
+   const int nb = A.NumBlocks();
+   const int m = A.Height(), n = B.Height(), k = A.Width();
+   const vreal_t *d_A = A.GetBlock(0), *d_B = B.GetBlock(0);
+   vreal_t *d_C = C.GetBlock(0);
+   const int id = (m == n) ? m : 0;
+   switch (id)
+   {
+      case 2: return BatchMultABt<ADD,2,2>(nb, m, n, k, d_A, d_B, d_C, a);
+      case 3: return BatchMultABt<ADD,3,3>(nb, m, n, k, d_A, d_B, d_C, a);
+      default: return BatchMultABt<ADD>(nb, m, n, k, d_A, d_B, d_C, a);
+   }
+}
+
+// In-place inversion of the blocks of 1 x 1, 2 x 2 and 3 x 3 matrices, with
+// the adjugate formula.
+static void BatchInvert1(const int nblocks, vreal_t *A)
+{
+   for (int e = 0; e < nblocks; e++)
+   {
+      vreal_t one;
+      one = 1.0;
+      A[e] = one/A[e];
+   }
+}
+
+static void BatchInvert2(const int nblocks, vreal_t *A)
+{
+   for (int e = 0; e < nblocks; e++)
+   {
+      vreal_t *Ae = A + 4*e;
+      const vreal_t a00 = Ae[0], a10 = Ae[1], a01 = Ae[2], a11 = Ae[3];
+      vreal_t one;
+      one = 1.0;
+      const vreal_t id = one/(a00*a11 - a01*a10);
+      Ae[0] = a11*id;
+      Ae[1] = (a10*id)*(-1.0);
+      Ae[2] = (a01*id)*(-1.0);
+      Ae[3] = a00*id;
+   }
+}
+
+static void BatchInvert3(const int nblocks, vreal_t *A)
+{
+   for (int e = 0; e < nblocks; e++)
+   {
+      vreal_t *Ae = A + 9*e;
+      const vreal_t a00 = Ae[0], a10 = Ae[1], a20 = Ae[2];
+      const vreal_t a01 = Ae[3], a11 = Ae[4], a21 = Ae[5];
+      const vreal_t a02 = Ae[6], a12 = Ae[7], a22 = Ae[8];
+      const vreal_t c00 = a11*a22 - a12*a21;
+      const vreal_t c01 = a02*a21 - a01*a22;
+      const vreal_t c02 = a01*a12 - a02*a11;
+      vreal_t one;
+      one = 1.0;
+      const vreal_t id = one/(a00*c00 + a10*c01 + a20*c02);
+      Ae[0] = c00*id;
+      Ae[3] = c01*id;
+      Ae[6] = c02*id;
+      Ae[1] = (a12*a20 - a10*a22)*id;
+      Ae[4] = (a00*a22 - a02*a20)*id;
+      Ae[7] = (a02*a10 - a00*a12)*id;
+      Ae[2] = (a10*a21 - a11*a20)*id;
+      Ae[5] = (a01*a20 - a00*a21)*id;
+      Ae[8] = (a00*a11 - a01*a10)*id;
+   }
+}
+
+// In-place inversion of the blocks of n x n matrices with Gauss-Jordan
+// elimination. The pivot rows are chosen independently in each lane and the
+// rows are swapped lane by lane; the elimination is vectorized.
+static void BatchInvertGJ(const int nblocks, const int n, vreal_t *A)
+{
+   const int L = vreal_t::size;
+   Array<int> perm(n*L);
+   for (int e = 0; e < nblocks; e++)
+   {
+      vreal_t *Ae = A + e*n*n;
+      for (int c = 0; c < n; c++)
+      {
+         // Partial pivoting in each lane
+         for (int l = 0; l < L; l++)
+         {
+            int p = c;
+            real_t amax = std::abs(Ae[c + c*n][l]);
+            for (int r = c + 1; r < n; r++)
+            {
+               const real_t ar = std::abs(Ae[r + c*n][l]);
+               if (ar > amax) { amax = ar; p = r; }
+            }
+            perm[c*L + l] = p;
+            if (p != c)
+            {
+               for (int j = 0; j < n; j++)
+               {
+                  std::swap(Ae[c + j*n][l], Ae[p + j*n][l]);
+               }
+            }
+         }
+         // Gauss-Jordan step, storing the inverse in place
+         vreal_t one;
+         one = 1.0;
+         const vreal_t ip = one/Ae[c + c*n];
+         Ae[c + c*n] = one;
+         for (int j = 0; j < n; j++) { Ae[c + j*n] *= ip; }
+         for (int r = 0; r < n; r++)
+         {
+            if (r == c) { continue; }
+            const vreal_t f = Ae[r + c*n];
+            Ae[r + c*n] = 0.0;
+            for (int j = 0; j < n; j++) { Ae[r + j*n] -= f*Ae[c + j*n]; }
+         }
+      }
+      // Undo the row swaps as column swaps, in reverse order
+      for (int c = n - 1; c >= 0; c--)
+      {
+         for (int l = 0; l < L; l++)
+         {
+            const int p = perm[c*L + l];
+            if (p == c) { continue; }
+            for (int i = 0; i < n; i++)
+            {
+               std::swap(Ae[i + c*n][l], Ae[i + p*n][l]);
+            }
+         }
+      }
+   }
+}
+
+} // namespace internal
+
+void DenseMatrixBatch::Invert()
+{
+   MFEM_VERIFY(height == width, "the matrices must be square");
+   if (nmat == 0) { return; }
+   const int n = height;
+   // The padding matrices are set to the identity.
+   vreal_t *Al = GetBlock(nblocks - 1);
+   for (int l = nmat - (nblocks - 1)*lanes; l < lanes; l++)
+   {
+      for (int i = 0; i < n*n; i++) { Al[i][l] = (i%(n + 1) == 0) ? 1.0 : 0.0; }
+   }
+   vreal_t *d_A = GetBlock(0);
+   switch (n)
+   {
+      case 1: internal::BatchInvert1(nblocks, d_A); break;
+      case 2: internal::BatchInvert2(nblocks, d_A); break;
+      case 3: internal::BatchInvert3(nblocks, d_A); break;
+      default: internal::BatchInvertGJ(nblocks, n, d_A); break;
+   }
+}
+
+void Mult(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+          DenseMatrixBatch &C)
+{
+   MFEM_VERIFY(A.Width() == B.Height() && A.NumMatrices() == B.NumMatrices(),
+               "incompatible batches");
+   if (C.Height() != A.Height() || C.Width() != B.Width() ||
+       C.NumMatrices() != A.NumMatrices())
+   {
+      C.SetSize(A.Height(), B.Width(), A.NumMatrices());
+   }
+   if (A.NumMatrices() == 0) { return; }
+   internal::BatchMult<false>(A, B, C, 1.0);
+}
+
+void AddMult(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+             DenseMatrixBatch &C, real_t a)
+{
+   MFEM_VERIFY(A.Width() == B.Height() && A.Height() == C.Height() &&
+               B.Width() == C.Width() && A.NumMatrices() == B.NumMatrices() &&
+               A.NumMatrices() == C.NumMatrices(), "incompatible batches");
+   if (A.NumMatrices() == 0) { return; }
+   internal::BatchMult<true>(A, B, C, a);
+}
+
+void MultABt(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+             DenseMatrixBatch &ABt)
+{
+   MFEM_VERIFY(A.Width() == B.Width() && A.NumMatrices() == B.NumMatrices(),
+               "incompatible batches");
+   if (ABt.Height() != A.Height() || ABt.Width() != B.Height() ||
+       ABt.NumMatrices() != A.NumMatrices())
+   {
+      ABt.SetSize(A.Height(), B.Height(), A.NumMatrices());
+   }
+   if (A.NumMatrices() == 0) { return; }
+   internal::BatchMultABt<false>(A, B, ABt, 1.0);
+}
+
+void AddMultABt(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+                DenseMatrixBatch &ABt, real_t a)
+{
+   MFEM_VERIFY(A.Width() == B.Width() && ABt.Height() == A.Height() &&
+               ABt.Width() == B.Height() && A.NumMatrices() == B.NumMatrices() &&
+               A.NumMatrices() == ABt.NumMatrices(), "incompatible batches");
+   if (A.NumMatrices() == 0) { return; }
+   internal::BatchMultABt<true>(A, B, ABt, a);
+}
+
+void AddMult_a_AAt(real_t a, const DenseMatrixBatch &A, DenseMatrixBatch &AAt)
+{
+   MFEM_VERIFY(AAt.Height() == A.Height() && AAt.Width() == A.Height() &&
+               AAt.NumMatrices() == A.NumMatrices(), "incompatible batches");
+   if (A.NumMatrices() == 0) { return; }
+   internal::BatchMultABt<true>(A, A, AAt, a);
+}
+
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_DENSEMAT_BATCH
+#define MFEM_DENSEMAT_BATCH
+
+#include "../config/config.hpp"
+#include "simd.hpp"
+#include "vector.hpp"
+#include "densemat.hpp"
+
+namespace mfem
+{
+
+/** @brief A batch of small dense matrices of the same size, stored in an
+    interleaved layout for the SIMD kernels of the batched operations below. */
+/** The matrices are grouped in blocks of #lanes matrices. Each block is an
+    array of Height() x Width() SIMD values (AutoSIMD), column-major as in
+    DenseMatrix, whose lanes hold the same entry of the matrices of the block.
+    The batched operations process one block of matrices per SIMD instruction,
+    with the intrinsics of linalg/simd when MFEM_USE_SIMD is enabled, and with
+    kernels specialized for the sizes 2 and 3.
+
+    A batch of vectors is a batch of matrices with one column, so that the
+    batched matrix-vector products are given by Mult().
+
+    The data is stored on the host with 64 byte alignment. The matrices of the
+    last block beyond NumMatrices() are padding and are not accessible. */
+class DenseMatrixBatch
+{
+public:
+   /// SIMD type of the entries of one block.
+   typedef AutoSIMD<real_t, MFEM_ALIGN_BYTES/sizeof(real_t), MFEM_ALIGN_BYTES>
+   vreal_t;
+
+   /// Number of matrices in each block.
+   static constexpr int lanes = vreal_t::size;
+
+protected:
+   int height, width, nmat, nblocks;
+   Vector data;
+
+public:
+   /// Empty batch.
+   DenseMatrixBatch() : height(0), width(0), nmat(0), nblocks(0) { }
+
+   /// Batch of @a k matrices of size @a m x @a n, set to zero.
+   DenseMatrixBatch(int m, int n, int k) : DenseMatrixBatch()
+   { SetSize(m, n, k); }
+
+   DenseMatrixBatch(const DenseMatrixBatch &other) = default;
+
+   /// Copy the sizes and the entries of @a other.
+   DenseMatrixBatch &operator=(const DenseMatrixBatch &other);
+
+   /// Copy of the matrices of the DenseTensor @a T.
+   explicit DenseMatrixBatch(const DenseTensor &T) : DenseMatrixBatch()
+   { CopyFrom(T); }
+
+   /// Resize to @a k matrices of size @a m x @a n, set to zero.
+   void SetSize(int m, int n, int k);
+
+   int Height() const { return height; }
+   int Width() const { return width; }
+   /// Number of matrices.
+   int NumMatrices() const { return nmat; }
+   /// Number of blocks of #lanes matrices.
+   int NumBlocks() const { return nblocks; }
+
+   /// The Height() x Width() SIMD entries of block @a b.
+   vreal_t *GetBlock(int b)
+   {
+      return reinterpret_cast<vreal_t*>(data.HostReadWrite()) + b*height*width;
+   }
+
+   /// The Height() x Width() SIMD entries of block @a b.
+   const vreal_t *GetBlock(int b) const
+   {
+      return reinterpret_cast<const vreal_t*>(data.HostRead()) +
+             b*height*width;
+   }
+
+   /// Entry (@a i, @a j) of matrix @a k.
+   real_t &operator()(int i, int j, int k)
+   {
+      MFEM_ASSERT(k >= 0 && k < nmat, "invalid matrix index: " << k);
+      return GetBlock(k/lanes)[i + j*height][k%lanes];
+   }
+
+   /// Entry (@a i, @a j) of matrix @a k.
+   const real_t &operator()(int i, int j, int k) const
+   {
+      MFEM_ASSERT(k >= 0 && k < nmat, "invalid matrix index: " << k);
+      return GetBlock(k/lanes)[i + j*height][k%lanes];
+   }
+
+   /// Set all entries to @a value.
+   DenseMatrixBatch &operator=(real_t value);
+
+   /// Set matrix @a k to @a A.
+   void SetMatrix(int k, const DenseMatrix &A);
+
+   /// Copy matrix @a k into @a A.
+   void GetMatrix(int k, DenseMatrix &A) const;
+
+   /// Resize and copy the matrices of the DenseTensor @a T.
+   void CopyFrom(const DenseTensor &T);
+
+   /// Resize @a T and copy the matrices into it.
+   void CopyTo(DenseTensor &T) const;
+
+   /** @brief Replace each (square) matrix by its inverse, computed in closed
+       form for the sizes 1, 2 and 3, and with Gauss-Jordan elimination with
+       partial pivoting otherwise. */
+   void Invert();
+};
+
+/// C_k = A_k B_k for each matrix k of the batches.
+void Mult(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+          DenseMatrixBatch &C);
+
+/// C_k += a A_k B_k for each matrix k of the batches.
+void AddMult(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+             DenseMatrixBatch &C, real_t a = 1.0);
+
+/// ABt_k = A_k B_k^t for each matrix k of the batches.
+void MultABt(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+             DenseMatrixBatch &ABt);
+
+/// ABt_k += a A_k B_k^t for each matrix k of the batches.
+void AddMultABt(const DenseMatrixBatch &A, const DenseMatrixBatch &B,
+                DenseMatrixBatch &ABt, real_t a = 1.0);
+
+/// AAt_k += a A_k A_k^t for each matrix k of the batches.
+void AddMult_a_AAt(real_t a, const DenseMatrixBatch &A,
+                   DenseMatrixBatch &AAt);
+
+}
+
+#endif // MFEM_DENSEMAT_BATCH
@@ -0,0 +1,89 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_FUSED_SUMS_HPP
+#define MFEM_FUSED_SUMS_HPP
+
+#include "../config/config.hpp"
+#include "../general/forall.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <vector>
+
+// Internal header, used by the fused Vector and MultiVector reductions.
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// Compute the sums over the entries i in [0,N) of the contributions that
+// body(i, acc) adds to acc[0], ..., acc[n-1], with n <= MAXN. The order of
+// the summation only depends on the backend and on the number of threads.
+template <int MAXN, typename BODY>
+inline void FusedSums(bool use_dev, int N, int n, real_t *sums, BODY &&body)
+{
+   for (int k = 0; k < n; k++) { sums[k] = 0.0; }
+   if (N == 0) { return; }
+   if (use_dev && Device::Allows(Backend::DEVICE_MASK | Backend::OMP_MASK))
+   {
+      // Thread t accumulates the entries t, t + nt, t + 2 nt, ..., so that
+      // consecutive threads access consecutive entries.
+      const int nt = std::min(N, 1 << 14);
+      Vector partial(n*nt, Device::GetDeviceMemoryType());
+      auto d_partial = partial.Write();
+      mfem::forall(nt, [=] MFEM_HOST_DEVICE (int t)
+      {
+         real_t acc[MAXN];
+         for (int k = 0; k < MAXN; k++) { acc[k] = 0.0; }
+         for (int i = t; i < N; i += nt) { body(i, acc); }
+         for (int k = 0; k < n; k++) { d_partial[k*nt + t] = acc[k]; }
+      });
+      const real_t *h_partial = partial.HostRead();
+      for (int k = 0; k < n; k++)
+      {
+         for (int t = 0; t < nt; t++) { sums[k] += h_partial[k*nt + t]; }
+      }
+      return;
+   }
+   if (Device::Allows(Backend::CPU_THREADS))
+   {
+      const int nb = std::min(N, 4*mfem::ThreadPool::Global().NumThreads());
+      std::vector<real_t> partial(nb*MAXN);
+      real_t *b_partial = partial.data();
+      ThreadsWrap(nb, [=](int b)
+      {
+         const int start = int((long long)N*b/nb);
+         const int stop  = int((long long)N*(b+1)/nb);
+         real_t acc[MAXN];
+         for (int k = 0; k < MAXN; k++) { acc[k] = 0.0; }
+         for (int i = start; i < stop; i++) { body(i, acc); }
+         for (int k = 0; k < MAXN; k++) { b_partial[b*MAXN + k] = acc[k]; }
+      });
+      for (int b = 0; b < nb; b++)
+      {
+         for (int k = 0; k < n; k++) { sums[k] += partial[b*MAXN + k]; }
+      }
+      return;
+   }
+   real_t acc[MAXN];
+   for (int k = 0; k < MAXN; k++) { acc[k] = 0.0; }
+   for (int i = 0; i < N; i++) { body(i, acc); }
+   for (int k = 0; k < n; k++) { sums[k] = acc[k]; }
+}
+
+} // namespace internal
+
+} // namespace mfem
+
+#endif // MFEM_FUSED_SUMS_HPP
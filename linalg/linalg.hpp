@@ -18,13 +18,16 @@
 #include "operator.hpp"
 #include "matrix.hpp"
 #include "sparsemat.hpp"
+#include "sparsemat_formats.hpp"
 #include "complex_operator.hpp"
 #include "complex_densemat.hpp"
 #include "blockvector.hpp"
+#include "multivector.hpp"
 #include "blockmatrix.hpp"
 #include "blockoperator.hpp"
 #include "sparsesmoothers.hpp"
 #include "densemat.hpp"
+#include "densemat_batch.hpp"
 #include "symmat.hpp"
 #include "ode.hpp"
 #include "solvers.hpp"
@@ -0,0 +1,282 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "multivector.hpp"
+#include "fused_sums.hpp"
+#include "../general/forall.hpp"
+
+namespace mfem
+{
+
+void MultiVector::SetColumns()
+{
+   delete [] columns;
+   columns = nullptr;
+   column_ptrs.SetSize(0);
+   const_column_ptrs.SetSize(0);
+   if (layout != Layout::COLUMNS) { return; }
+   columns = new Vector[nvec];
+   column_ptrs.SetSize(nvec);
+   const_column_ptrs.SetSize(nvec);
+   for (int j = 0; j < nvec; j++)
+   {
+      columns[j].MakeRef(*this, j*vsize, vsize);
+      columns[j].UseDevice(UseDevice());
+      column_ptrs[j] = &columns[j];
+      const_column_ptrs[j] = &columns[j];
+   }
+}
+
+MultiVector::MultiVector()
+   : Vector(), vsize(0), nvec(0), layout(Layout::COLUMNS), columns(nullptr)
+{ }
+
+MultiVector::MultiVector(int n, int k, Layout layout_)
+   : Vector(n*k), vsize(n), nvec(k), layout(layout_), columns(nullptr)
+{
+   SetColumns();
+}
+
+MultiVector::MultiVector(int n, int k, MemoryType mt, Layout layout_)
+   : Vector(n*k, mt), vsize(n), nvec(k), layout(layout_), columns(nullptr)
+{
+   SetColumns();
+}
+
+MultiVector::MultiVector(const MultiVector &other)
+   : Vector(other), vsize(other.vsize), nvec(other.nvec), layout(other.layout),
+     columns(nullptr)
+{
+   SetColumns();
+}
+
+MultiVector &MultiVector::operator=(const MultiVector &other)
+{
+   if (this == &other) { return *this; }
+   const bool reshape = vsize != other.vsize || nvec != other.nvec ||
+                        layout != other.layout;
+   layout = other.layout;
+   SetSize(other.vsize, other.nvec);
+   Vector::operator=(other);
+   if (reshape) { SetColumns(); }
+   return *this;
+}
+
+MultiVector &MultiVector::operator=(real_t value)
+{
+   Vector::operator=(value);
+   return *this;
+}
+
+MultiVector::~MultiVector()
+{
+   delete [] columns;
+}
+
+void MultiVector::SetSize(int n, int k)
+{
+   const bool resize = n*k != Size();
+   const bool reshape = resize || n != vsize || k != nvec;
+   if (resize) { Vector::SetSize(n*k); }
+   vsize = n;
+   nvec = k;
+   if (reshape) { SetColumns(); }
+}
+
+void MultiVector::SetSize(int n, int k, MemoryType mt)
+{
+   Vector::SetSize(n*k, mt);
+   vsize = n;
+   nvec = k;
+   SetColumns();
+}
+
+void MultiVector::SetLayout(Layout new_layout)
+{
+   if (new_layout == layout) { return; }
+   if (vsize > 1 && nvec > 1)
+   {
+      const int n = vsize, k = nvec;
+      const bool to_columns = new_layout == Layout::COLUMNS;
+      Vector tmp(*this);
+      const bool use_dev = UseDevice();
+      const real_t *d_tmp = tmp.Read(use_dev);
+      real_t *d_x = Write(use_dev);
+      mfem::forall_switch(use_dev, n*k, [=] MFEM_HOST_DEVICE (int l)
+      {
+         // l is the index in the new layout
+         const int i = to_columns ? l % n : l / k;
+         const int j = to_columns ? l / n : l % k;
+         d_x[l] = to_columns ? d_tmp[i*k + j] : d_tmp[j*n + i];
+      });
+   }
+   layout = new_layout;
+   SetColumns();
+}
+
+Array<Vector *> &MultiVector::GetColumns()
+{
+   MFEM_VERIFY(layout == Layout::COLUMNS,
+               "the column views require the COLUMNS layout");
+   return column_ptrs;
+}
+
+const Array<const Vector *> &MultiVector::GetConstColumns() const
+{
+   MFEM_VERIFY(layout == Layout::COLUMNS,
+               "the column views require the COLUMNS layout");
+   return const_column_ptrs;
+}
+
+void MultiVector::CopyColumn(int j, Vector &v) const
+{
+   MFEM_ASSERT(j >= 0 && j < nvec, "invalid column index: " << j);
+   v.SetSize(vsize);
+   const int n = vsize, k = nvec;
+   const int stride = layout == Layout::COLUMNS ? 1 : k;
+   const int offset = layout == Layout::COLUMNS ? j*n : j;
+   const bool use_dev = UseDevice() || v.UseDevice();
+   const real_t *d_x = Read(use_dev);
+   real_t *d_v = v.Write(use_dev);
+   mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_v[i] = d_x[offset + i*stride];
+   });
+}
+
+void MultiVector::SetColumn(int j, const Vector &v)
+{
+   MFEM_ASSERT(j >= 0 && j < nvec, "invalid column index: " << j);
+   MFEM_ASSERT(v.Size() == vsize, "incompatible Vector size");
+   const int n = vsize, k = nvec;
+   const int stride = layout == Layout::COLUMNS ? 1 : k;
+   const int offset = layout == Layout::COLUMNS ? j*n : j;
+   const bool use_dev = UseDevice() || v.UseDevice();
+   const real_t *d_v = v.Read(use_dev);
+   real_t *d_x = ReadWrite(use_dev);
+   mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_x[offset + i*stride] = d_v[i];
+   });
+}
+
+void MultiVector::InnerProducts(const MultiVector &Y, DenseMatrix &G) const
+{
+   MFEM_VERIFY(layout == Layout::COLUMNS && Y.layout == Layout::COLUMNS,
+               "InnerProducts requires the COLUMNS layout");
+   MFEM_ASSERT(vsize == Y.vsize, "incompatible column sizes");
+   G.SetSize(nvec, Y.nvec);
+   constexpr int T = MDOT_MAX_VECTORS;
+   const int N = vsize;
+   const bool use_dev = UseDevice() || Y.UseDevice();
+   const real_t *d_x = Read(use_dev);
+   const real_t *d_y = Y.Read(use_dev);
+   real_t sums[T*T];
+   // One pass over the data for each tile of T x T inner products.
+   for (int i0 = 0; i0 < nvec; i0 += T)
+   {
+      for (int j0 = 0; j0 < Y.nvec; j0 += T)
+      {
+         const int ti = std::min(nvec - i0, T);
+         const int tj = std::min(Y.nvec - j0, T);
+         const real_t *d_x0 = d_x + i0*N;
+         const real_t *d_y0 = d_y + j0*N;
+         internal::FusedSums<T*T>(use_dev, N, ti*tj, sums,
+                                  [=] MFEM_HOST_DEVICE (int l, real_t *acc)
+         {
+            real_t y_l[T];
+            for (int b = 0; b < tj; b++) { y_l[b] = d_y0[b*N + l]; }
+            for (int a = 0; a < ti; a++)
+            {
+               const real_t x_l = d_x0[a*N + l];
+               for (int b = 0; b < tj; b++) { acc[a*tj + b] += x_l*y_l[b]; }
+            }
+         });
+         for (int a = 0; a < ti; a++)
+         {
+            for (int b = 0; b < tj; b++) { G(i0 + a, j0 + b) = sums[a*tj + b]; }
+         }
+      }
+   }
+}
+
+namespace internal
+{
+
+// Coefficients of one tile of MultiVector::AddMult(), captured by value in the
+// kernel.
+struct MultiVectorTile
+{
+   real_t c[MDOT_MAX_VECTORS][MDOT_MAX_VECTORS];
+};
+
+} // namespace internal
+
+void MultiVector::AddMult(const MultiVector &Y, const DenseMatrix &C,
+                          real_t a)
+{
+   MFEM_VERIFY(layout == Layout::COLUMNS && Y.layout == Layout::COLUMNS,
+               "AddMult requires the COLUMNS layout");
+   MFEM_ASSERT(vsize == Y.vsize, "incompatible column sizes");
+   MFEM_ASSERT(C.Height() == Y.nvec && C.Width() == nvec,
+               "incompatible coefficient matrix");
+   MFEM_ASSERT(GetData() != Y.GetData(), "aliasing is not supported");
+   constexpr int T = MDOT_MAX_VECTORS;
+   const int N = vsize;
+   const bool use_dev = UseDevice() || Y.UseDevice();
+   const real_t *d_y = Y.Read(use_dev);
+   real_t *d_x = ReadWrite(use_dev);
+   // One pass over the data for each tile of T x T coefficients.
+   for (int i0 = 0; i0 < Y.nvec; i0 += T)
+   {
+      for (int j0 = 0; j0 < nvec; j0 += T)
+      {
+         const int ti = std::min(Y.nvec - i0, T);
+         const int tj = std::min(nvec - j0, T);
+         internal::MultiVectorTile tile;
+         for (int b = 0; b < tj; b++)
+         {
+            for (int c = 0; c < ti; c++) { tile.c[b][c] = a*C(i0 + c, j0 + b); }
+         }
+         const real_t *d_y0 = d_y + i0*N;
+         real_t *d_x0 = d_x + j0*N;
+         mfem::forall_switch(use_dev, N, [=] MFEM_HOST_DEVICE (int l)
+         {
+            real_t y_l[T];
+            for (int c = 0; c < ti; c++) { y_l[c] = d_y0[c*N + l]; }
+            for (int b = 0; b < tj; b++)
+            {
+               real_t x_l = d_x0[b*N + l];
+               for (int c = 0; c < ti; c++) { x_l += tile.c[b][c]*y_l[c]; }
+               d_x0[b*N + l] = x_l;
+            }
+         });
+      }
+   }
+}
+
+void MultiVector::SyncToColumns() const
+{
+   for (int j = 0; j < column_ptrs.Size(); j++)
+   {
+      columns[j].SyncMemory(*this);
+   }
+}
+
+void MultiVector::SyncFromColumns() const
+{
+   for (int j = 0; j < column_ptrs.Size(); j++)
+   {
+      columns[j].SyncAliasMemory(*this);
+   }
+}
+
+}
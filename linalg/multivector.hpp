@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_MULTIVECTOR
+#define MFEM_MULTIVECTOR
+
+#include "../config/config.hpp"
+#include "../general/array.hpp"
+#include "vector.hpp"
+#include "densemat.hpp"
+
+namespace mfem
+{
+
+/** @brief A set of Vectors of the same size, stored in one contiguous Vector,
+    used by the methods acting on many vectors at once, e.g.
+    Operator::ArrayMult() and BlockCGSolver. */
+/** With the Layout::COLUMNS layout (the default), column j is stored in the
+    entries [j*VectorSize(), (j+1)*VectorSize()), and it is available as the
+    Vector view GetColumn(j). The arrays GetColumns() and GetConstColumns() of
+    pointers to the views can be passed directly to the ArrayMult() methods.
+
+    With the Layout::INTERLEAVED layout, entry i of column j is stored at
+    i*NumVectors()+j, so that the values of all columns at one index are
+    contiguous. The column views are not available in this layout; use
+    CopyColumn() and SetColumn(), or convert with SetLayout().
+
+    As for BlockVector, the column views have their own memory validity flags,
+    see SyncToColumns() and SyncFromColumns(). The methods InnerProducts() and
+    AddMult() access the monolithic vector. */
+class MultiVector : public Vector
+{
+public:
+   /// Storage layout of the columns.
+   enum class Layout
+   {
+      COLUMNS,    ///< Each column is contiguous.
+      INTERLEAVED ///< The entries with the same index are contiguous.
+   };
+
+protected:
+   int vsize; ///< Size of each column.
+   int nvec;  ///< Number of columns.
+   Layout layout;
+
+   /// Column views (Layout::COLUMNS only), owned.
+   Vector *columns;
+   Array<Vector *> column_ptrs;
+   Array<const Vector *> const_column_ptrs;
+
+   void SetColumns();
+
+public:
+   /// Empty MultiVector, with no columns.
+   MultiVector();
+
+   /// MultiVector with @a k columns of size @a n.
+   MultiVector(int n, int k, Layout layout = Layout::COLUMNS);
+
+   /// MultiVector with @a k columns of size @a n and the MemoryType @a mt.
+   MultiVector(int n, int k, MemoryType mt, Layout layout = Layout::COLUMNS);
+
+   /// Copy constructor: copies the data, the shape and the layout.
+   MultiVector(const MultiVector &other);
+
+   /// Copy the data, the shape and the layout of @a other.
+   MultiVector &operator=(const MultiVector &other);
+
+   /// Set all entries to @a value.
+   MultiVector &operator=(real_t value);
+
+   ~MultiVector();
+
+   /** @brief Resize to @a k columns of size @a n, keeping the layout. The data
+       is not preserved when the size changes. */
+   void SetSize(int n, int k);
+
+   /// Resize to @a k columns of size @a n with the MemoryType @a mt.
+   void SetSize(int n, int k, MemoryType mt);
+
+   /// Size of each column.
+   int VectorSize() const { return vsize; }
+
+   /// Number of columns.
+   int NumVectors() const { return nvec; }
+
+   Layout GetLayout() const { return layout; }
+
+   /// Convert the data to the layout @a new_layout.
+   void SetLayout(Layout new_layout);
+
+   /// View of column @a j (Layout::COLUMNS only).
+   Vector &GetColumn(int j)
+   {
+      MFEM_ASSERT(layout == Layout::COLUMNS && j >= 0 && j < nvec, "");
+      return columns[j];
+   }
+
+   /// View of column @a j (Layout::COLUMNS only).
+   const Vector &GetColumn(int j) const
+   {
+      MFEM_ASSERT(layout == Layout::COLUMNS && j >= 0 && j < nvec, "");
+      return columns[j];
+   }
+
+   /// Pointers to the column views, e.g. for ArrayMult() (Layout::COLUMNS only).
+   Array<Vector *> &GetColumns();
+
+   /// Pointers to the column views, e.g. for ArrayMult() (Layout::COLUMNS only).
+   const Array<const Vector *> &GetConstColumns() const;
+
+   /// Copy column @a j into @a v, in any layout.
+   void CopyColumn(int j, Vector &v) const;
+
+   /// Set column @a j to @a v, in any layout.
+   void SetColumn(int j, const Vector &v);
+
+   /** @brief Compute the local inner products G(i,j) = (X_i, Y_j) of the
+       columns of this MultiVector X with the columns of @a Y. */
+   /** Both MultiVector%s must use Layout::COLUMNS. The data is read once for
+       each tile of MDOT_MAX_VECTORS x MDOT_MAX_VECTORS inner products. In
+       parallel, the caller is responsible for the reduction over the
+       processors. */
+   void InnerProducts(const MultiVector &Y, DenseMatrix &G) const;
+
+   /** @brief Add @a a Y C to this MultiVector X, i.e. X_j += a sum_i C(i,j)
+       Y_i, where C has Y.NumVectors() rows and NumVectors() columns. */
+   /** Both MultiVector%s must use Layout::COLUMNS, and @a Y must not share
+       data with this MultiVector. The data is read once for each tile of
+       MDOT_MAX_VECTORS x MDOT_MAX_VECTORS coefficients. */
+   void AddMult(const MultiVector &Y, const DenseMatrix &C, real_t a = 1.0);
+
+   /** @brief Synchronize the memory location flags of the column views with
+       the ones of the monolithic vector, see BlockVector::SyncToBlocks(). */
+   void SyncToColumns() const;
+
+   /** @brief Synchronize the memory location flags of the monolithic vector
+       with the ones of the column views, see BlockVector::SyncFromBlocks(). */
+   void SyncFromColumns() const;
+};
+
+}
+
+#endif // MFEM_MULTIVECTOR
@@ -12,6 +12,9 @@
 #include "../general/communication.hpp"
 #include "operator.hpp"
 #include "ode.hpp"
+#include "../general/forall.hpp"
+
+#include <limits>
 
 namespace mfem
 {
@@ -19,6 +22,7 @@ namespace mfem
 std::string ODESolver::ExplicitTypes =
    "\n\tExplicit solver: \n\t"
    "        RK      :  1 - Forward Euler, 2 - RK2(0.5), 3 - RK3 SSP, 4 - RK4, 6 - RK6,\n\t"
+   "        LSRK    :  7 - Williamson RK3, 8 - Carpenter-Kennedy RK4, 9 - SSPRK(10,4),\n\t"
    "        AB      : 11 - AB1, 12 - AB2, 13 - AB3, 14 - AB4, 15 - AB5\n";
 
 std::string ODESolver::ImplicitTypes  =
@@ -55,6 +59,11 @@ std::unique_ptr<ODESolver> ODESolver::SelectExplicit(int ode_solver_type)
       case 4: return ode_ptr(new RK4Solver);
       case 6: return ode_ptr(new RK6Solver);
 
+      // Explicit low-storage RK methods
+      case 7: return ode_ptr(new WilliamsonRK3Solver);
+      case 8: return ode_ptr(new CarpenterKennedyRK4Solver);
+      case 9: return ode_ptr(new SSPRK104Solver);
+
       // Explicit AB methods
       case 11: return ode_ptr(new AB1Solver);
       case 12: return ode_ptr(new AB2Solver);
@@ -487,6 +496,105 @@ const real_t RK8Solver::c[] =
 };
 
 
+LowStorageRKSolver::LowStorageRKSolver(int s_, const real_t *A_,
+                                       const real_t *B_, const real_t *c_)
+{
+   s = s_;
+   A = A_;
+   B = B_;
+   c = c_;
+}
+
+void LowStorageRKSolver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   int n = f->Width();
+   dq.SetSize(n, mem_type);
+   k.SetSize(n, mem_type);
+}
+
+void LowStorageRKSolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   for (int i = 0; i < s; i++)
+   {
+      f->SetTime(t + c[i]*dt);
+      f->Mult(x, k);
+      if (i == 0) { dq.Set(dt, k); }
+      else { add(A[i], dq, dt, k, dq); }
+      x.Add(B[i], dq);
+   }
+   t += dt;
+}
+
+const real_t WilliamsonRK3Solver::A[] =
+{ 0.0, -5.0/9.0, -153.0/128.0 };
+const real_t WilliamsonRK3Solver::B[] =
+{ 1.0/3.0, 15.0/16.0, 8.0/15.0 };
+const real_t WilliamsonRK3Solver::c[] =
+{ 0.0, 1.0/3.0, 3.0/4.0 };
+
+const real_t CarpenterKennedyRK4Solver::A[] =
+{
+   0.0,
+   -567301805773.0/1357537059087.0,
+   -2404267990393.0/2016746695238.0,
+   -3550918686646.0/2091501179385.0,
+   -1275806237668.0/842570457699.0
+};
+const real_t CarpenterKennedyRK4Solver::B[] =
+{
+   1432997174477.0/9575080441755.0,
+   5161836677717.0/13612068292357.0,
+   1720146321549.0/2090206949498.0,
+   3134564353537.0/4481467310338.0,
+   2277821191437.0/14882151754819.0
+};
+const real_t CarpenterKennedyRK4Solver::c[] =
+{
+   0.0,
+   1432997174477.0/9575080441755.0,
+   2526269341429.0/6820363962896.0,
+   2006345519317.0/3224310063776.0,
+   2802321613138.0/2924317926251.0
+};
+
+
+void SSPRK104Solver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   int n = f->Width();
+   q.SetSize(n, mem_type);
+   k.SetSize(n, mem_type);
+}
+
+void SSPRK104Solver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   // Forward Euler steps of size dt/6, starting at t + t0*dt
+   auto euler_steps = [&](int num, real_t t0)
+   {
+      for (int i = 0; i < num; i++)
+      {
+         f->SetTime(t + (t0 + i/6.0)*dt);
+         f->Mult(x, k);
+         x.Add(dt/6, k);
+      }
+   };
+
+   q = x;
+   euler_steps(5, 0.0);
+   // q = 1/25*q + 9/25*x, x = 15*q - 5*x
+   add(1./25, q, 9./25, x, q);
+   add(15., q, -5., x, x);
+   euler_steps(4, 1.0/3.0);
+   // x = q + 3/5*x + 1/10*dt*f(x)
+   f->SetTime(t + dt);
+   f->Mult(x, k);
+   add(3./5, x, dt/10, k, x);
+   x += q;
+   t += dt;
+}
+
+
 AdamsBashforthSolver::AdamsBashforthSolver(int s_, const real_t *a_):
    stages(s_), state(s_)
 {
@@ -874,6 +982,379 @@ void ESDIRK33Solver::Step(Vector &x, real_t &t, real_t &dt)
    t += dt;
 }
 
+AdaptiveODESolver::AdaptiveODESolver()
+   : rel_tol(1e-6), abs_tol(1e-6), safety(0.9), min_factor(0.2),
+     max_factor(5.0), k_I(0.7), k_P(0.4), dt_min(0.0),
+     dt_max(std::numeric_limits<real_t>::infinity()), dt_next(0.0),
+     err_old(1.0), num_steps(0), num_rejected(0)
+{ }
+
+void AdaptiveODESolver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   const int n = f->Width();
+   x_new.SetSize(n, mem_type);
+   err.SetSize(n, mem_type);
+   w.SetSize(n, mem_type);
+   x_new.UseDevice(true);
+   err.UseDevice(true);
+   w.UseDevice(true);
+   dt_next = 0.0;
+   err_old = 1.0;
+   num_steps = num_rejected = 0;
+}
+
+real_t AdaptiveODESolver::ErrorNorm(const Vector &x, const Vector &x_new_,
+                                    const Vector &err_)
+{
+   const int n = x.Size();
+   const real_t rtol = rel_tol, atol = abs_tol;
+   const real_t *d_x = x.Read(), *d_xn = x_new_.Read(), *d_e = err_.Read();
+   real_t *d_w = w.Write();
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const real_t sc = atol + rtol*fmax(fabs(d_x[i]), fabs(d_xn[i]));
+      d_w[i] = d_e[i]/sc;
+   });
+   real_t sums[2] = { w*w, real_t(n) };
+#ifdef MFEM_USE_MPI
+   if (comm != MPI_COMM_NULL)
+   {
+      MPI_Allreduce(MPI_IN_PLACE, sums, 2, MFEM_MPI_REAL_T,
+                    MPI_SUM, comm);
+   }
+#endif
+   return sums[1] > 0.0 ? sqrt(sums[0]/sums[1]) : 0.0;
+}
+
+void AdaptiveODESolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   const real_t t_end = t + dt;
+   const real_t k = GetErrorOrder() + 1;
+   if (dt_next <= 0.0) { dt_next = dt; }
+   bool rejected = false;
+   while (t < t_end)
+   {
+      // The last internal step ends exactly at t_end.
+      real_t h = std::min(dt_next, dt_max);
+      const bool last = (h >= t_end - t);
+      if (last) { h = t_end - t; }
+      MFEM_VERIFY(t + h > t, "time step size underflow at t = " << t);
+
+      TryStep(x, t, h, x_new, err);
+      const real_t e = ErrorNorm(x, x_new, err);
+      if (e <= 1.0 || h <= dt_min)
+      {
+         StepAccepted();
+         x = x_new;
+         t = last ? t_end : t + h;
+         num_steps++;
+         real_t factor = safety*pow(std::max(e, real_t(1e-10)), -k_I/k)*
+                         pow(err_old, k_P/k);
+         // No step size increase right after a rejected step.
+         if (rejected) { factor = std::min(factor, real_t(1.0)); }
+         factor = std::min(max_factor, std::max(min_factor, factor));
+         // A step shortened to reach t_end only decreases the proposed size.
+         dt_next = last && h < dt_next ? dt_next*std::min(factor, real_t(1.0)) :
+                   h*factor;
+         dt_next = std::max(dt_min, std::min(dt_max, dt_next));
+         err_old = std::max(e, real_t(1e-4));
+         rejected = false;
+      }
+      else
+      {
+         num_rejected++;
+         // A NaN error norm gives the minimal factor.
+         const real_t factor = safety*pow(e, -1.0/k);
+         dt_next = std::max(dt_min, h*std::max(min_factor,
+                                               std::min(factor, real_t(1.0))));
+         rejected = true;
+      }
+   }
+}
+
+EmbeddedRKSolver::EmbeddedRKSolver(int s_, const real_t *a_, const real_t *b_,
+                                   const real_t *b_hat_, const real_t *c_,
+                                   int order_hat_, bool fsal_, real_t gamma_)
+   : s(s_), order_hat(order_hat_), a(a_), b(b_), b_hat(b_hat_), c(c_),
+     gamma(gamma_), fsal(fsal_), k0_valid(false)
+{
+   k = new Vector[s];
+}
+
+void EmbeddedRKSolver::Init(TimeDependentOperator &f_)
+{
+   AdaptiveODESolver::Init(f_);
+   const int n = f->Width();
+   y.SetSize(n, mem_type);
+   y.UseDevice(true);
+   for (int i = 0; i < s; i++)
+   {
+      k[i].SetSize(n, mem_type);
+      k[i].UseDevice(true);
+   }
+   k0_valid = false;
+}
+
+void EmbeddedRKSolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   // The first stage is only reused between the internal steps of one call,
+   // since x may be modified between the calls.
+   k0_valid = false;
+   AdaptiveODESolver::Step(x, t, dt);
+}
+
+void EmbeddedRKSolver::TryStep(const Vector &x, real_t t, real_t dt,
+                               Vector &x_new_, Vector &err_)
+{
+   if (!k0_valid)
+   {
+      f->SetTime(t);
+      f->Mult(x, k[0]);
+      k0_valid = true;
+   }
+   for (int l = 0, i = 1; i < s; i++)
+   {
+      add(x, a[l++]*dt, k[0], y);
+      for (int j = 1; j < i; j++)
+      {
+         y.Add(a[l++]*dt, k[j]);
+      }
+
+      f->SetTime(t + c[i-1]*dt);
+      if (gamma > 0.0) { f->ImplicitSolve(gamma*dt, y, k[i]); }
+      else { f->Mult(y, k[i]); }
+   }
+   x_new_ = x;
+   err_ = 0.0;
+   for (int i = 0; i < s; i++)
+   {
+      x_new_.Add(b[i]*dt, k[i]);
+      err_.Add((b[i] - b_hat[i])*dt, k[i]);
+   }
+}
+
+void EmbeddedRKSolver::StepAccepted()
+{
+   // The last stage is f at the new solution and time.
+   if (fsal) { k[0].Swap(k[s-1]); }
+   k0_valid = fsal;
+}
+
+EmbeddedRKSolver::~EmbeddedRKSolver()
+{
+   delete [] k;
+}
+
+const real_t BogackiShampineSolver::a[] =
+{
+   1.0/2.0,
+   0.0, 3.0/4.0,
+   2.0/9.0, 1.0/3.0, 4.0/9.0
+};
+const real_t BogackiShampineSolver::b[] =
+{ 2.0/9.0, 1.0/3.0, 4.0/9.0, 0.0 };
+const real_t BogackiShampineSolver::b_hat[] =
+{ 7.0/24.0, 1.0/4.0, 1.0/3.0, 1.0/8.0 };
+const real_t BogackiShampineSolver::c[] =
+{ 1.0/2.0, 3.0/4.0, 1.0 };
+
+const real_t DormandPrinceSolver::a[] =
+{
+   1.0/5.0,
+   3.0/40.0, 9.0/40.0,
+   44.0/45.0, -56.0/15.0, 32.0/9.0,
+   19372.0/6561.0, -25360.0/2187.0, 64448.0/6561.0, -212.0/729.0,
+   9017.0/3168.0, -355.0/33.0, 46732.0/5247.0, 49.0/176.0, -5103.0/18656.0,
+   35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0
+};
+const real_t DormandPrinceSolver::b[] =
+{
+   35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0,
+   0.0
+};
+const real_t DormandPrinceSolver::b_hat[] =
+{
+   5179.0/57600.0, 0.0, 7571.0/16695.0, 393.0/640.0, -92097.0/339200.0,
+   187.0/2100.0, 1.0/40.0
+};
+const real_t DormandPrinceSolver::c[] =
+{ 1.0/5.0, 3.0/10.0, 4.0/5.0, 8.0/9.0, 1.0, 1.0 };
+
+const real_t CashKarpSolver::a[] =
+{
+   1.0/5.0,
+   3.0/40.0, 9.0/40.0,
+   3.0/10.0, -9.0/10.0, 6.0/5.0,
+   -11.0/54.0, 5.0/2.0, -70.0/27.0, 35.0/27.0,
+   1631.0/55296.0, 175.0/512.0, 575.0/13824.0, 44275.0/110592.0, 253.0/4096.0
+};
+const real_t CashKarpSolver::b[] =
+{ 37.0/378.0, 0.0, 250.0/621.0, 125.0/594.0, 0.0, 512.0/1771.0 };
+const real_t CashKarpSolver::b_hat[] =
+{
+   2825.0/27648.0, 0.0, 18575.0/48384.0, 13525.0/55296.0, 277.0/14336.0,
+   1.0/4.0
+};
+const real_t CashKarpSolver::c[] =
+{ 1.0/5.0, 3.0/10.0, 3.0/5.0, 1.0, 7.0/8.0 };
+
+const real_t AdaptiveESDIRK3Solver::a[] =
+{
+   1767732205903.0/4055673282236.0,
+   2746238789719.0/10658868560708.0, -640167445237.0/6845629431997.0,
+   1471266399579.0/7840856788654.0, -4482444167858.0/7529755066697.0,
+   11266239266428.0/11593286722821.0
+};
+const real_t AdaptiveESDIRK3Solver::b[] =
+{
+   1471266399579.0/7840856788654.0, -4482444167858.0/7529755066697.0,
+   11266239266428.0/11593286722821.0, 1767732205903.0/4055673282236.0
+};
+const real_t AdaptiveESDIRK3Solver::b_hat[] =
+{
+   2756255671327.0/12835298489170.0, -10771552573575.0/22201958757719.0,
+   9247589265047.0/10645013368117.0, 2193209047091.0/5459859503100.0
+};
+const real_t AdaptiveESDIRK3Solver::c[] =
+{ 1767732205903.0/2027836641118.0, 3.0/5.0, 1.0 };
+
+const real_t AdaptiveESDIRK4Solver::a[] =
+{
+   1.0/4.0,
+   8611.0/62500.0, -1743.0/31250.0,
+   5012029.0/34652500.0, -654441.0/2922500.0, 174375.0/388108.0,
+   15267082809.0/155376265600.0, -71443401.0/120774400.0,
+   730878875.0/902184768.0, 2285395.0/8070912.0,
+   82889.0/524892.0, 0.0, 15625.0/83664.0, 69875.0/102672.0, -2260.0/8211.0
+};
+const real_t AdaptiveESDIRK4Solver::b[] =
+{
+   82889.0/524892.0, 0.0, 15625.0/83664.0, 69875.0/102672.0, -2260.0/8211.0,
+   1.0/4.0
+};
+const real_t AdaptiveESDIRK4Solver::b_hat[] =
+{
+   4586570599.0/29645900160.0, 0.0, 178811875.0/945068544.0,
+   814220225.0/1159782912.0, -3700637.0/11593932.0, 61727.0/225920.0
+};
+const real_t AdaptiveESDIRK4Solver::c[] =
+{ 1.0/2.0, 83.0/250.0, 31.0/50.0, 17.0/20.0, 1.0 };
+
+IMEXRKSolver::IMEXRKSolver(int s_, const real_t *ae_, const real_t *be_,
+                           const real_t *ai_, const real_t *bi_,
+                           const real_t *c_, real_t gamma_)
+   : s(s_), ae(ae_), be(be_), ai(ai_), bi(bi_), c(c_), gamma(gamma_)
+{
+   use_k2_0 = (bi[0] != 0.0);
+   for (int l = 0, i = 1; i < s; l += i, i++)
+   {
+      use_k2_0 = use_k2_0 || (ai[l] != 0.0);
+   }
+   k1 = new Vector[s];
+   k2 = new Vector[s];
+}
+
+void IMEXRKSolver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   int n = f->Width();
+   y.SetSize(n, mem_type);
+   for (int i = 0; i < s; i++)
+   {
+      k1[i].SetSize(n, mem_type);
+      k2[i].SetSize(n, mem_type);
+   }
+}
+
+void IMEXRKSolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   f->SetTime(t);
+   f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_1);
+   f->Mult(x, k1[0]);
+   if (use_k2_0)
+   {
+      f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_2);
+      f->Mult(x, k2[0]);
+   }
+   for (int l = 0, i = 1; i < s; i++)
+   {
+      y = x;
+      for (int j = 0; j < i; j++, l++)
+      {
+         y.Add(ae[l]*dt, k1[j]);
+         if (j > 0 || use_k2_0) { y.Add(ai[l]*dt, k2[j]); }
+      }
+
+      f->SetTime(t + c[i-1]*dt);
+      f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_2);
+      f->ImplicitSolve(gamma*dt, y, k2[i]);
+      // The explicit term at the last stage is only needed if be[s-1] != 0.
+      if (i < s-1 || be[s-1] != 0.0)
+      {
+         y.Add(gamma*dt, k2[i]);
+         f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_1);
+         f->Mult(y, k1[i]);
+      }
+   }
+   f->SetEvalMode(TimeDependentOperator::NORMAL);
+   for (int i = 0; i < s; i++)
+   {
+      if (be[i] != 0.0) { x.Add(be[i]*dt, k1[i]); }
+      if (i > 0 || use_k2_0) { x.Add(bi[i]*dt, k2[i]); }
+   }
+   t += dt;
+}
+
+IMEXRKSolver::~IMEXRKSolver()
+{
+   delete [] k1;
+   delete [] k2;
+}
+
+const real_t IMEXARK3Solver::ae[] =
+{
+   1767732205903.0/2027836641118.0,
+   5535828885825.0/10492691773637.0, 788022342437.0/10882634858940.0,
+   6485989280629.0/16251701735622.0, -4246266847089.0/9704473918619.0,
+   10755448449292.0/10357097424841.0
+};
+const real_t IMEXARK3Solver::ai[] =
+{
+   1767732205903.0/4055673282236.0,
+   2746238789719.0/10658868560708.0, -640167445237.0/6845629431997.0,
+   1471266399579.0/7840856788654.0, -4482444167858.0/7529755066697.0,
+   11266239266428.0/11593286722821.0
+};
+const real_t IMEXARK3Solver::b[] =
+{
+   1471266399579.0/7840856788654.0, -4482444167858.0/7529755066697.0,
+   11266239266428.0/11593286722821.0, 1767732205903.0/4055673282236.0
+};
+const real_t IMEXARK3Solver::c[] =
+{ 1767732205903.0/2027836641118.0, 3.0/5.0, 1.0 };
+
+const real_t IMEXARS443Solver::ae[] =
+{
+   1.0/2.0,
+   11.0/18.0, 1.0/18.0,
+   5.0/6.0, -5.0/6.0, 1.0/2.0,
+   1.0/4.0, 7.0/4.0, 3.0/4.0, -7.0/4.0
+};
+const real_t IMEXARS443Solver::be[] =
+{ 1.0/4.0, 7.0/4.0, 3.0/4.0, -7.0/4.0, 0.0 };
+const real_t IMEXARS443Solver::ai[] =
+{
+   0.0,
+   0.0, 1.0/6.0,
+   0.0, -1.0/2.0, 1.0/2.0,
+   0.0, 3.0/2.0, -3.0/2.0, 1.0/2.0
+};
+const real_t IMEXARS443Solver::bi[] =
+{ 0.0, 3.0/2.0, -3.0/2.0, 1.0/2.0, 1.0/2.0 };
+const real_t IMEXARS443Solver::c[] =
+{ 1.0/2.0, 2.0/3.0, 1.0/2.0, 1.0 };
+
 void GeneralizedAlphaSolver::Init(TimeDependentOperator &f_)
 {
    ODESolver::Init(f_);
@@ -332,6 +332,72 @@ public:
 };
 
 
+/** @brief Low-storage explicit Runge-Kutta method in the 2N form of
+    Williamson. */
+/** The s stages are computed with two vectors in addition to the solution,
+    instead of the s stage vectors of ExplicitRKSolver:
+       dq = A[i] dq + dt f(x, t + c[i] dt),   x = x + B[i] dq,
+    for i = 0, ..., s-1, with A[0] = 0. From J.H. Williamson, "Low-storage
+    Runge-Kutta schemes", J. Comput. Phys., 35(1), 1980. */
+class LowStorageRKSolver : public ODESolver
+{
+private:
+   int s;
+   const real_t *A, *B, *c;
+   Vector dq, k;
+
+public:
+   LowStorageRKSolver(int s_, const real_t *A_, const real_t *B_,
+                      const real_t *c_);
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+};
+
+
+/// The 3-stage, 3rd order low-storage RK method of Williamson.
+class WilliamsonRK3Solver : public LowStorageRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t A[3], B[3], c[3];
+
+public:
+   WilliamsonRK3Solver() : LowStorageRKSolver(3, A, B, c) { }
+};
+
+
+/** The 5-stage, 4th order low-storage RK method from M.H. Carpenter and C.A.
+    Kennedy, "Fourth-order 2N-storage Runge-Kutta schemes", NASA TM-109112,
+    1994, solution 3. */
+class CarpenterKennedyRK4Solver : public LowStorageRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t A[5], B[5], c[5];
+
+public:
+   CarpenterKennedyRK4Solver() : LowStorageRKSolver(5, A, B, c) { }
+};
+
+
+/** @brief The 10-stage, 4th order strong stability preserving RK method
+    SSPRK(10,4), with the SSP coefficient 6. */
+/** The stages are computed with two vectors in addition to the solution.
+    From D.I. Ketcheson, "Highly efficient strong stability-preserving
+    Runge-Kutta methods with low-storage implementations", SIAM J. Sci.
+    Comput., 30(4), 2008. */
+class SSPRK104Solver : public ODESolver
+{
+private:
+   Vector q, k;
+
+public:
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+};
+
+
 /// Backward Euler ODE solver. L-stable.
 class BackwardEulerSolver : public ODESolver
 {
@@ -449,6 +515,302 @@ public:
 };
 
 
+/** @brief Abstract class for the ODE solvers with adaptive time step control
+    based on an estimate of the local error. */
+/** A call to Step() advances the solution from @a t [in] to exactly @a t [in]
+    + @a dt [in] with one or more internal steps, whose sizes are chosen by a
+    PI step size controller such that the weighted RMS norm of the local error
+    estimate,
+    \f[ \|e\| = \sqrt{\frac{1}{n} \sum_i \left(\frac{e_i}{a + r
+        \max(|x_i|, |\hat{x}_i|)}\right)^2}, \f]
+    with the absolute and relative tolerances a and r, is at most one. Steps
+    with a larger error are rejected and repeated with a smaller step size.
+    The value of @a dt is not modified. The proposed size of the next internal
+    step is kept between the calls to Step() and is returned by
+    GetNextStepSize(), so that @a dt only sets the times at which the solution
+    is returned. Run() integrates to @a tf with a single call to Step(), using
+    @a dt as the size of the first internal step.
+
+    After an accepted step with the error norm e_n, the next step size is
+    dt_n (1/e_n)^{k_I/k} e_{n-1}^{k_P/k} multiplied by a safety factor, where
+    k is the order of the error estimate plus one, see G. Soderlind, "Automatic
+    control and adaptive time-stepping", Numerical Algorithms, 31, 2002. */
+class AdaptiveODESolver : public ODESolver
+{
+protected:
+   real_t rel_tol, abs_tol;
+   real_t safety, min_factor, max_factor;
+   real_t k_I, k_P;
+   real_t dt_min, dt_max;
+
+   /// Proposed size of the next internal step, 0 before the first step.
+   real_t dt_next;
+   /// Error norm of the last accepted step.
+   real_t err_old;
+   int num_steps, num_rejected;
+   Vector x_new, err, w;
+
+#ifdef MFEM_USE_MPI
+   MPI_Comm comm = MPI_COMM_NULL;
+#endif
+
+   /** @brief Compute the solution @a x_new at @a t + @a dt and an estimate
+       @a err of its local error, from the solution @a x at @a t. */
+   virtual void TryStep(const Vector &x, real_t t, real_t dt, Vector &x_new,
+                        Vector &err) = 0;
+
+   /// Called when the last step computed by TryStep() is accepted.
+   virtual void StepAccepted() { }
+
+   /// Order of the local error estimate, i.e. of the embedded method.
+   virtual int GetErrorOrder() const = 0;
+
+   /// The weighted RMS norm of the error estimate @a err.
+   real_t ErrorNorm(const Vector &x, const Vector &x_new, const Vector &err);
+
+public:
+   AdaptiveODESolver();
+
+#ifdef MFEM_USE_MPI
+   /// Set the communicator of the global reduction in the error norm.
+   void SetComm(MPI_Comm comm_) { comm = comm_; }
+#endif
+
+   /// Set the relative and the absolute tolerances of the local error.
+   void SetTolerances(real_t rtol, real_t atol)
+   { rel_tol = rtol; abs_tol = atol; }
+
+   /** @brief Set the bounds of the internal step size. A step of size
+       @a dt_min is accepted regardless of its error. */
+   void SetStepSizeLimits(real_t dt_min_, real_t dt_max_)
+   { dt_min = dt_min_; dt_max = dt_max_; }
+
+   /** @brief Set the gains of the PI controller. With @a kP = 0, this is the
+       elementary controller dt_n (1/e_n)^{kI/k}. */
+   void SetPIController(real_t kI, real_t kP) { k_I = kI; k_P = kP; }
+
+   /** @brief Set the safety factor and the bounds of the ratio between two
+       consecutive step sizes. */
+   void SetStepFactors(real_t safety_, real_t min_factor_, real_t max_factor_)
+   { safety = safety_; min_factor = min_factor_; max_factor = max_factor_; }
+
+   /** @brief Set the size of the first internal step, after Init(). By
+       default, it is the @a dt value of the first call to Step() or Run(). */
+   void SetInitialStepSize(real_t dt) { dt_next = dt; }
+
+   /// Proposed size of the next internal step.
+   real_t GetNextStepSize() const { return dt_next; }
+
+   /// Number of accepted internal steps since the last Init().
+   int GetNumSteps() const { return num_steps; }
+
+   /// Number of rejected internal steps since the last Init().
+   int GetNumRejectedSteps() const { return num_rejected; }
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+
+   void Run(Vector &x, real_t &t, real_t &dt, real_t tf) override
+   {
+      if (dt_next <= 0.0) { dt_next = dt; }
+      real_t dt_end = tf - t;
+      if (dt_end > 0.0) { Step(x, t, dt_end); }
+   }
+};
+
+
+/** @brief An embedded Runge-Kutta pair with a general Butcher tableau, either
+    explicit or explicit singly diagonal implicit (ESDIRK). */
+/** The tableau has the format of ExplicitRKSolver, with the weights @a b of
+    the solution and @a b_hat of the embedded method of order @a order_hat,
+    whose difference gives the error estimate:
+    +--------+-----------------------------+
+    | c[0]   | a[0]  gamma                 |
+    | c[1]   | a[1]  a[2]  gamma           |
+    | ...    |    ...                      |
+    | c[s-2] | ...   a[s(s-1)/2-1]  gamma  |
+    +--------+-----------------------------+
+    |        | b[0]     b[1]   ...  b[s-1] |
+    |        | b_hat[0] b_hat[1] ...       |
+    +--------+-----------------------------+
+    The first stage is explicit. With @a gamma > 0, the other stages are
+    implicit and are computed with TimeDependentOperator::ImplicitSolve().
+
+    With @a fsal (first same as last), the last stage is evaluated at the new
+    solution and is reused as the first stage of the next internal step. */
+class EmbeddedRKSolver : public AdaptiveODESolver
+{
+private:
+   int s, order_hat;
+   const real_t *a, *b, *b_hat, *c;
+   real_t gamma;
+   bool fsal, k0_valid;
+   Vector y, *k;
+
+protected:
+   void TryStep(const Vector &x, real_t t, real_t dt, Vector &x_new,
+                Vector &err) override;
+
+   void StepAccepted() override;
+
+   int GetErrorOrder() const override { return order_hat; }
+
+public:
+   EmbeddedRKSolver(int s_, const real_t *a_, const real_t *b_,
+                    const real_t *b_hat_, const real_t *c_, int order_hat_,
+                    bool fsal_, real_t gamma_ = 0.0);
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+
+   virtual ~EmbeddedRKSolver();
+};
+
+
+/** The 4-stage, 3rd order Bogacki-Shampine method with an embedded 2nd order
+    error estimate, FSAL. From P. Bogacki and L.F. Shampine, "A 3(2) pair of
+    Runge-Kutta formulas", Appl. Math. Lett., 2(4), 1989. */
+class BogackiShampineSolver : public EmbeddedRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[6], b[4], b_hat[4], c[3];
+
+public:
+   BogackiShampineSolver() : EmbeddedRKSolver(4, a, b, b_hat, c, 2, true) { }
+};
+
+
+/** The 7-stage, 5th order Dormand-Prince method with an embedded 4th order
+    error estimate, FSAL. From J.R. Dormand and P.J. Prince, "A family of
+    embedded Runge-Kutta formulae", J. Comput. Appl. Math., 6(1), 1980. */
+class DormandPrinceSolver : public EmbeddedRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[21], b[7], b_hat[7], c[6];
+
+public:
+   DormandPrinceSolver() : EmbeddedRKSolver(7, a, b, b_hat, c, 4, true) { }
+};
+
+
+/** The 6-stage, 5th order Cash-Karp method with an embedded 4th order error
+    estimate. From J.R. Cash and A.H. Karp, "A variable order Runge-Kutta
+    method for initial value problems with rapidly varying right-hand sides",
+    ACM Trans. Math. Softw., 16(3), 1990. */
+class CashKarpSolver : public EmbeddedRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[15], b[6], b_hat[6], c[5];
+
+public:
+   CashKarpSolver() : EmbeddedRKSolver(6, a, b, b_hat, c, 4, false) { }
+};
+
+
+/** The 4-stage, 3rd order ESDIRK3(2)4L[2]SA method with an embedded 2nd order
+    error estimate. L-stable and stiffly accurate. From C.A. Kennedy and M.H.
+    Carpenter, "Additive Runge-Kutta schemes for convection-diffusion-reaction
+    equations", Appl. Numer. Math., 44(1), 2003. */
+class AdaptiveESDIRK3Solver : public EmbeddedRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[6], b[4], b_hat[4], c[3];
+
+public:
+   AdaptiveESDIRK3Solver()
+      : EmbeddedRKSolver(4, a, b, b_hat, c, 2, true, b[3]) { }
+};
+
+
+/** The 6-stage, 4th order ESDIRK4(3)6L[2]SA method with an embedded 3rd order
+    error estimate. L-stable and stiffly accurate. From C.A. Kennedy and M.H.
+    Carpenter, "Additive Runge-Kutta schemes for convection-diffusion-reaction
+    equations", Appl. Numer. Math., 44(1), 2003. */
+class AdaptiveESDIRK4Solver : public EmbeddedRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[15], b[6], b_hat[6], c[5];
+
+public:
+   AdaptiveESDIRK4Solver()
+      : EmbeddedRKSolver(6, a, b, b_hat, c, 3, true, b[5]) { }
+};
+
+
+/** @brief Additive (IMEX) Runge-Kutta method for the ODE du/dt = k1(u,t) +
+    k2(u,t), where the nonstiff term k1 is treated explicitly and the stiff
+    term k2 with an ESDIRK method. */
+/** The two terms are selected with the evaluation modes of the
+    TimeDependentOperator, as for the IMEX type of ARKStepSolver: in the mode
+    TimeDependentOperator::ADDITIVE_TERM_1, Mult() computes k1, and in the mode
+    TimeDependentOperator::ADDITIVE_TERM_2, Mult() computes k2 and
+    ImplicitSolve() solves k = k2(u + gamma k, t). The mode is reset to
+    TimeDependentOperator::NORMAL at the end of each step.
+
+    The explicit tableau (@a ae, @a be) and the implicit tableau (@a ai, @a bi)
+    share the abscissae @a c, in the format of ExplicitRKSolver:
+    +--------+----------------------------+-------------------------------+
+    | c[0]   | ae[0]                      | ai[0]  gamma                  |
+    | c[1]   | ae[1]  ae[2]               | ai[1]  ai[2]  gamma           |
+    | ...    |    ...                     |    ...                        |
+    | c[s-2] | ...   ae[s(s-1)/2-1]       | ...   ai[s(s-1)/2-1]  gamma   |
+    +--------+----------------------------+-------------------------------+
+    |        | be[0]  be[1] ... be[s-1]   | bi[0]  bi[1] ... bi[s-1]      |
+    +--------+----------------------------+-------------------------------+
+    The first stage is explicit in both terms. When the first column of the
+    implicit tableau is zero, k2 is not evaluated at the first stage. */
+class IMEXRKSolver : public ODESolver
+{
+private:
+   int s;
+   const real_t *ae, *be, *ai, *bi, *c;
+   real_t gamma;
+   bool use_k2_0;
+   Vector y, *k1, *k2;
+
+public:
+   IMEXRKSolver(int s_, const real_t *ae_, const real_t *be_,
+                const real_t *ai_, const real_t *bi_, const real_t *c_,
+                real_t gamma_);
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+
+   virtual ~IMEXRKSolver();
+};
+
+
+/** The 4-stage, 3rd order ARK3(2)4L[2]SA additive RK method, whose implicit
+    part is L-stable and stiffly accurate. From C.A. Kennedy and M.H.
+    Carpenter, "Additive Runge-Kutta schemes for convection-diffusion-reaction
+    equations", Appl. Numer. Math., 44(1), 2003. */
+class IMEXARK3Solver : public IMEXRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t ae[6], ai[6], b[4], c[3];
+
+public:
+   IMEXARK3Solver() : IMEXRKSolver(4, ae, b, ai, b, c, b[3]) { }
+};
+
+
+/** The 5-stage, 3rd order ARS(4,4,3) additive RK method, whose implicit part
+    is L-stable and stiffly accurate. From U.M. Ascher, S.J. Ruuth and R.J.
+    Spiteri, "Implicit-explicit Runge-Kutta methods for time-dependent partial
+    differential equations", Appl. Numer. Math., 25(2-3), 1997. */
+class IMEXARS443Solver : public IMEXRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t ae[10], be[5], ai[10], bi[5], c[4];
+
+public:
+   IMEXARS443Solver() : IMEXRKSolver(5, ae, be, ai, bi, c, 0.5) { }
+};
+
+
 /// Generalized-alpha ODE solver from "A generalized-α method for integrating
 /// the filtered Navier-Stokes equations with a stabilized finite element
 /// method" by K.E. Jansen, C.H. Whiting and G.M. Hulbert.
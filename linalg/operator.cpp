@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 namespace mfem
 {
@@ -616,6 +617,14 @@ void ConstrainedOperator::ConstrainedMult(const Vector &x, Vector &y,
       A->Mult(z, y);
    }
 
+   ApplyDiagonalPolicy(x, y);
+}
+
+void ConstrainedOperator::ApplyDiagonalPolicy(const Vector &x,
+                                              Vector &y) const
+{
+   const int csz = constraint_list.Size();
+   auto idx = constraint_list.Read();
    auto d_x = x.Read();
    // Use read+write access - we are modifying sub-vector of y
    auto d_y = y.ReadWrite();
@@ -657,6 +666,37 @@ void ConstrainedOperator::MultTranspose(const Vector &x, Vector &y) const
    ConstrainedMult(x, y, transpose);
 }
 
+void ConstrainedOperator::ArrayMult(const Array<const Vector *> &X,
+                                    Array<Vector *> &Y) const
+{
+   const int csz = constraint_list.Size();
+   if (csz == 0)
+   {
+      A->ArrayMult(X, Y);
+      return;
+   }
+
+   // Constrained copies of all inputs, so that A is applied to all of them at
+   // once.
+   const int nvec = X.Size();
+   zs.SetSize(width*nvec, GetMemoryType(mem_class));
+   std::vector<Vector> zv(nvec);
+   Array<const Vector *> Z(nvec);
+   auto idx = constraint_list.Read();
+   for (int j = 0; j < nvec; j++)
+   {
+      zv[j].MakeRef(zs, j*width, width);
+      zv[j] = *X[j];
+      auto d_z = zv[j].ReadWrite();
+      mfem::forall(csz, [=] MFEM_HOST_DEVICE (int i) { d_z[idx[i]] = 0.0; });
+      Z[j] = &zv[j];
+   }
+
+   A->ArrayMult(Z, Y);
+
+   for (int j = 0; j < nvec; j++) { ApplyDiagonalPolicy(*X[j], *Y[j]); }
+}
+
 void ConstrainedOperator::AddMult(const Vector &x, Vector &y,
                                   const real_t a) const
 {
@@ -995,9 +995,13 @@ protected:
    Operator *A;                 ///< The unconstrained Operator.
    bool own_A;                  ///< Ownership flag for A.
    mutable Vector z, w;         ///< Auxiliary vectors.
+   mutable Vector zs;           ///< Auxiliary vectors of ArrayMult().
    MemoryClass mem_class;
    DiagonalPolicy diag_policy;  ///< Diagonal policy for constrained dofs
 
+   /// Set the constrained entries of @a y according to the DiagonalPolicy.
+   void ApplyDiagonalPolicy(const Vector &x, Vector &y) const;
+
 public:
    /** @brief Constructor from a general Operator and a list of essential
        indices/dofs.
@@ -1045,6 +1049,11 @@ public:
 
    void AddMult(const Vector &x, Vector &y, const real_t a = 1.0) const override;
 
+   /** @brief Constrained operator action on several vectors, using a single
+       call to A->ArrayMult(). */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
    void MultTranspose(const Vector &x, Vector &y) const override;
 
    /** @brief Implementation of Mult or MultTranspose.
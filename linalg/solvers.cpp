@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cmath>
 #include <set>
+#include <vector>
 
 namespace mfem
 {
@@ -69,6 +70,75 @@ real_t IterativeSolver::Dot(const Vector &x, const Vector &y) const
 #endif
 }
 
+real_t IterativeSolver::AddDot(real_t a, const Vector &x, Vector &y,
+                               const Vector &z) const
+{
+   if (!UseFusedDot())
+   {
+      y.Add(a, x);
+      return Dot(y, z);
+   }
+   real_t dot = mfem::AddDot(a, x, y, z);
+   StartGlobalSum(&dot, 1);
+   FinishGlobalSum();
+   return dot;
+}
+
+real_t IterativeSolver::AddAddDot(real_t a, const Vector &x, Vector &y,
+                                  real_t b, const Vector &u, Vector &v,
+                                  const Vector &w) const
+{
+   if (!UseFusedDot())
+   {
+      y.Add(a, x);
+      v.Add(b, u);
+      return Dot(v, w);
+   }
+   real_t dot = mfem::AddAddDot(a, x, y, b, u, v, w);
+   StartGlobalSum(&dot, 1);
+   FinishGlobalSum();
+   return dot;
+}
+
+void IterativeSolver::MDot(const Vector &x, int n, const Vector *const *v,
+                           real_t *dots) const
+{
+   if (!UseFusedDot())
+   {
+      for (int k = 0; k < n; k++) { dots[k] = Dot(x, *v[k]); }
+      return;
+   }
+   mfem::MDot(x, n, v, dots);
+   StartGlobalSum(dots, n);
+   FinishGlobalSum();
+}
+
+void IterativeSolver::StartGlobalSum(real_t *data, int n) const
+{
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type == 0) { return; }
+#if MPI_VERSION >= 3
+   MPI_Iallreduce(MPI_IN_PLACE, data, n, MFEM_MPI_REAL_T, MPI_SUM, comm,
+                  &sum_request);
+#else
+   MPI_Allreduce(MPI_IN_PLACE, data, n, MFEM_MPI_REAL_T, MPI_SUM, comm);
+#endif
+#else
+   MFEM_CONTRACT_VAR(data);
+   MFEM_CONTRACT_VAR(n);
+#endif
+}
+
+void IterativeSolver::FinishGlobalSum() const
+{
+#if defined(MFEM_USE_MPI) && MPI_VERSION >= 3
+   if (sum_request != MPI_REQUEST_NULL)
+   {
+      MPI_Wait(&sum_request, MPI_STATUS_IGNORE);
+   }
+#endif
+}
+
 void IterativeSolver::SetPrintLevel(int print_lvl)
 {
    print_options = FromLegacyPrintLevel(print_lvl);
@@ -706,6 +776,84 @@ void SLI(const Operator &A, Solver &B, const Vector &b, Vector &x,
    sli.Mult(b, x);
 }
 
+void MixedPrecisionSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   r.SetSize(width, mt); r.UseDevice(true);
+   e.SetSize(width, mt); e.UseDevice(true);
+}
+
+void MixedPrecisionSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_VERIFY(inner != NULL, "the inner solver is not set");
+   int i;
+   real_t r0, nom, nom0, nomold;
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+   nom0 = nom = nomold = Norm(r);
+   initial_norm = nom0;
+   MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Iteration : " << setw(3) << right << 0 << "  ||r|| = "
+                << nom << (print_options.first_and_last ? " ..." : "") << '\n';
+   }
+   Monitor(0, nom, r, x);
+
+   r0 = std::max(nom*rel_tol, abs_tol);
+   converged = nom <= r0;
+   final_iter = 0;
+   for (i = 1; !converged && i <= max_iter; i++)
+   {
+      // Correction for the residual scaled to unit norm
+      r *= 1.0/nom;
+      inner->Mult(r, e);
+      x.Add(nom, e);
+
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+      nom = Norm(r);
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      final_iter = i;
+      converged = nom <= r0;
+
+      if (print_options.iterations ||
+          ((converged || i == max_iter) && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << right << i
+                   << "  ||r|| = " << setw(11) << left << nom
+                   << "\tConv. rate: " << nom/nomold << '\n';
+      }
+      Monitor(i, nom, r, x);
+      nomold = nom;
+   }
+
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "MixedPrecisionSolver: Number of iterations: " << final_iter
+                << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "MixedPrecisionSolver: No convergence!" << '\n';
+   }
+
+   final_norm = nom;
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
 
 void CGSolver::UpdateVectors()
 {
@@ -718,6 +866,7 @@ void CGSolver::UpdateVectors()
 
 void CGSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("CGSolver::Mult");
    int i;
    real_t r0, den, nom, nom0, betanom, alpha, beta;
 
@@ -798,18 +947,18 @@ void CGSolver::Mult(const Vector &b, Vector &x) const
    final_iter = max_iter;
    for (i = 1; true; )
    {
+      MFEM_PERF_SCOPE("CGSolver iteration");
       alpha = nom/den;
-      add(x,  alpha, d, x);     //  x = x + alpha d
-      add(r, -alpha, z, r);     //  r = r - alpha A d
-
+      //  x = x + alpha d, r = r - alpha A d
       if (prec)
       {
+         AddAdd(alpha, d, x, -alpha, z, r);
          prec->Mult(r, z);      //  z = B r
          betanom = Dot(r, z);
       }
       else
       {
-         betanom = Dot(r, r);
+         betanom = AddAddDot(alpha, d, x, -alpha, z, r, r); //  (r, r)
       }
       MFEM_VERIFY(IsFinite(betanom), "betanom = " << betanom);
       if (betanom < 0.0)
@@ -834,97 +983,760 @@ void CGSolver::Mult(const Vector &b, Vector &x) const
 
       if (betanom <= r0)
       {
-         converged = true;
+         converged = true;
+         final_iter = i;
+         break;
+      }
+
+      if (++i > max_iter)
+      {
+         break;
+      }
+
+      beta = betanom/nom;
+      if (prec)
+      {
+         add(z, beta, d, d);   //  d = z + beta d
+      }
+      else
+      {
+         add(r, beta, d, d);
+      }
+      oper->Mult(d, z);       //  z = A d
+      den = Dot(d, z);
+      MFEM_VERIFY(IsFinite(den), "den = " << den);
+      if (den <= 0.0)
+      {
+         if (Dot(d, d) > 0.0 && print_options.warnings)
+         {
+            mfem::out << "PCG: The operator is not positive definite. (Ad, d) = "
+                      << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      nom = betanom;
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << betanom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "PCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.summary || print_options.iterations ||
+       print_options.first_and_last)
+   {
+      const auto arf = pow (betanom/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "PCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(betanom);
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+void CG(const Operator &A, const Vector &b, Vector &x,
+        int print_iter, int max_num_iter,
+        real_t RTOLERANCE, real_t ATOLERANCE)
+{
+   MFEM_PERF_FUNCTION;
+
+   CGSolver cg;
+   cg.SetPrintLevel(print_iter);
+   cg.SetMaxIter(max_num_iter);
+   cg.SetRelTol(sqrt(RTOLERANCE));
+   cg.SetAbsTol(sqrt(ATOLERANCE));
+   cg.SetOperator(A);
+   cg.Mult(b, x);
+}
+
+void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
+         int print_iter, int max_num_iter,
+         real_t RTOLERANCE, real_t ATOLERANCE)
+{
+   MFEM_PERF_FUNCTION;
+
+   CGSolver pcg;
+   pcg.SetPrintLevel(print_iter);
+   pcg.SetMaxIter(max_num_iter);
+   pcg.SetRelTol(sqrt(RTOLERANCE));
+   pcg.SetAbsTol(sqrt(ATOLERANCE));
+   pcg.SetOperator(A);
+   pcg.SetPreconditioner(B);
+   pcg.Mult(b, x);
+}
+
+void PipelinedCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (Vector *v : {&r, &u, &w, &m, &n, &p, &q, &s, &z})
+   {
+      v->SetSize(width, mt); v->UseDevice(true);
+   }
+}
+
+void PipelinedCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_PERF_SCOPE("PipelinedCGSolver::Mult");
+   // Pipelined PCG from P. Ghysels and W. Vanroose, "Hiding global
+   // synchronization latency in the preconditioned Conjugate Gradient
+   // algorithm", Parallel Computing, 40(7), 2014. Without a preconditioner,
+   // u = r, m = w and q = s.
+   const bool use_prec = (prec != NULL);
+   Vector &U = use_prec ? u : r;
+   Vector &M = use_prec ? m : w;
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+   if (use_prec) { prec->Mult(r, u); } // u = B r
+   oper->Mult(U, w);                    // w = A u
+
+   // The first update multiplies the previous directions by beta = 0: they
+   // must not contain NaNs from uninitialized memory.
+   z = 0.0;
+   s = 0.0;
+   p = 0.0;
+   if (use_prec) { q = 0.0; }
+
+   real_t nom0 = 0.0, r0 = 0.0, gamma = 0.0, gamma_old = 0.0, alpha = 0.0;
+   converged = false;
+   final_iter = max_iter;
+   for (int i = 0; true; i++)
+   {
+      const Vector *rw[2] = { &r, &w };
+      real_t dots[2];
+      mfem::MDot(U, 2, rw, dots); // (B r, r) and (A u, u)
+      StartGlobalSum(dots, 2);
+      if (use_prec) { prec->Mult(w, m); } // m = B w
+      oper->Mult(M, n);                    // n = A m
+      FinishGlobalSum();
+      gamma = dots[0];
+      const real_t delta = dots[1];
+      MFEM_VERIFY(IsFinite(gamma), "(B r, r) = " << gamma);
+      MFEM_VERIFY(IsFinite(delta), "(A u, u) = " << delta);
+
+      if (i == 0)
+      {
+         nom0 = gamma;
+         if (nom0 >= 0.0) { initial_norm = sqrt(nom0); }
+         if (print_options.iterations || print_options.first_and_last)
+         {
+            mfem::out << "   Iteration : " << setw(3) << 0 << "  (B r, r) = "
+                      << gamma
+                      << (print_options.first_and_last ? " ...\n" : "\n");
+         }
+         Monitor(0, gamma, r, x);
+         r0 = std::max(gamma*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      else
+      {
+         if (print_options.iterations)
+         {
+            mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                      << gamma << std::endl;
+         }
+         Monitor(i, gamma, r, x);
+      }
+      if (gamma < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << gamma << '\n';
+         }
+         final_iter = i;
+         break;
+      }
+      if (gamma <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+      if (i == max_iter) { break; }
+
+      // (A p, p), where p is the new search direction
+      const real_t beta = (i > 0) ? gamma/gamma_old : 0.0;
+      const real_t den = (i > 0) ? delta - beta*gamma/alpha : delta;
+      if (den <= 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The operator is not positive definite. "
+                      "(Ap, p) = " << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      alpha = gamma/den;
+      gamma_old = gamma;
+
+      // All the vector updates of the iteration in one pass
+      const int N = width;
+      const real_t a = alpha, bt = beta;
+      auto d_n = n.Read();
+      auto d_z = z.ReadWrite();
+      auto d_s = s.ReadWrite();
+      auto d_p = p.ReadWrite();
+      auto d_x = x.ReadWrite();
+      auto d_r = r.ReadWrite();
+      auto d_w = w.ReadWrite();
+      if (use_prec)
+      {
+         auto d_m = m.Read();
+         auto d_q = q.ReadWrite();
+         auto d_u = u.ReadWrite();
+         mfem::forall(N, [=] MFEM_HOST_DEVICE (int k)
+         {
+            d_z[k] = d_n[k] + bt*d_z[k];
+            d_q[k] = d_m[k] + bt*d_q[k];
+            d_s[k] = d_w[k] + bt*d_s[k];
+            d_p[k] = d_u[k] + bt*d_p[k];
+            d_x[k] += a*d_p[k];
+            d_r[k] -= a*d_s[k];
+            d_u[k] -= a*d_q[k];
+            d_w[k] -= a*d_z[k];
+         });
+      }
+      else
+      {
+         mfem::forall(N, [=] MFEM_HOST_DEVICE (int k)
+         {
+            d_z[k] = d_n[k] + bt*d_z[k];
+            d_s[k] = d_w[k] + bt*d_s[k];
+            d_p[k] = d_r[k] + bt*d_p[k];
+            d_x[k] += a*d_p[k];
+            d_r[k] -= a*d_s[k];
+            d_w[k] -= a*d_z[k];
+         });
+      }
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << gamma << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "PipelinedCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "PipelinedCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(std::max(gamma, real_t(0.0)));
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+// Cholesky factorization L L^T of the symmetric matrix A, in place in the
+// lower triangle. The pivots that are not positive relative to the diagonal
+// of A correspond to numerically dependent vectors: they are set to zero, and
+// CholeskySolve() sets the corresponding solution components to zero.
+static void CholeskyFactor(DenseMatrix &A)
+{
+   const int n = A.Height();
+   const real_t tol = 100*std::numeric_limits<real_t>::epsilon();
+   for (int j = 0; j < n; j++)
+   {
+      real_t d = A(j,j);
+      for (int k = 0; k < j; k++) { d -= A(j,k)*A(j,k); }
+      if (!(d > tol*A(j,j)))
+      {
+         for (int i = j; i < n; i++) { A(i,j) = 0.0; }
+         continue;
+      }
+      d = sqrt(d);
+      A(j,j) = d;
+      for (int i = j + 1; i < n; i++)
+      {
+         real_t a = A(i,j);
+         for (int k = 0; k < j; k++) { a -= A(i,k)*A(j,k); }
+         A(i,j) = a/d;
+      }
+   }
+}
+
+// Solve L L^T x = b with the factor computed by CholeskyFactor(), in place.
+static void CholeskySolve(const DenseMatrix &L, real_t *b)
+{
+   const int n = L.Height();
+   for (int i = 0; i < n; i++)
+   {
+      if (L(i,i) == 0.0) { b[i] = 0.0; continue; }
+      for (int k = 0; k < i; k++) { b[i] -= L(i,k)*b[k]; }
+      b[i] /= L(i,i);
+   }
+   for (int i = n - 1; i >= 0; i--)
+   {
+      if (L(i,i) == 0.0) { b[i] = 0.0; continue; }
+      for (int k = i + 1; k < n; k++) { b[i] -= L(k,i)*b[k]; }
+      b[i] /= L(i,i);
+   }
+}
+
+void SStepCGSolver::SetNumSteps(int steps)
+{
+   MFEM_VERIFY(steps >= 1, "invalid number of steps: " << steps);
+   s = steps;
+   if (oper) { UpdateVectors(); }
+}
+
+void SStepCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (Vector *v : {&r, &z, &Az})
+   {
+      v->SetSize(width, mt); v->UseDevice(true);
+   }
+   for (Vector *v : {&P, &AP, &BAP, &ABAP, &R, &AR, &BAR, &ABAR})
+   {
+      v->SetSize(s*width, mt); v->UseDevice(true);
+   }
+}
+
+void SStepCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_PERF_SCOPE("SStepCGSolver::Mult");
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+   // z = B r and Az = A z are updated with recurrences, see below.
+   if (prec) { prec->Mult(r, z); }
+   else { z = r; }
+   oper->Mult(z, Az);
+
+   // W = P^T A P for the search directions P of the previous step, factored.
+   DenseMatrix W, RAR, G, C;
+   Vector rhs, dots;
+   // Column views of the blocks, for the fused inner products.
+   std::vector<Vector> Rc(s), Pc(s), APc(s);
+   Array<const Vector*> pR(s), pP(s), pAP(s);
+   for (int j = 0; j < s; j++)
+   {
+      pR[j] = &Rc[j];
+      pP[j] = &Pc[j];
+      pAP[j] = &APc[j];
+   }
+   int sp = 0; // number of directions of the previous step
+   real_t theta = 1.0, nom0 = 0.0, nom = 0.0, r0 = 0.0;
+   real_t nom_repl = 0.0; // (B r, r) at the last recomputation of z and Az
+   converged = false;
+   final_iter = max_iter;
+   for (int it = 0; true; )
+   {
+      const int sk = std::min(s, std::max(max_iter - it, 1));
+
+      // Basis R = [z, BA z, ..., (BA)^{sk-1} z] / theta^j and AR = A R.
+      Vector R0(R, 0, width), AR0(AR, 0, width);
+      R0 = z;
+      AR0 = Az;
+      for (int j = 0; j + 1 < sk; j++)
+      {
+         Vector ARj(AR, j*width, width);
+         Vector Rn(R, (j + 1)*width, width), ARn(AR, (j + 1)*width, width);
+         if (prec) { prec->Mult(ARj, Rn); }
+         else { Rn = ARj; }
+         Rn *= 1.0/theta;
+         oper->Mult(Rn, ARn);
+      }
+
+      // All the inner products of the step in one reduction: R^T A R (upper
+      // triangle), G = (A P_prev)^T R, R^T r and P_prev^T r.
+      const int nrar = sk*(sk + 1)/2, nr = nrar + sp*sk;
+      dots.SetSize(nr + sk + sp);
+      for (int j = 0; j < s; j++)
+      {
+         Rc[j].MakeRef(R, j*width, width);
+         Pc[j].MakeRef(P, j*width, width);
+         APc[j].MakeRef(AP, j*width, width);
+      }
+      int d = 0;
+      for (int j = 0; j < sk; j++)
+      {
+         Vector ARj(AR, j*width, width);
+         mfem::MDot(ARj, j + 1, pR.GetData(), dots.GetData() + d);
+         d += j + 1;
+      }
+      for (int j = 0; j < sk; j++)
+      {
+         mfem::MDot(Rc[j], sp, pAP.GetData(), dots.GetData() + d);
+         d += sp;
+      }
+      mfem::MDot(r, sk, pR.GetData(), dots.GetData() + d);
+      mfem::MDot(r, sp, pP.GetData(), dots.GetData() + d + sk);
+      StartGlobalSum(dots.GetData(), dots.Size());
+
+      // While the sum is in progress, apply B and A to the last basis vector:
+      // BA R and ABA R are needed to update z and Az below, which replaces
+      // the first applications of B and A of the next step.
+      {
+         Vector ARl(AR, (sk - 1)*width, width);
+         Vector BARl(BAR, (sk - 1)*width, width);
+         Vector ABARl(ABAR, (sk - 1)*width, width);
+         if (prec) { prec->Mult(ARl, BARl); }
+         else { BARl = ARl; }
+         oper->Mult(BARl, ABARl);
+      }
+      FinishGlobalSum();
+      MFEM_VERIFY(dots.CheckFinite() == 0, "non-finite inner products");
+
+      nom = dots(nr); // (B r, r)
+      if (it == 0)
+      {
+         nom0 = nom_repl = nom;
+         if (nom0 >= 0.0) { initial_norm = sqrt(nom0); }
+         if (print_options.iterations || print_options.first_and_last)
+         {
+            mfem::out << "   Iteration : " << setw(3) << 0 << "  (B r, r) = "
+                      << nom
+                      << (print_options.first_and_last ? " ...\n" : "\n");
+         }
+         Monitor(0, nom, r, x);
+         r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      else
+      {
+         if (print_options.iterations)
+         {
+            mfem::out << "   Iteration : " << setw(3) << it << "  (B r, r) = "
+                      << nom << std::endl;
+         }
+         Monitor(it, nom, r, x);
+      }
+      if (nom < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "SStepCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << nom << '\n';
+         }
+         final_iter = it;
+         break;
+      }
+      if (nom <= r0)
+      {
+         converged = true;
+         final_iter = it;
+         break;
+      }
+      if (it >= max_iter) { break; }
+
+      RAR.SetSize(sk);
+      d = 0;
+      for (int j = 0; j < sk; j++)
+      {
+         for (int i = 0; i <= j; i++) { RAR(i,j) = RAR(j,i) = dots(d++); }
+      }
+      if (RAR(0,0) <= 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "SStepCG: The operator is not positive definite. "
+                      "(Az, z) = " << RAR(0,0) << '\n';
+         }
+         final_iter = it;
+         break;
+      }
+      // BA R = [theta R_1, ..., theta R_{sk-1}, BA R_{sk-1}] and ABA R.
+      for (int j = 0; j + 1 < sk; j++)
+      {
+         Vector(BAR, j*width, width).Set(theta, Vector(R, (j + 1)*width, width));
+         Vector(ABAR, j*width, width).Set(theta,
+                                          Vector(AR, (j + 1)*width, width));
+      }
+      // Scaling of the next basis: estimate of the spectral radius of BA from
+      // the growth of the A-norm of the basis vectors.
+      if (sk > 1 && RAR(sk-1,sk-1) > 0.0)
+      {
+         theta *= pow(RAR(sk-1,sk-1)/RAR(0,0), 0.5/(sk-1));
+      }
+
+      // Make the directions A-orthogonal to the previous ones:
+      // P = R - P_prev C, AP = AR - AP_prev C (and the same for BA P and ABA P),
+      // with C = W_prev^{-1} G, so that
+      // P^T A P = R^T A R - G^T C and P^T r = R^T r - C^T P_prev^T r. The last
+      // term vanishes in exact arithmetic, but not in finite precision.
+      rhs.SetSize(sk);
+      for (int j = 0; j < sk; j++) { rhs(j) = dots(nr + j); }
+      if (sp > 0)
+      {
+         G.SetSize(sp, sk);
+         for (int j = 0; j < sk; j++)
+         {
+            for (int i = 0; i < sp; i++) { G(i,j) = dots(d++); }
+         }
+         C = G;
+         for (int j = 0; j < sk; j++) { CholeskySolve(W, C.GetColumn(j)); }
+         AddMult_a_AtB(-1.0, G, C, RAR);
+         for (int j = 0; j < sk; j++)
+         {
+            for (int i = 0; i < sp; i++) { rhs(j) -= C(i,j)*dots(nr + sk + i); }
+         }
+         for (int j = 0; j < sk; j++)
+         {
+            Vector Rj(R, j*width, width), ARj(AR, j*width, width);
+            Vector BARj(BAR, j*width, width), ABARj(ABAR, j*width, width);
+            for (int i = 0; i < sp; i++)
+            {
+               Rj.Add(-C(i,j), Vector(P, i*width, width));
+               ARj.Add(-C(i,j), Vector(AP, i*width, width));
+               BARj.Add(-C(i,j), Vector(BAP, i*width, width));
+               ABARj.Add(-C(i,j), Vector(ABAP, i*width, width));
+            }
+         }
+      }
+      P.Swap(R);
+      AP.Swap(AR);
+      BAP.Swap(BAR);
+      ABAP.Swap(ABAR);
+      W = RAR;
+      CholeskyFactor(W);
+      sp = sk;
+
+      // Minimize the A-norm of the error over x + span(P).
+      CholeskySolve(W, rhs.GetData());
+      for (int j = 0; j < sk; j++)
+      {
+         x.Add(rhs(j), Vector(P, j*width, width));
+         r.Add(-rhs(j), Vector(AP, j*width, width));
+         z.Add(-rhs(j), Vector(BAP, j*width, width));
+         Az.Add(-rhs(j), Vector(ABAP, j*width, width));
+      }
+      // The recurrences of z and Az drift away from B r and A z, as the basis
+      // gets ill-conditioned with s: recompute them each time (B r, r) has
+      // decreased by 1e4.
+      if (nom < 1e-4*nom_repl)
+      {
+         if (prec) { prec->Mult(r, z); }
+         else { z = r; }
+         oper->Mult(z, Az);
+         nom_repl = nom;
+      }
+      it += sk;
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "SStepCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "SStepCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(std::max(nom, real_t(0.0)));
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+void BlockCGSolver::UpdateVectors(int nvec) const
+{
+   if (R.VectorSize() == width && R.NumVectors() == nvec) { return; }
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (MultiVector *V : {&R, &Z, &P, &Q})
+   {
+      V->UseDevice(true); V->SetSize(width, nvec, mt);
+   }
+}
+
+void BlockCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   Array<const Vector *> B(1);
+   Array<Vector *> X(1);
+   B[0] = &b;
+   X[0] = &x;
+   ArrayMult(B, X);
+}
+
+void BlockCGSolver::ArrayMult(const Array<const Vector *> &B,
+                              Array<Vector *> &X) const
+{
+   // Block PCG from D. P. O'Leary, "The block conjugate gradient algorithm and
+   // related methods", Linear Algebra and its Applications, 29, 1980. Without
+   // a preconditioner, Z = R. The new search directions are formed in the
+   // storage of Q, which is free at the end of the iteration.
+   MFEM_VERIFY(B.Size() == X.Size(), "Number of columns mismatch!");
+   const int nvec = B.Size();
+   if (nvec == 0) { return; }
+   UpdateVectors(nvec);
+   const bool use_prec = (prec != NULL);
+   MultiVector &Zr = use_prec ? Z : R;
+   MultiVector *p = &P, *q = &Q;
+
+   Array<const Vector *> Xc(nvec);
+   for (int j = 0; j < nvec; j++)
+   {
+      X[j]->UseDevice(true);
+      Xc[j] = X[j];
+   }
+   Array<Vector *> &Rc = R.GetColumns();
+   if (iterative_mode)
+   {
+      oper->ArrayMult(Xc, Rc);
+      for (int j = 0; j < nvec; j++) { subtract(*B[j], *Rc[j], *Rc[j]); }
+   }
+   else
+   {
+      for (int j = 0; j < nvec; j++)
+      {
+         *Rc[j] = *B[j];
+         *X[j] = 0.0;
+      }
+   }
+   R.SyncFromColumns();
+   if (use_prec)
+   {
+      prec->ArrayMult(R.GetConstColumns(), Z.GetColumns()); // Z = B R
+      Z.SyncFromColumns();
+   }
+   *p = Zr;
+
+   // ZR(i,j) = (Z_i, R_j), the diagonal gives the (B r, r) of each column
+   DenseMatrix ZR, ZR_new, PQ, L, alpha, beta;
+   Zr.InnerProducts(R, ZR);
+   StartGlobalSum(ZR.Data(), nvec*nvec);
+   FinishGlobalSum();
+
+   Vector r0(nvec);
+   real_t nom = 0.0;
+   for (int j = 0; j < nvec; j++)
+   {
+      r0(j) = std::max(ZR(j,j)*rel_tol*rel_tol, abs_tol*abs_tol);
+      nom = std::max(nom, ZR(j,j));
+   }
+   if (nom >= 0.0) { initial_norm = sqrt(nom); }
+
+   converged = false;
+   final_iter = max_iter;
+   for (int i = 0; true; i++)
+   {
+      nom = 0.0;
+      bool done = true, indefinite = false;
+      for (int j = 0; j < nvec; j++)
+      {
+         MFEM_VERIFY(IsFinite(ZR(j,j)), "(B r, r) = " << ZR(j,j));
+         nom = std::max(nom, ZR(j,j));
+         done = done && ZR(j,j) <= r0(j);
+         indefinite = indefinite || ZR(j,j) < 0.0;
+      }
+      if (print_options.iterations ||
+          (i == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << i
+                   << "  max (B r, r) = " << nom
+                   << (i == 0 && print_options.first_and_last &&
+                       !print_options.iterations ? " ...\n" : "\n");
+      }
+      if (indefinite)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "BlockCG: The preconditioner is not positive "
+                      "definite.\n";
+         }
          final_iter = i;
          break;
       }
-
-      if (++i > max_iter)
+      if (done)
       {
+         converged = true;
+         final_iter = i;
          break;
       }
+      if (i == max_iter) { break; }
 
-      beta = betanom/nom;
-      if (prec)
-      {
-         add(z, beta, d, d);   //  d = z + beta d
-      }
-      else
+      p->SyncToColumns();
+      oper->ArrayMult(p->GetConstColumns(), q->GetColumns()); // Q = A P
+      q->SyncFromColumns();
+      p->InnerProducts(*q, PQ);
+      StartGlobalSum(PQ.Data(), nvec*nvec);
+      FinishGlobalSum();
+
+      // alpha = (P^T A P)^{-1} (Z^T R); dependent directions are dropped
+      L = PQ;
+      CholeskyFactor(L);
+      alpha = ZR;
+      for (int j = 0; j < nvec; j++) { CholeskySolve(L, alpha.GetColumn(j)); }
+
+      for (int j = 0; j < nvec; j++)
       {
-         add(r, beta, d, d);
+         MAdd(*X[j], nvec, alpha.GetColumn(j), p->GetConstColumns().GetData());
       }
-      oper->Mult(d, z);       //  z = A d
-      den = Dot(d, z);
-      MFEM_VERIFY(IsFinite(den), "den = " << den);
-      if (den <= 0.0)
+      R.AddMult(*q, alpha, -1.0);
+      if (use_prec)
       {
-         if (Dot(d, d) > 0.0 && print_options.warnings)
-         {
-            mfem::out << "PCG: The operator is not positive definite. (Ad, d) = "
-                      << den << '\n';
-         }
-         if (den == 0.0)
-         {
-            final_iter = i;
-            break;
-         }
+         R.SyncToColumns();
+         prec->ArrayMult(R.GetConstColumns(), Z.GetColumns());
+         Z.SyncFromColumns();
       }
-      nom = betanom;
+      Zr.InnerProducts(R, ZR_new);
+      StartGlobalSum(ZR_new.Data(), nvec*nvec);
+      FinishGlobalSum();
+
+      // beta = (Z^T R)_old^{-1} (Z^T R), P = Z + P beta
+      L = ZR;
+      CholeskyFactor(L);
+      beta = ZR_new;
+      for (int j = 0; j < nvec; j++) { CholeskySolve(L, beta.GetColumn(j)); }
+      ZR = ZR_new;
+      *q = Zr;
+      q->AddMult(*p, beta);
+      std::swap(p, q);
    }
    if (print_options.first_and_last && !print_options.iterations)
    {
-      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
-                << betanom << '\n';
+      mfem::out << "   Iteration : " << setw(3) << final_iter
+                << "  max (B r, r) = " << nom << '\n';
    }
    if (print_options.summary || (print_options.warnings && !converged))
    {
-      mfem::out << "PCG: Number of iterations: " << final_iter << '\n';
-   }
-   if (print_options.summary || print_options.iterations ||
-       print_options.first_and_last)
-   {
-      const auto arf = pow (betanom/nom0, 0.5/final_iter);
-      mfem::out << "Average reduction factor = " << arf << '\n';
+      mfem::out << "BlockCG: Number of iterations: " << final_iter << '\n';
    }
    if (print_options.warnings && !converged)
    {
-      mfem::out << "PCG: No convergence!" << '\n';
+      mfem::out << "BlockCG: No convergence!" << '\n';
    }
 
-   final_norm = sqrt(betanom);
-
-   Monitor(final_iter, final_norm, r, x, true);
-}
-
-void CG(const Operator &A, const Vector &b, Vector &x,
-        int print_iter, int max_num_iter,
-        real_t RTOLERANCE, real_t ATOLERANCE)
-{
-   MFEM_PERF_FUNCTION;
-
-   CGSolver cg;
-   cg.SetPrintLevel(print_iter);
-   cg.SetMaxIter(max_num_iter);
-   cg.SetRelTol(sqrt(RTOLERANCE));
-   cg.SetAbsTol(sqrt(ATOLERANCE));
-   cg.SetOperator(A);
-   cg.Mult(b, x);
-}
-
-void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
-         int print_iter, int max_num_iter,
-         real_t RTOLERANCE, real_t ATOLERANCE)
-{
-   MFEM_PERF_FUNCTION;
-
-   CGSolver pcg;
-   pcg.SetPrintLevel(print_iter);
-   pcg.SetMaxIter(max_num_iter);
-   pcg.SetRelTol(sqrt(RTOLERANCE));
-   pcg.SetAbsTol(sqrt(ATOLERANCE));
-   pcg.SetOperator(A);
-   pcg.SetPreconditioner(B);
-   pcg.Mult(b, x);
+   final_norm = sqrt(std::max(nom, real_t(0.0)));
 }
 
 
@@ -978,20 +1790,159 @@ inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
    }
 }
 
+void GMRESSolver::Orthogonalize(Vector &w, const Array<Vector*> &v, int i,
+                                real_t *h) const
+{
+   if (ortho == Orthogonalization::MGS)
+   {
+      // The update of w with v[k-1] is fused with the inner product with v[k].
+      h[0] = Dot(w, *v[0]);                          // h[0] = w * v[0]
+      for (int k = 1; k <= i; k++)
+      {
+         h[k] = AddDot(-h[k-1], *v[k-1], w, *v[k]);  // w -= h[k-1] * v[k-1]
+      }
+      h[i+1] = sqrt(AddDot(-h[i], *v[i], w, w));     // w -= h[i] * v[i]
+      return;
+   }
+
+   // Classical Gram-Schmidt: the inner products with the basis and the norm
+   // of w in one reduction; the norm of the orthogonalized w is then
+   // ||w||^2 - sum_k h[k]^2.
+   Array<const Vector*> vw(i + 2);
+   for (int k = 0; k <= i; k++) { vw[k] = v[k]; }
+   vw[i+1] = &w;
+   Vector c(i + 2);
+   const int passes = (ortho == Orthogonalization::CGS2) ? 2 : 1;
+   for (int k = 0; k <= i; k++) { h[k] = 0.0; }
+   for (int pass = 0; pass < passes; pass++)
+   {
+      MDot(w, i + 2, vw.GetData(), c.GetData());
+      real_t nrm2 = c(i+1);
+      for (int k = 0; k <= i; k++)
+      {
+         h[k] += c(k);
+         nrm2 -= c(k)*c(k);
+         c(k) = -c(k);
+      }
+      mfem::MAdd(w, i + 1, c.GetData(), vw.GetData());
+      h[i+1] = sqrt(std::max(nrm2, real_t(0.0)));
+      // With a large cancellation, the norm is not accurate: compute it.
+      if (pass + 1 == passes && nrm2 <= 1e-4*c(i+1))
+      {
+         h[i+1] = Norm(w);
+      }
+   }
+}
+
+real_t GMRESSolver::ReorthogonalizeDCGS2(const Array<Vector*> &v, int i,
+                                         const real_t *c, DenseMatrix &H) const
+{
+   // c = [v[0], ..., v[i-1], u]^T u, with u = v[i]. Then u = V a + nu v[i],
+   // with a = c[0..i-1] and nu^2 = (u, u) - |a|^2. The first basis vector
+   // is normalized exactly by Mult().
+   if (i == 0) { return 1.0; }
+   Vector &u = *v[i];
+   real_t nrm2 = c[i];
+   Vector ca(i);
+   for (int k = 0; k < i; k++)
+   {
+      nrm2 -= c[k]*c[k];
+      ca(k) = -c[k];
+   }
+   mfem::MAdd(u, i, ca.GetData(), v.GetData());
+   real_t nu = sqrt(std::max(nrm2, real_t(0.0)));
+   // With a large cancellation, the norm is not accurate: compute it.
+   if (nrm2 <= 1e-4*c[i]) { nu = Norm(u); }
+   u *= 1.0/nu;
+   for (int k = 0; k < i; k++) { H(k,i-1) += c[k]; }
+   H(i,i-1) = nu;
+   return nu;
+}
+
+void GMRESSolver::OrthogonalizeDCGS2(Vector &w, const Array<Vector*> &v,
+                                     int i, DenseMatrix &H) const
+{
+   // One reduction for c = [V, u]^T u and d = [V, u]^T w, where
+   // V = [v[0], ..., v[i-1]] and u = v[i].
+   Vector &u = *v[i];
+   Array<const Vector*> vu(i + 1);
+   for (int k = 0; k <= i; k++) { vu[k] = v[k]; }
+   Vector cd(2*i + 2);
+   real_t *c = cd.GetData(), *d = c + i + 1;
+   if (UseFusedDot())
+   {
+      mfem::MDot(u, i + 1, vu.GetData(), c);
+      mfem::MDot(w, i + 1, vu.GetData(), d);
+      StartGlobalSum(cd.GetData(), cd.Size());
+      FinishGlobalSum();
+   }
+   else
+   {
+      for (int k = 0; k <= i; k++)
+      {
+         c[k] = Dot(u, *vu[k]);
+         d[k] = Dot(w, *vu[k]);
+      }
+   }
+
+   // Lagged reorthogonalization and normalization of v[i], which completes
+   // the column i-1 of H.
+   const real_t nu = ReorthogonalizeDCGS2(v, i, c, H);
+
+   // Since u = V a + nu v[i] and M A V = V_{i+1} H, the vector M A v[i] is
+   // (w - V_{i+1} Ha)/nu with Ha = H(0:i,0:i-1) a. Its inner products with
+   // v[0], ..., v[i] follow from d, and the result is orthogonalized with
+   // them (first pass of CGS2, the second is delayed to the next iteration).
+   Vector Ha(i + 1);
+   Ha = 0.0;
+   for (int l = 0; l < i; l++)
+   {
+      for (int k = 0; k <= l + 1; k++) { Ha(k) += H(k,l)*c[l]; }
+   }
+   real_t ad = 0.0;
+   for (int k = 0; k < i; k++) { ad += c[k]*d[k]; }
+   Vector coef(i + 1);
+   for (int k = 0; k <= i; k++)
+   {
+      const real_t dk = (k < i) ? d[k] : (d[i] - ad)/nu;
+      H(k,i) = (dk - Ha(k))/nu;
+      coef(k) = -(Ha(k)/nu + H(k,i));
+   }
+   w *= 1.0/nu;
+   mfem::MAdd(w, i + 1, coef.GetData(), vu.GetData());
+}
+
 void GMRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("GMRESSolver::Mult");
    // Generalized Minimum Residual method following the algorithm
    // on p. 20 of the SIAM Templates book.
 
    int n = width;
 
    DenseMatrix H(m+1, m);
+   // With DCGS2, the Hessenberg matrix before the plane rotations.
+   DenseMatrix Ha(ortho == Orthogonalization::DCGS2 ? m+1 : 0, m);
    Vector s(m+1), cs(m+1), sn(m+1);
    Vector r(n), w(n);
    Array<Vector *> v;
 
    int i, j, k;
 
+   // Apply the plane rotations to the completed column i of H and return the
+   // norm of the residual.
+   auto RotateColumn = [&](int c)
+   {
+      for (int l = 0; l < c; l++)
+      {
+         ApplyPlaneRotation(H(l,c), H(l+1,c), cs(l), sn(l));
+      }
+      GeneratePlaneRotation(H(c,c), H(c+1,c), cs(c), sn(c));
+      ApplyPlaneRotation(H(c,c), H(c+1,c), cs(c), sn(c));
+      ApplyPlaneRotation(s(c), s(c+1), cs(c), sn(c));
+      return fabs(s(c+1));
+   };
+
    if (iterative_mode)
    {
       oper->Mult(x, r);
@@ -1058,6 +2009,7 @@ void GMRESSolver::Mult(const Vector &b, Vector &x) const
 
       for (i = 0; i < m && j <= max_iter; i++, j++)
       {
+         MFEM_PERF_SCOPE("GMRESSolver iteration");
          if (prec)
          {
             oper->Mult(*v[i], r);
@@ -1068,46 +2020,70 @@ void GMRESSolver::Mult(const Vector &b, Vector &x) const
             oper->Mult(*v[i], w);
          }
 
-         for (k = 0; k <= i; k++)
+         // The column of H completed in this iteration, and its iteration
+         int col = i, it = j;
+         if (ortho == Orthogonalization::DCGS2)
          {
-            H(k,i) = Dot(w, *v[k]);  // H(k,i) = w * v[k]
-            w.Add(-H(k,i), *v[k]);   // w -= H(k,i) * v[k]
+            // v[i] is only normalized, and the column i-1 completed, here: the
+            // convergence test lags one iteration.
+            OrthogonalizeDCGS2(w, v, i, Ha);
+            if (v[i+1] == NULL) { v[i+1] = new Vector(n); }
+            v[i+1]->Swap(w);
+            if (i == 0) { continue; }
+            col = i - 1;
+            it = j - 1;
+            MFEM_VERIFY(IsFinite(Ha(i,col)), "Norm(w) = " << Ha(i,col));
+            for (k = 0; k <= i; k++) { H(k,col) = Ha(k,col); }
          }
-
-         H(i+1,i) = Norm(w);           // H(i+1,i) = ||w||
-         MFEM_VERIFY(IsFinite(H(i+1,i)), "Norm(w) = " << H(i+1,i));
-         if (v[i+1] == NULL) { v[i+1] = new Vector(n); }
-         v[i+1]->Set(1.0/H(i+1,i), w); // v[i+1] = w / H(i+1,i)
-
-         for (k = 0; k < i; k++)
+         else
          {
-            ApplyPlaneRotation(H(k,i), H(k+1,i), cs(k), sn(k));
+            Orthogonalize(w, v, i, H.GetColumn(i)); // H(i+1,i) = ||w||
+            MFEM_VERIFY(IsFinite(H(i+1,i)), "Norm(w) = " << H(i+1,i));
+            if (v[i+1] == NULL) { v[i+1] = new Vector(n); }
+            v[i+1]->Set(1.0/H(i+1,i), w); // v[i+1] = w / H(i+1,i)
          }
 
-         GeneratePlaneRotation(H(i,i), H(i+1,i), cs(i), sn(i));
-         ApplyPlaneRotation(H(i,i), H(i+1,i), cs(i), sn(i));
-         ApplyPlaneRotation(s(i), s(i+1), cs(i), sn(i));
-
-         const real_t resid = fabs(s(i+1));
+         const real_t resid = RotateColumn(col);
          MFEM_VERIFY(IsFinite(resid), "resid = " << resid);
 
          if (resid <= final_norm)
          {
-            Update(x, i, H, s, v);
+            Update(x, col, H, s, v);
             final_norm = resid;
-            final_iter = j;
+            final_iter = it;
             converged = true;
             goto finish;
          }
 
          if (print_options.iterations)
          {
-            mfem::out << "   Pass : " << setw(2) << (j-1)/m+1
-                      << "   Iteration : " << setw(3) << j
+            mfem::out << "   Pass : " << setw(2) << (it-1)/m+1
+                      << "   Iteration : " << setw(3) << it
                       << "  ||B r|| = " << resid << '\n';
          }
 
-         Monitor(j, resid, r, x);
+         Monitor(it, resid, r, x);
+      }
+
+      if (ortho == Orthogonalization::DCGS2 && i > 0)
+      {
+         // Complete the last column with the norm of the last basis vector.
+         Array<const Vector*> vu(i + 1);
+         for (k = 0; k <= i; k++) { vu[k] = v[k]; }
+         Vector c(i + 1);
+         MDot(*v[i], i + 1, vu.GetData(), c.GetData());
+         ReorthogonalizeDCGS2(v, i, c.GetData(), Ha);
+         for (k = 0; k <= i; k++) { H(k,i-1) = Ha(k,i-1); }
+         const real_t resid = RotateColumn(i-1);
+         MFEM_VERIFY(IsFinite(resid), "resid = " << resid);
+         if (resid <= final_norm)
+         {
+            Update(x, i-1, H, s, v);
+            final_norm = resid;
+            final_iter = j-1;
+            converged = true;
+            goto finish;
+         }
       }
 
       if (print_options.iterations && j <= max_iter)
@@ -1168,6 +2144,7 @@ finish:
 
 void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("FGMRESSolver::Mult");
    DenseMatrix H(m+1,m);
    Vector s(m+1), cs(m+1), sn(m+1);
    Vector r(b.Size());
@@ -1227,7 +2204,7 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 
       for (i = 0; i < m && j <= max_iter; i++, j++)
       {
-
+         MFEM_PERF_SCOPE("FGMRESSolver iteration");
          if (z[i] == NULL) { z[i] = new Vector(b.Size()); }
          (*z[i]) = 0.0;
 
@@ -1241,13 +2218,14 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
          }
          oper->Mult(*z[i], r);
 
-         for (k = 0; k <= i; k++)
+         // Modified Gram-Schmidt, with the update of r with v[k-1] fused with
+         // the inner product with v[k]
+         H(0,i) = Dot(r, *v[0]);                            // H(0,i) = r * v[0]
+         for (k = 1; k <= i; k++)
          {
-            H(k,i) = Dot( r, *v[k]); // H(k,i) = r * v[k]
-            r.Add(-H(k,i), (*v[k])); // r -= H(k,i) * v[k]
+            H(k,i) = AddDot(-H(k-1,i), *v[k-1], r, *v[k]);  // H(k,i) = r * v[k]
          }
-
-         H(i+1,i)  = Norm(r);       // H(i+1,i) = ||r||
+         H(i+1,i) = sqrt(AddDot(-H(i,i), *v[i], r, r));    // H(i+1,i) = ||r||
          if (v[i+1] == NULL) { v[i+1] = new Vector(b.Size()); }
          (*v[i+1]) = 0.0;
          v[i+1] -> Add (1.0/H(i+1,i), r); // v[i+1] = r / H(i+1,i)
@@ -1380,6 +2358,7 @@ void BiCGSTABSolver::UpdateVectors()
 
 void BiCGSTABSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("BiCGSTABSolver::Mult");
    // BiConjugate Gradient Stabilized method following the algorithm
    // on p. 27 of the SIAM Templates book.
 
@@ -1616,6 +2595,7 @@ void MINRESSolver::SetOperator(const Operator &op)
 
 void MINRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("MINRESSolver::Mult");
    // Based on the MINRES algorithm on p. 86, Fig. 6.9 in
    // "Iterative Krylov Methods for Large Linear Systems",
    // by Henk A. van der Vorst, 2003.
@@ -2755,7 +3735,12 @@ BlockILU::BlockILU(int block_size_,
    : Solver(0),
      block_size(block_size_),
      k_fill(k_fill_),
-     reordering(reordering_)
+     reordering(reordering_),
+     level_scheduling(false),
+     reuse_symbolic(false),
+     pattern_height(-1),
+     pattern_nnz(-1),
+     pattern_hash(0)
 { }
 
 BlockILU::BlockILU(const Operator &op,
@@ -2790,8 +3775,41 @@ void BlockILU::SetOperator(const Operator &op)
    height = op.Height();
    width = op.Width();
    MFEM_VERIFY(A->Finalized(), "Matrix must be finalized.");
-   CreateBlockPattern(*A);
+
+   // FNV-1a hash of the sparsity pattern
+   const int nrows = A->Height();
+   const int *I = A->GetI(), *J = A->GetJ();
+   unsigned long long hash = 14695981039346656037ULL;
+   auto Hash = [&hash](int v)
+   {
+      hash = (hash ^ (unsigned long long)(unsigned int)v)*1099511628211ULL;
+   };
+   for (int i = 0; i <= nrows; i++) { Hash(I[i]); }
+   for (int k = 0; k < I[nrows]; k++) { Hash(J[k]); }
+
+   const bool new_pattern = !reuse_symbolic || nrows != pattern_height ||
+                            I[nrows] != pattern_nnz || hash != pattern_hash;
+   if (new_pattern)
+   {
+      CreateBlockPattern(*A);
+      pattern_height = nrows;
+      pattern_nnz = I[nrows];
+      pattern_hash = hash;
+   }
+   if (level_scheduling)
+   {
+      if (new_pattern || L_level_offsets.Size() == 0) { CreateLevels(); }
+   }
+   else
+   {
+      L_level_offsets.DeleteAll();
+      U_level_offsets.DeleteAll();
+      LB.Clear();
+      UB.Clear();
+   }
+   FillBlocks(*A);
    Factorize();
+   if (level_scheduling) { CopyLevelFactors(); }
 }
 
 void BlockILU::CreateBlockPattern(const SparseMatrix &A)
@@ -2806,6 +3824,7 @@ void BlockILU::CreateBlockPattern(const SparseMatrix &A)
    const int *I = A.GetI();
    const int *J = A.GetJ();
    const real_t *V = A.GetData();
+   const int bs2 = block_size*block_size;
    int nnz = 0;
    int nblockrows = nrows / block_size;
 
@@ -2896,9 +3915,8 @@ void BlockILU::CreateBlockPattern(const SparseMatrix &A)
    JB.SetSize(nnz);
    AB.SetSize(block_size, block_size, nnz);
    DB.SetSize(block_size, block_size, nblockrows);
-   AB = 0.0;
-   DB = 0.0;
    ipiv.SetSize(block_size*nblockrows);
+   A_to_AB.SetSize(I[nrows]);
    int counter = 0;
 
    for (int iblock = 0; iblock < nblockrows; ++iblock)
@@ -2921,13 +3939,7 @@ void BlockILU::CreateBlockPattern(const SparseMatrix &A)
                if (j >= jblock_perm*block_size && j < (jblock_perm + 1)*block_size)
                {
                   int bj = j - jblock_perm*block_size;
-                  real_t val = V[k];
-                  AB(bi, bj, counter) = val;
-                  // Extract the diagonal
-                  if (iblock == jblock)
-                  {
-                     DB(bi, bj, iblock) = val;
-                  }
+                  A_to_AB[k] = counter*bs2 + bi + bj*block_size;
                }
             }
          }
@@ -2937,10 +3949,128 @@ void BlockILU::CreateBlockPattern(const SparseMatrix &A)
    }
 }
 
+void BlockILU::FillBlocks(const SparseMatrix &A)
+{
+   const int nblockrows = Height()/block_size;
+   const int bs2 = block_size*block_size;
+   const real_t *V = A.GetData();
+   // With level scheduling, CopyLevelFactors() frees AB, DB and ipiv
+   if (AB.SizeK() != JB.Size())
+   {
+      AB.SetSize(block_size, block_size, JB.Size());
+   }
+   if (DB.SizeK() != nblockrows)
+   {
+      DB.SetSize(block_size, block_size, nblockrows);
+   }
+   ipiv.SetSize(block_size*nblockrows);
+   real_t *AB_data = AB.Data();
+   AB = 0.0;
+   for (int k = 0; k < A_to_AB.Size(); ++k)
+   {
+      AB_data[A_to_AB[k]] = V[k];
+   }
+   // Extract the diagonal
+   for (int i = 0; i < nblockrows; ++i)
+   {
+      std::copy(AB_data + ID[i]*bs2, AB_data + (ID[i] + 1)*bs2, DB.GetData(i));
+   }
+}
+
+namespace internal
+{
+
+// Minimal number of block rows of a level for the level scheduled BlockILU to
+// use the threads of the ThreadPool::Global() pool.
+static const int block_ilu_threads_min_size = 16;
+
+// Execute body(k) for k in [0,n), with the threads of the ThreadPool::Global()
+// pool if Backend::CPU_THREADS is enabled and n is large enough.
+template <typename lambda>
+static void BlockILUParallelFor(int n, lambda &&body)
+{
+   mfem::ThreadPool *pool =
+      mfem::ThreadPool::GlobalFor(n, block_ilu_threads_min_size);
+   if (pool) { pool->ParallelFor(n, body); }
+   else { for (int k = 0; k < n; k++) { body(k); } }
+}
+
+// Sort the n block rows by level, given the level of each row, such that the
+// rows of level l are rows[offsets[l]], ..., rows[offsets[l+1]-1], in
+// increasing order.
+static void SortByLevel(const Array<int> &level, int num_levels,
+                        Array<int> &offsets, Array<int> &rows)
+{
+   const int n = level.Size();
+   offsets.SetSize(num_levels + 1);
+   offsets = 0;
+   for (int i = 0; i < n; ++i) { offsets[level[i] + 1]++; }
+   offsets.PartialSum();
+   Array<int> pos(num_levels);
+   for (int l = 0; l < num_levels; ++l) { pos[l] = offsets[l]; }
+   rows.SetSize(n);
+   for (int i = 0; i < n; ++i) { rows[pos[level[i]]++] = i; }
+}
+
+} // namespace internal
+
+void BlockILU::CreateLevels()
+{
+   const int nblockrows = Height()/block_size;
+   Array<int> level(nblockrows);
+
+   // Forward sweep: row i depends on the rows of its L blocks
+   int num_levels = 0;
+   for (int i = 0; i < nblockrows; ++i)
+   {
+      int l = 0;
+      for (int k = IB[i]; k < ID[i]; ++k)
+      {
+         l = std::max(l, level[JB[k]] + 1);
+      }
+      level[i] = l;
+      num_levels = std::max(num_levels, l + 1);
+   }
+   internal::SortByLevel(level, num_levels, L_level_offsets, L_level_rows);
+
+   // Backward sweep: row i depends on the rows of its U blocks
+   num_levels = 0;
+   for (int i = nblockrows - 1; i >= 0; --i)
+   {
+      int l = 0;
+      for (int k = ID[i] + 1; k < IB[i + 1]; ++k)
+      {
+         l = std::max(l, level[JB[k]] + 1);
+      }
+      level[i] = l;
+      num_levels = std::max(num_levels, l + 1);
+   }
+   internal::SortByLevel(level, num_levels, U_level_offsets, U_level_rows);
+}
+
 void BlockILU::Factorize()
 {
    int nblockrows = Height()/block_size;
 
+   if (level_scheduling)
+   {
+      // The rows of a level of the forward sweep only depend on the rows of
+      // the previous levels, so they can be factorized in parallel
+      internal::BlockILUParallelFor(nblockrows, [&](int i)
+      {
+         LUFactors factorization(DB.GetData(i), &ipiv[i*block_size]);
+         factorization.Factor(block_size);
+      });
+      for (int l = 0; l < L_level_offsets.Size() - 1; ++l)
+      {
+         const int *rows = L_level_rows.GetData() + L_level_offsets[l];
+         internal::BlockILUParallelFor(
+            L_level_offsets[l+1] - L_level_offsets[l],
+            [&](int k) { FactorizeRow(rows[k]); });
+      }
+      return;
+   }
+
    // Precompute LU factorization of diagonal blocks
    for (int i=0; i<nblockrows; ++i)
    {
@@ -2948,62 +4078,182 @@ void BlockILU::Factorize()
       factorization.Factor(block_size);
    }
 
-   // Note: we use UseExternalData to extract submatrices from the tensor AB
-   // instead of the DenseTensor call operator, because the call operator does
-   // not allow for two simultaneous submatrix views into the same tensor
-   DenseMatrix A_ik, A_ij, A_kj;
    // Loop over block rows (starting with second block row)
    for (int i=1; i<nblockrows; ++i)
    {
-      // Find all nonzeros to the left of the diagonal in row i
-      for (int kk=IB[i]; kk<IB[i+1]; ++kk)
-      {
-         int k = JB[kk];
-         // Make sure we're still to the left of the diagonal
-         if (k == i) { break; }
-         if (k > i)
-         {
-            MFEM_ABORT("Matrix must be sorted with nonzero diagonal");
-         }
-         LUFactors A_kk_inv(DB.GetData(k), &ipiv[k*block_size]);
-         A_ik.UseExternalData(&AB(0,0,kk), block_size, block_size);
-         // A_ik = A_ik * A_kk^{-1}
-         A_kk_inv.RightSolve(block_size, block_size, A_ik.GetData());
-         // Modify everything to the right of k in row i
-         for (int jj=kk+1; jj<IB[i+1]; ++jj)
+      FactorizeRow(i);
+   }
+}
+
+void BlockILU::FactorizeRow(int i)
+{
+   // Note: we use UseExternalData to extract submatrices from the tensor AB
+   // instead of the DenseTensor call operator, because the call operator does
+   // not allow for two simultaneous submatrix views into the same tensor
+   DenseMatrix A_ik, A_ij, A_kj, D_i;
+   // Find all nonzeros to the left of the diagonal in row i
+   for (int kk=IB[i]; kk<IB[i+1]; ++kk)
+   {
+      int k = JB[kk];
+      // Make sure we're still to the left of the diagonal
+      if (k == i) { break; }
+      if (k > i)
+      {
+         MFEM_ABORT("Matrix must be sorted with nonzero diagonal");
+      }
+      LUFactors A_kk_inv(DB.GetData(k), &ipiv[k*block_size]);
+      A_ik.UseExternalData(&AB(0,0,kk), block_size, block_size);
+      // A_ik = A_ik * A_kk^{-1}
+      A_kk_inv.RightSolve(block_size, block_size, A_ik.GetData());
+      // Modify everything to the right of k in row i
+      for (int jj=kk+1; jj<IB[i+1]; ++jj)
+      {
+         int j = JB[jj];
+         if (j <= k) { continue; } // Superfluous because JB is sorted?
+         A_ij.UseExternalData(&AB(0,0,jj), block_size, block_size);
+         for (int ll=IB[k]; ll<IB[k+1]; ++ll)
          {
-            int j = JB[jj];
-            if (j <= k) { continue; } // Superfluous because JB is sorted?
-            A_ij.UseExternalData(&AB(0,0,jj), block_size, block_size);
-            for (int ll=IB[k]; ll<IB[k+1]; ++ll)
+            int l = JB[ll];
+            if (l == j)
             {
-               int l = JB[ll];
-               if (l == j)
+               A_kj.UseExternalData(&AB(0,0,ll), block_size, block_size);
+               // A_ij = A_ij - A_ik*A_kj;
+               AddMult_a(-1.0, A_ik, A_kj, A_ij);
+               // If we need to, update diagonal factorization
+               if (j == i)
                {
-                  A_kj.UseExternalData(&AB(0,0,ll), block_size, block_size);
-                  // A_ij = A_ij - A_ik*A_kj;
-                  AddMult_a(-1.0, A_ik, A_kj, A_ij);
-                  // If we need to, update diagonal factorization
-                  if (j == i)
-                  {
-                     DB(i) = A_ij;
-                     LUFactors factorization(DB.GetData(i), &ipiv[i*block_size]);
-                     factorization.Factor(block_size);
-                  }
-                  break;
+                  D_i.UseExternalData(DB.GetData(i), block_size, block_size);
+                  D_i = A_ij;
+                  LUFactors factorization(DB.GetData(i), &ipiv[i*block_size]);
+                  factorization.Factor(block_size);
                }
+               break;
             }
          }
       }
    }
 }
 
+void BlockILU::CopyLevelFactors()
+{
+   const int nblockrows = Height()/block_size;
+   const int bs2 = block_size*block_size;
+
+   LI.SetSize(nblockrows + 1);
+   UI.SetSize(nblockrows + 1);
+   LI[0] = UI[0] = 0;
+   for (int k = 0; k < nblockrows; ++k)
+   {
+      const int i = L_level_rows[k], j = U_level_rows[k];
+      LI[k+1] = LI[k] + ID[i] - IB[i];
+      UI[k+1] = UI[k] + IB[j+1] - ID[j];
+   }
+   LJ.SetSize(LI[nblockrows]);
+   UJ.SetSize(UI[nblockrows]);
+   LB.SetSize(block_size, block_size, LI[nblockrows]);
+   UB.SetSize(block_size, block_size, UI[nblockrows]);
+   Upiv.SetSize(block_size*nblockrows);
+
+   const real_t *AB_data = AB.Data();
+   real_t *LB_data = LB.Data(), *UB_data = UB.Data();
+   internal::BlockILUParallelFor(nblockrows, [&](int k)
+   {
+      // L blocks of the k'th row of the forward sweep
+      int i = L_level_rows[k];
+      for (int kk = IB[i]; kk < ID[i]; ++kk)
+      {
+         LJ[LI[k] + kk - IB[i]] = JB[kk];
+      }
+      std::copy(AB_data + IB[i]*bs2, AB_data + ID[i]*bs2,
+                LB_data + LI[k]*bs2);
+
+      // Factorized diagonal block and U blocks of the k'th row of the
+      // backward sweep
+      i = U_level_rows[k];
+      for (int kk = ID[i]; kk < IB[i+1]; ++kk)
+      {
+         UJ[UI[k] + kk - ID[i]] = JB[kk];
+      }
+      std::copy(DB.GetData(i), DB.GetData(i) + bs2, UB_data + UI[k]*bs2);
+      std::copy(AB_data + (ID[i] + 1)*bs2, AB_data + IB[i+1]*bs2,
+                UB_data + (UI[k] + 1)*bs2);
+      for (int ib = 0; ib < block_size; ++ib)
+      {
+         Upiv[k*block_size + ib] = ipiv[i*block_size + ib];
+      }
+   });
+
+   // The factors are only kept in level order
+   AB.Clear();
+   DB.Clear();
+   ipiv.DeleteAll();
+}
+
 void BlockILU::Mult(const Vector &b, Vector &x) const
 {
    MFEM_VERIFY(height > 0, "BlockILU(0) preconditioner is not constructed");
    int nblockrows = Height()/block_size;
    y.SetSize(Height());
 
+   if (level_scheduling)
+   {
+      const int bs = block_size, bs2 = block_size*block_size;
+      const real_t *b_data = b.HostRead();
+      real_t *x_data = x.HostWrite();
+      real_t *y_data = y.HostWrite();
+      // Forward substitute to solve Ly = b, one level at a time
+      for (int l = 0; l < L_level_offsets.Size() - 1; ++l)
+      {
+         const int offset = L_level_offsets[l];
+         internal::BlockILUParallelFor(
+            L_level_offsets[l+1] - offset, [&](int kk)
+         {
+            const int k = offset + kk, i = L_level_rows[k];
+            Vector yi(y_data + i*bs, bs), yj;
+            DenseMatrix L_ij;
+            for (int ib = 0; ib < bs; ++ib)
+            {
+               yi[ib] = b_data[ib + P[i]*bs];
+            }
+            for (int m = LI[k]; m < LI[k+1]; ++m)
+            {
+               L_ij.UseExternalData(LB.Data() + m*bs2, bs, bs);
+               yj.SetDataAndSize(y_data + LJ[m]*bs, bs);
+               // y_i = y_i - L_ij*y_j
+               L_ij.AddMult_a(-1.0, yj, yi);
+            }
+         });
+      }
+      // Backward substitution to solve Ux = y, one level at a time. The
+      // solution of block row i overwrites y_i before it is copied to x.
+      for (int l = 0; l < U_level_offsets.Size() - 1; ++l)
+      {
+         const int offset = U_level_offsets[l];
+         internal::BlockILUParallelFor(
+            U_level_offsets[l+1] - offset, [&](int kk)
+         {
+            const int k = offset + kk, i = U_level_rows[k];
+            Vector yi(y_data + i*bs, bs), yj;
+            DenseMatrix U_ij;
+            for (int m = UI[k] + 1; m < UI[k+1]; ++m)
+            {
+               U_ij.UseExternalData(UB.Data() + m*bs2, bs, bs);
+               yj.SetDataAndSize(y_data + UJ[m]*bs, bs);
+               // y_i = y_i - U_ij*y_j
+               U_ij.AddMult_a(-1.0, yj, yi);
+            }
+            LUFactors A_ii_inv(UB.Data() + UI[k]*bs2, &Upiv[k*bs]);
+            // y_i = D_ii^{-1} y_i
+            A_ii_inv.Solve(bs, 1, yi.GetData());
+            for (int ib = 0; ib < bs; ++ib)
+            {
+               x_data[ib + P[i]*bs] = yi[ib];
+            }
+         });
+      }
+      return;
+   }
+
    DenseMatrix B;
    Vector yi, yj, xi, xj;
    Vector tmp(block_size);
@@ -14,6 +14,7 @@
 
 #include "../config/config.hpp"
 #include "densemat.hpp"
+#include "multivector.hpp"
 #include "handle.hpp"
 #include <memory>
 
@@ -115,6 +116,7 @@ public:
 private:
    int dot_prod_type; // 0 - local, 1 - global over 'comm'
    MPI_Comm comm = MPI_COMM_NULL;
+   mutable MPI_Request sum_request = MPI_REQUEST_NULL;
 #endif
 
 protected:
@@ -167,18 +169,58 @@ protected:
    mutable bool converged = false;
    mutable real_t initial_norm = -1.0, final_norm = -1.0;
 
+   /// Whether AddDot() and MDot() use the fused kernels, see SetFusedDot().
+   bool fused_dot = false;
+
    ///@}
 
    /** @brief Return the standard (l2, i.e., Euclidean) inner product of
        @a x and @a y
        @details Overriding this method in a derived class enables a
-       custom inner product.
+       custom inner product. The fused variants AddDot(), AddAddDot() and
+       MDot() call Dot() unless SetFusedDot() is enabled.
       */
    virtual real_t Dot(const Vector &x, const Vector &y) const;
 
    /// Return the inner product norm of @a x, using the inner product defined by Dot()
    real_t Norm(const Vector &x) const { return sqrt(Dot(x, x)); }
 
+   /** @brief Set @a y = @a y + @a a @a x and return the inner product of the
+       updated @a y with @a z, in one pass over the data, see
+       mfem::AddDot(). */
+   /** Without SetFusedDot(), the update is followed by a call to Dot(). */
+   virtual real_t AddDot(real_t a, const Vector &x, Vector &y,
+                         const Vector &z) const;
+
+   /** @brief Set @a y = @a y + @a a @a x and @a v = @a v + @a b @a u, and
+       return the inner product of the updated @a v with @a w, in one pass
+       over the data, see mfem::AddAddDot(). */
+   /** Without SetFusedDot(), the updates are followed by a call to Dot(). */
+   virtual real_t AddAddDot(real_t a, const Vector &x, Vector &y,
+                            real_t b, const Vector &u, Vector &v,
+                            const Vector &w) const;
+
+   /** @brief Compute the inner products @a dots[k] = (@a x, @a v[k]),
+       k = 0, ..., @a n - 1, with mfem::MDot() and one global reduction. */
+   /** Without SetFusedDot(), Dot() is called for each k instead. */
+   virtual void MDot(const Vector &x, int n, const Vector *const *v,
+                     real_t *dots) const;
+
+   /// Return true if AddDot(), AddAddDot() and MDot() use the fused kernels.
+   bool UseFusedDot() const { return fused_dot; }
+
+   /** @brief Start the sum over all processors of the @a n values in @a data,
+       e.g. local inner products computed with Vector::operator*(). */
+   /** With MPI-3, the reduction is non-blocking: the work done before the
+       matching call to FinishGlobalSum() overlaps with the communication.
+       Combining several inner products in one call also reduces the number of
+       global synchronizations. Without a communicator, this does nothing.
+       These functions use the Euclidean inner product, unlike Dot(). */
+   void StartGlobalSum(real_t *data, int n) const;
+
+   /// Wait for the completion of the sum started by StartGlobalSum().
+   void FinishGlobalSum() const;
+
    /// Monitor both the residual @a r and the solution @a x
    void Monitor(int it, real_t norm, const Vector& r, const Vector& x,
                 bool final=false) const;
@@ -211,6 +253,13 @@ public:
    void SetMaxIter(int max_it) { max_iter = max_it; }
    ///@}
 
+   /** @brief Enable the fused vector kernels, which compute the updates and
+       the inner products of the solver in fewer passes over the data. */
+   /** The fused kernels compute the standard (l2) inner product of
+       IterativeSolver::Dot(), so they must not be enabled in a class that
+       overrides Dot(). Disabled by default. */
+   void SetFusedDot(bool use = true) { fused_dot = use; }
+
    /** @name Reporting
        These options control the internal reporting behavior into ::mfem::out
        and ::mfem::err of the iterative solvers.
@@ -507,6 +556,48 @@ void SLI(const Operator &A, Solver &B, const Vector &b, Vector &x,
          int print_iter = 0, int max_num_iter = 1000,
          real_t RTOLERANCE = 1e-12, real_t ATOLERANCE = 1e-24);
 
+/// Mixed precision iterative refinement: x <- x + S (b - A x)
+/** The residual b - A x is computed with the operator A of SetOperator() in
+    the precision of real_t, and the correction is computed by an inner solver
+    S, set with SetInnerSolver(), which is typically a Krylov or a Multigrid
+    solver with a loose tolerance for an operator with single precision data,
+    e.g. a BilinearForm with DiffusionIntegrator::SetSinglePrecisionPA() or a
+    SinglePrecisionSparseMatrix. Since the inner solver only has to reduce the
+    error by a moderate factor in each outer iteration, the accuracy of x is
+    the one of real_t, while most of the work is done with the cheaper single
+    precision operator.
+
+    The residual is scaled to unit norm before the inner solve, so that the
+    values seen by the inner solver stay in the range of single precision. The
+    iteration stops when the norm of the residual, with the inner product of
+    Dot(), is below the relative and absolute tolerances. */
+class MixedPrecisionSolver : public IterativeSolver
+{
+protected:
+   Solver *inner = nullptr;
+   mutable Vector r, e;
+
+   void UpdateVectors();
+
+public:
+   MixedPrecisionSolver() { }
+
+#ifdef MFEM_USE_MPI
+   MixedPrecisionSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /// Set the operator used for the residual, in the precision of real_t.
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Set the inner solver computing the corrections. Its operator is
+       set by the caller, and its iterative_mode is set to false. */
+   void SetInnerSolver(Solver &s) { inner = &s; s.iterative_mode = false; }
+
+   /// Iterative solution of the linear system with iterative refinement.
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
 
 /// Conjugate gradient method
 class CGSolver : public IterativeSolver
@@ -531,6 +622,124 @@ public:
    void Mult(const Vector &b, Vector &x) const override;
 };
 
+/// Pipelined conjugate gradient method
+/** Variant of CGSolver due to Ghysels and Vanroose, where the two inner
+    products of an iteration are combined into one global reduction, which
+    overlaps with the application of the preconditioner and of the operator.
+    The price is three additional vector updates per iteration and one
+    additional preconditioner and operator application per solve.
+
+    In exact arithmetic, the iterates are the same as with CGSolver, and the
+    same convergence criterion is used. In finite precision, the recurrences
+    may limit the attainable accuracy to a slightly larger residual. The
+    Euclidean inner product is used: overriding Dot() has no effect. */
+class PipelinedCGSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, u, w, m, n, p, q, s, z;
+
+   void UpdateVectors();
+
+public:
+   PipelinedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   PipelinedCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the pipelined
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+/// s-step conjugate gradient method
+/** Variant of CGSolver due to Chronopoulos and Gear, which performs s
+    iterations with a single global reduction. Each step builds the basis
+    [z, BA z, ..., (BA)^{s-1} z], where z = B r, makes it A-orthogonal to the
+    search directions of the previous step, and minimizes the A-norm of the
+    error over the resulting directions. In exact arithmetic, the iterate after
+    each step is the CGSolver iterate after s iterations.
+
+    The global reduction of each step overlaps with the application of B and
+    A that starts the next basis: like the residual r, the vectors z = B r and
+    A z are then updated with recurrences, which requires storing BA P and
+    ABA P for the search directions P.
+
+    The convergence criterion of CGSolver is checked once per step, so the
+    number of iterations is a multiple of s, except for the last step if
+    the maximum number of iterations is reached. The basis is scaled with an
+    estimate of the spectral radius of BA, but its conditioning still degrades
+    quickly with s: values between 2 and 5 are recommended. Numerically
+    dependent basis vectors are dropped. The Euclidean inner product is used:
+    overriding Dot() has no effect. */
+class SStepCGSolver : public IterativeSolver
+{
+protected:
+   int s = 4; // see SetNumSteps()
+   mutable Vector r, z, Az, P, AP, BAP, ABAP, R, AR, BAR, ABAR;
+
+   void UpdateVectors();
+
+public:
+   SStepCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   SStepCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /// Set the number of iterations per global reduction, default is 4.
+   void SetNumSteps(int steps);
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the s-step
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+/// Block conjugate gradient method for several right-hand sides
+/** Variant of CGSolver due to O'Leary, which solves A X = B for all the
+    columns of B at once, see ArrayMult(). Each iteration minimizes the A-norm
+    of the errors over the span of the search directions of all columns, so
+    that the number of iterations decreases with the number of right-hand
+    sides. The operator and the preconditioner are applied to all columns with
+    a single call to their ArrayMult() method (see e.g. SparseMatrix and
+    BilinearForm), and the inner products of an iteration are computed with
+    one pass over the vectors and one global reduction.
+
+    The iteration stops when the convergence criterion of CGSolver holds for
+    every column. Numerically dependent search directions, e.g. for identical
+    right-hand sides, are dropped. The Euclidean inner product is used:
+    overriding Dot() has no effect, and the monitor is not called. */
+class BlockCGSolver : public IterativeSolver
+{
+protected:
+   mutable MultiVector R, Z, P, Q;
+
+   void UpdateVectors(int nvec) const;
+
+public:
+   BlockCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   BlockCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /// Solve the linear system with a single right-hand side.
+   void Mult(const Vector &b, Vector &x) const override;
+
+   /** @brief Iterative solution of the linear systems A X[j] = B[j] with the
+       block Conjugate Gradient method. */
+   /** With iterative_mode, the initial guesses are the input values of X. The
+       reported norms are the maximum over the columns. */
+   void ArrayMult(const Array<const Vector *> &B,
+                  Array<Vector *> &X) const override;
+};
+
 /// Conjugate gradient method. (tolerances are squared)
 void CG(const Operator &A, const Vector &b, Vector &x,
         int print_iter = 0, int max_num_iter = 1000,
@@ -545,8 +754,56 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
 /// GMRES method
 class GMRESSolver : public IterativeSolver
 {
+public:
+   /// Orthogonalization of the Krylov basis, see SetOrthogonalization().
+   enum class Orthogonalization
+   {
+      /// Modified Gram-Schmidt: i+2 global reductions at the i-th iteration.
+      MGS,
+      /** Classical Gram-Schmidt: one global reduction per iteration, with the
+          norm of the new basis vector obtained from the Pythagorean theorem
+          (and recomputed, with a second reduction, after a large
+          cancellation).
+          Less stable than MGS: the orthogonality of the basis degrades with
+          the condition number of the (preconditioned) operator. */
+      CGS,
+      /** Classical Gram-Schmidt with one full reorthogonalization pass:
+          two global reductions per iteration (three if the norm has to be
+          recomputed after a large cancellation), with the stability of MGS. */
+      CGS2,
+      /** CGS2 with the reorthogonalization and the normalization of each
+          basis vector delayed to the next iteration (DCGS2), where they share
+          the global reduction of the next inner products: one reduction per
+          iteration, plus one per restart, with the stability of CGS2. The
+          operator is applied to the basis vector before its normalization,
+          and the convergence test lags one iteration behind. */
+      DCGS2
+   };
+
 protected:
    int m; // see SetKDim()
+   Orthogonalization ortho = Orthogonalization::MGS;
+
+   /** @brief Orthogonalize @a w against the basis vectors v[0], ..., v[i] and
+       return the coefficients and the norm of the result in @a h[0], ...,
+       h[i+1]. */
+   void Orthogonalize(Vector &w, const Array<Vector*> &v, int i,
+                      real_t *h) const;
+
+   /** @brief Orthogonalization::DCGS2 step of the i-th iteration: given
+       @a w = M A v[i], computed before the reorthogonalization and the
+       normalization of v[i], complete v[i] and the column i-1 of the
+       Hessenberg matrix @a H, then orthogonalize @a w once against v[0], ...,
+       v[i] and store the coefficients in the column i of @a H. */
+   void OrthogonalizeDCGS2(Vector &w, const Array<Vector*> &v, int i,
+                           DenseMatrix &H) const;
+
+   /** @brief Reorthogonalize and normalize v[i] against v[0], ..., v[i-1],
+       given their inner products @a c with v[i] and (v[i], v[i]) in c[i], and
+       complete the column i-1 of @a H. Returns the norm of v[i] after the
+       reorthogonalization. */
+   real_t ReorthogonalizeDCGS2(const Array<Vector*> &v, int i,
+                               const real_t *c, DenseMatrix &H) const;
 
 public:
    GMRESSolver() { m = 50; }
@@ -558,6 +815,14 @@ public:
    /// Set the number of iteration to perform between restarts, default is 50.
    void SetKDim(int dim) { m = dim; }
 
+   /** @brief Set the orthogonalization of the Krylov basis, default is
+       Orthogonalization::MGS. */
+   /** With Orthogonalization::CGS, CGS2 and DCGS2, the number of global
+       reductions per iteration does not grow with the size of the basis when
+       the fused kernels are enabled with SetFusedDot(). Otherwise, Dot() is
+       called once per basis vector. */
+   void SetOrthogonalization(Orthogonalization o) { ortho = o; }
+
    /// Iterative solution of the linear system using the GMRES method
    void Mult(const Vector &b, Vector &x) const override;
 };
@@ -984,6 +1249,11 @@ public:
  *  Currently greedy minimum discarded fill ordering and no reordering are
  *  supported. Renumbering the blocks can lead to a much better approximate
  *  factorization.
+ *
+ *  With SetLevelScheduling(), the factorization and the block triangular
+ *  solves are level scheduled and use the threads of Backend::CPU_THREADS.
+ *  With SetReuseSymbolic(), repeated calls to SetOperator() with the same
+ *  sparsity pattern only recompute the numerical factorization.
  */
 class BlockILU : public Solver
 {
@@ -1021,6 +1291,43 @@ public:
    /// Solve the system `LUx = b`, where `L` and `U` are the block ILU factors.
    void Mult(const Vector &b, Vector &x) const;
 
+   /** Enable or disable the level scheduling of the factorization and of the
+    *  block triangular solves in Mult(). Disabled by default.
+    *
+    *  The block rows are grouped into levels, such that the rows of one level
+    *  only depend on rows of the previous levels in the forward (L) or the
+    *  backward (U) sweep. The rows of each level are processed in parallel by
+    *  the threads of ThreadPool::Global() when Backend::CPU_THREADS is
+    *  enabled. After the factorization, the factors are moved into separate
+    *  L and U block arrays, ordered by level, so that each sweep streams
+    *  through its blocks, and the block CSR arrays of the factors are freed.
+    *  The result is the same as without level scheduling. Takes effect at the
+    *  next call to SetOperator().
+    */
+   void SetLevelScheduling(bool level_scheduling_ = true)
+   { level_scheduling = level_scheduling_; }
+
+   /** Enable or disable the reuse of the symbolic setup when SetOperator() is
+    *  called with a matrix that has the same sparsity pattern as the previous
+    *  one. Disabled by default.
+    *
+    *  The block pattern, the reordering and the levels are then kept and only
+    *  the numerical factorization is recomputed. Note that the
+    *  MINIMUM_DISCARDED_FILL reordering depends on the matrix entries; with
+    *  this option it is computed from the first matrix only.
+    */
+   void SetReuseSymbolic(bool reuse_symbolic_ = true)
+   { reuse_symbolic = reuse_symbolic_; }
+
+   /** Get the number of levels of the forward and backward sweeps. Only
+    *  available when level scheduling is enabled. Mostly used for testing.
+    */
+   void GetNumLevels(int &forward_levels, int &backward_levels) const
+   {
+      forward_levels = L_level_offsets.Size() - 1;
+      backward_levels = U_level_offsets.Size() - 1;
+   }
+
    /** Get the I array for the block CSR representation of the factorization.
     *  Similar to SparseMatrix::GetI(). Mostly used for testing.
     */
@@ -1032,7 +1339,9 @@ public:
    int *GetBlockJ() { return JB.GetData(); }
 
    /** Get the data array for the block CSR representation of the factorization.
-    *  Similar to SparseMatrix::GetData(). Mostly used for testing.
+    *  Similar to SparseMatrix::GetData(). Mostly used for testing. Returns
+    *  NULL with level scheduling, where the factors are only stored in level
+    *  order.
     */
    real_t *GetBlockData() { return AB.Data(); }
 
@@ -1040,9 +1349,23 @@ private:
    /// Set up the block CSR structure corresponding to a sparse matrix @a A
    void CreateBlockPattern(const class SparseMatrix &A);
 
+   /// Copy the entries of @a A into the block CSR structure
+   void FillBlocks(const class SparseMatrix &A);
+
+   /// Compute the levels of the forward and backward block triangular solves
+   void CreateLevels();
+
    /// Perform the block ILU factorization
    void Factorize();
 
+   /// Perform the block ILU factorization of the block row @a i
+   void FactorizeRow(int i);
+
+   /** Copy the factors into the level ordered arrays used by Mult(), and free
+    *  #AB, #DB and #ipiv.
+    */
+   void CopyLevelFactors();
+
    int block_size;
 
    /// Fill level for block ILU(k) factorizations. Only k=0 is supported.
@@ -1068,6 +1391,30 @@ private:
    mutable DenseTensor DB;
    /// Pivot arrays for the LU factorizations given by #DB
    mutable Array<int> ipiv;
+
+   bool level_scheduling, reuse_symbolic;
+
+   /** Index into AB.Data() of each nonzero of the matrix, used to refill the
+    *  blocks when the symbolic setup is reused.
+    */
+   Array<int> A_to_AB;
+   /// Size, number of nonzeros and hash of the sparsity pattern of the matrix.
+   int pattern_height, pattern_nnz;
+   unsigned long long pattern_hash;
+
+   /** Block rows sorted by level for the forward and backward sweeps, the rows
+    *  of level l are in [offsets[l], offsets[l+1]).
+    */
+   Array<int> L_level_offsets, L_level_rows, U_level_offsets, U_level_rows;
+
+   /** Level ordered factors, with level scheduling. The k'th row of the forward sweep
+    *  has the blocks LB(LI[k]), ..., LB(LI[k+1]-1) in the block columns LJ.
+    *  The k'th row of the backward sweep has the LU factorization of its
+    *  diagonal block in UB(UI[k]), with pivots Upiv, followed by the U blocks.
+    */
+   Array<int> LI, LJ, UI, UJ;
+   mutable Array<int> Upiv;
+   mutable DenseTensor LB, UB;
 };
 
 
@@ -23,6 +23,10 @@
 #include <algorithm>
 #include <limits>
 #include <cstring>
+#include <climits>
+#include <cstdint>
+#include <atomic>
+#include <vector>
 
 #if defined(MFEM_USE_CUDA)
 #define MFEM_cu_or_hip(stub) cu##stub
@@ -333,6 +337,7 @@ void SparseMatrix::SetEmpty()
    ColPtrJ = NULL;
    ColPtrNode = NULL;
    At = NULL;
+   Af = nullptr;
 #ifdef MFEM_USE_MEMALLOC
    NodesMem = NULL;
 #endif
@@ -786,6 +791,12 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
       return;
    }
 
+   if (Af)
+   {
+      Af->AddMult(x, y, a);
+      return;
+   }
+
 #ifndef MFEM_USE_LEGACY_OPENMP
    const int height = this->height;
    const int nnz = J.Capacity();
@@ -951,6 +962,92 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
 #endif // MFEM_USE_LEGACY_OPENMP
 }
 
+namespace internal
+{
+
+// Pointers to the device data of the vectors of one ArrayAddMult() batch.
+struct SpMVBatchData
+{
+   const real_t *x[MDOT_MAX_VECTORS];
+   real_t *y[MDOT_MAX_VECTORS];
+};
+
+template <int NK>
+static void SpMVBatchKernel(int height, const int *d_I, const int *d_J,
+                            const real_t *d_A, const SpMVBatchData &data,
+                            real_t a)
+{
+   const SpMVBatchData d = data;
+   mfem::forall(height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t s[NK];
+      for (int k = 0; k < NK; k++) { s[k] = 0.0; }
+      const int end = d_I[i+1];
+      for (int j = d_I[i]; j < end; j++)
+      {
+         const real_t a_ij = d_A[j];
+         const int col = d_J[j];
+         for (int k = 0; k < NK; k++) { s[k] += a_ij * d.x[k][col]; }
+      }
+      for (int k = 0; k < NK; k++) { d.y[k][i] += a * s[k]; }
+   });
+}
+
+} // namespace internal
+
+void SparseMatrix::ArrayMult(const Array<const Vector *> &X,
+                             Array<Vector *> &Y) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(), "Number of columns mismatch!");
+   for (int k = 0; k < Y.Size(); k++)
+   {
+      if (Finalized()) { Y[k]->UseDevice(true); }
+      *Y[k] = 0.0;
+   }
+   ArrayAddMult(X, Y);
+}
+
+void SparseMatrix::ArrayAddMult(const Array<const Vector *> &X,
+                                Array<Vector *> &Y, const real_t a) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(), "Number of columns mismatch!");
+   // The vendor SpMV is applied to one vector at a time.
+   if (!Finalized() || X.Size() == 1 ||
+       (Device::Allows(Backend::CUDA_MASK | Backend::HIP_MASK) && useGPUSparse))
+   {
+      Operator::ArrayAddMult(X, Y, a);
+      return;
+   }
+   const int nnz = J.Capacity();
+   if (nnz == 0) { return; }
+   auto d_I = Read(I, height+1);
+   auto d_J = Read(J, nnz);
+   auto d_A = Read(A, nnz);
+   for (int k0 = 0; k0 < X.Size(); k0 += MDOT_MAX_VECTORS)
+   {
+      const int nk = std::min(X.Size() - k0, MDOT_MAX_VECTORS);
+      internal::SpMVBatchData d;
+      for (int k = 0; k < nk; k++)
+      {
+         MFEM_ASSERT(X[k0+k]->Size() == width && Y[k0+k]->Size() == height,
+                     "incompatible Vector sizes");
+         d.x[k] = X[k0+k]->Read();
+         d.y[k] = Y[k0+k]->ReadWrite();
+      }
+      switch (nk)
+      {
+         case 1: internal::SpMVBatchKernel<1>(height, d_I, d_J, d_A, d, a); break;
+         case 2: internal::SpMVBatchKernel<2>(height, d_I, d_J, d_A, d, a); break;
+         case 3: internal::SpMVBatchKernel<3>(height, d_I, d_J, d_A, d, a); break;
+         case 4: internal::SpMVBatchKernel<4>(height, d_I, d_J, d_A, d, a); break;
+         case 5: internal::SpMVBatchKernel<5>(height, d_I, d_J, d_A, d, a); break;
+         case 6: internal::SpMVBatchKernel<6>(height, d_I, d_J, d_A, d, a); break;
+         case 7: internal::SpMVBatchKernel<7>(height, d_I, d_J, d_A, d, a); break;
+         case 8: internal::SpMVBatchKernel<8>(height, d_I, d_J, d_A, d, a); break;
+      }
+   }
+}
+
 void SparseMatrix::MultTranspose(const Vector &x, Vector &y) const
 {
    if (Finalized()) { y.UseDevice(true); }
@@ -983,6 +1080,12 @@ void SparseMatrix::AddMultTranspose(const Vector &x, Vector &y,
       return;
    }
 
+   if (Af && !At)
+   {
+      Af->AddMultTranspose(x, y, a);
+      return;
+   }
+
    EnsureMultTranspose();
    if (At)
    {
@@ -1033,6 +1136,26 @@ void SparseMatrix::EnsureMultTranspose() const
    }
 }
 
+void SparseMatrix::BuildSELL(int C, int sigma) const
+{
+   MFEM_VERIFY(Finalized(), "the matrix must be finalized");
+   delete Af;
+   Af = new SELLMatrix(*this, C, sigma);
+}
+
+void SparseMatrix::BuildBCSR(int vdim, bool byvdim) const
+{
+   MFEM_VERIFY(Finalized(), "the matrix must be finalized");
+   delete Af;
+   Af = new BCSRMatrix(*this, vdim, byvdim);
+}
+
+void SparseMatrix::ResetSpMVFormat() const
+{
+   delete Af;
+   Af = nullptr;
+}
+
 void SparseMatrix::PartMult(
    const Array<int> &rows, const Vector &x, Vector &y) const
 {
@@ -3626,6 +3749,7 @@ void SparseMatrix::Destroy()
    delete NodesMem;
 #endif
    delete At;
+   delete Af;
 
    ClearGPUSparse();
 }
@@ -3800,55 +3924,69 @@ SparseMatrix *TransposeAbstractSparseMatrix (const AbstractSparseMatrix &A,
 }
 
 
-SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
-                    SparseMatrix *OAB)
+namespace internal
 {
-   int nrowsA, ncolsA, nrowsB, ncolsB;
-   const int *A_i, *A_j, *B_i, *B_j;
-   int *C_i, *C_j, *B_marker;
-   const real_t *A_data, *B_data;
-   real_t *C_data;
-   int ia, ib, ic, ja, jb, num_nonzeros;
-   int row_start, counter;
-   real_t a_entry, b_entry;
-   SparseMatrix *C;
-
-   nrowsA = A.Height();
-   ncolsA = A.Width();
-   nrowsB = B.Height();
-   ncolsB = B.Width();
-
-   MFEM_VERIFY(ncolsA == nrowsB,
-               "number of columns of A (" << ncolsA
-               << ") must equal number of rows of B (" << nrowsB << ")");
 
-   A_i    = A.HostReadI();
-   A_j    = A.HostReadJ();
-   A_data = A.HostReadData();
-   B_i    = B.HostReadI();
-   B_j    = B.HostReadJ();
-   B_data = B.HostReadData();
+// Minimal number of entries of the first factor for the products and sums of
+// sparse matrices to use the threads of the ThreadPool::Global() pool.
+static const int sparse_threads_min_size = 1 << 14;
 
-   B_marker = new int[ncolsB];
+// Execute body(begin, end) on one contiguous block of rows of [0,n) for each
+// thread of @a pool, or on [0,n) if @a pool is NULL.
+template <typename BODY>
+static void SparseRowBlocks(mfem::ThreadPool *pool, int n, BODY &&body)
+{
+   if (pool == NULL) { body(0, n); return; }
+   const int nb = pool->NumThreads();
+   pool->ParallelFor(nb, [&](int b)
+   {
+      body(int((std::int64_t(n)*b)/nb), int((std::int64_t(n)*(b+1))/nb));
+   });
+}
 
-   for (ib = 0; ib < ncolsB; ib++)
+// Replace the row sizes C_i[1],...,C_i[n] by the row offsets C_i[0],...,C_i[n].
+static void SparseRowOffsets(int *C_i, int n)
+{
+   std::int64_t nnz = 0;
+   C_i[0] = 0;
+   for (int i = 0; i < n; i++)
    {
-      B_marker[ib] = -1;
+      nnz += C_i[i+1];
+      MFEM_VERIFY(nnz <= INT_MAX, "the number of nonzeros exceeds the range of"
+                  " int");
+      C_i[i+1] = int(nnz);
    }
+}
 
-   if (OAB == NULL)
-   {
-      C_i = Memory<int>(nrowsA+1);
+// Symbolic phase of A.B. The blocks of rows are processed independently, each
+// with its own marker array, and the columns of each row of the result are
+// in the order of their first appearance, as in the sequential algorithm.
+static SparseMatrix *MultSymbolic(mfem::ThreadPool *pool, const SparseMatrix &A,
+                                  const SparseMatrix &B)
+{
+   const int nrowsA = A.Height();
+   const int ncolsB = B.Width();
+   MFEM_VERIFY(A.Finalized() && B.Finalized(), "the matrices must be finalized");
+   MFEM_VERIFY(A.Width() == B.Height(),
+               "number of columns of A (" << A.Width()
+               << ") must equal number of rows of B (" << B.Height() << ")");
+
+   const int *A_i = A.HostReadI(), *A_j = A.HostReadJ();
+   const int *B_i = B.HostReadI(), *B_j = B.HostReadJ();
+   int *C_i = Memory<int>(nrowsA+1);
 
-      C_i[0] = num_nonzeros = 0;
-      for (ic = 0; ic < nrowsA; ic++)
+   SparseRowBlocks(pool, nrowsA, [&](int begin, int end)
+   {
+      std::vector<int> B_marker(ncolsB, -1);
+      for (int ic = begin; ic < end; ic++)
       {
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         int num_nonzeros = 0;
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
          {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+            const int ja = A_j[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
             {
-               jb = B_j[ib];
+               const int jb = B_j[ib];
                if (B_marker[jb] != ic)
                {
                   B_marker[jb] = ic;
@@ -3858,73 +3996,129 @@ SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
          }
          C_i[ic+1] = num_nonzeros;
       }
+   });
+   SparseRowOffsets(C_i, nrowsA);
 
-      C_j    = Memory<int>(num_nonzeros);
-      C_data = Memory<real_t>(num_nonzeros);
-
-      C = new SparseMatrix(C_i, C_j, C_data, nrowsA, ncolsB);
-
-      for (ib = 0; ib < ncolsB; ib++)
-      {
-         B_marker[ib] = -1;
-      }
-   }
-   else
-   {
-      C = OAB;
-
-      MFEM_VERIFY(nrowsA == C->Height() && ncolsB == C->Width(),
-                  "Input matrix sizes do not match output sizes"
-                  << " nrowsA = " << nrowsA
-                  << ", C->Height() = " << C->Height()
-                  << " ncolsB = " << ncolsB
-                  << ", C->Width() = " << C->Width());
-
-      // C_i    = C->HostReadI(); // not used
-      C_j    = C->HostWriteJ();
-      C_data = C->HostWriteData();
-   }
-
-   counter = 0;
-   for (ic = 0; ic < nrowsA; ic++)
+   int *C_j = Memory<int>(C_i[nrowsA]);
+   real_t *C_data = Memory<real_t>(C_i[nrowsA]);
+   SparseRowBlocks(pool, nrowsA, [&](int begin, int end)
    {
-      // row_start = C_i[ic];
-      row_start = counter;
-      for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+      std::vector<int> B_marker(ncolsB, -1);
+      for (int ic = begin; ic < end; ic++)
       {
-         ja = A_j[ia];
-         a_entry = A_data[ia];
-         for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+         int counter = C_i[ic];
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
          {
-            jb = B_j[ib];
-            b_entry = B_data[ib];
-            if (B_marker[jb] < row_start)
+            const int ja = A_j[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
             {
-               B_marker[jb] = counter;
-               if (OAB == NULL)
+               const int jb = B_j[ib];
+               if (B_marker[jb] != ic)
                {
-                  C_j[counter] = jb;
+                  B_marker[jb] = ic;
+                  C_j[counter++] = jb;
                }
-               C_data[counter] = a_entry*b_entry;
-               counter++;
             }
-            else
+         }
+      }
+   });
+
+   return new SparseMatrix(C_i, C_j, C_data, nrowsA, ncolsB);
+}
+
+// Numeric phase of A.B. In each row of C, the position of each column in C_j
+// is recorded in a marker array, so that the products are accumulated directly
+// in C_data. The positions of the previous rows are smaller than C_i[ic], which
+// detects the columns of A.B that are not in the sparsity of C.
+static void MultNumeric(mfem::ThreadPool *pool, const SparseMatrix &A,
+                        const SparseMatrix &B, SparseMatrix &C)
+{
+   const int nrowsA = A.Height();
+   const int ncolsB = B.Width();
+   MFEM_VERIFY(A.Width() == B.Height(),
+               "number of columns of A (" << A.Width()
+               << ") must equal number of rows of B (" << B.Height() << ")");
+   MFEM_VERIFY(nrowsA == C.Height() && ncolsB == C.Width(),
+               "Input matrix sizes do not match output sizes"
+               << " nrowsA = " << nrowsA
+               << ", C.Height() = " << C.Height()
+               << " ncolsB = " << ncolsB
+               << ", C.Width() = " << C.Width());
+
+   const int *A_i = A.HostReadI(), *A_j = A.HostReadJ();
+   const real_t *A_data = A.HostReadData();
+   const int *B_i = B.HostReadI(), *B_j = B.HostReadJ();
+   const real_t *B_data = B.HostReadData();
+   const int *C_i = C.HostReadI(), *C_j = C.HostReadJ();
+   real_t *C_data = C.HostWriteData();
+
+   std::atomic<bool> missing(false);
+   SparseRowBlocks(pool, nrowsA, [&](int begin, int end)
+   {
+      std::vector<int> C_pos(ncolsB, -1);
+      bool block_missing = false;
+      for (int ic = begin; ic < end; ic++)
+      {
+         const int row_start = C_i[ic];
+         for (int k = row_start; k < C_i[ic+1]; k++)
+         {
+            C_pos[C_j[k]] = k;
+            C_data[k] = 0.0;
+         }
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         {
+            const int ja = A_j[ia];
+            const real_t a_entry = A_data[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
             {
-               C_data[B_marker[jb]] += a_entry*b_entry;
+               const int k = C_pos[B_j[ib]];
+               if (k < row_start) { block_missing = true; continue; }
+               C_data[k] += a_entry*B_data[ib];
             }
          }
       }
-   }
+      if (block_missing) { missing = true; }
+   });
+   MFEM_VERIFY(!missing, "the sparsity of the output matrix does not contain"
+               " the one of the product");
+}
 
-   MFEM_VERIFY(
-      OAB == NULL || counter == OAB->NumNonZeroElems(),
-      "With pre-allocated output matrix, number of non-zeros ("
-      << OAB->NumNonZeroElems()
-      << ") did not match number of entries changed from matrix-matrix multiply, "
-      << counter);
+static mfem::ThreadPool *SparseThreadPool(const SparseMatrix &A)
+{
+   return mfem::ThreadPool::GlobalFor(A.NumNonZeroElems(), sparse_threads_min_size);
+}
 
-   delete [] B_marker;
+} // namespace internal
+
+SparseMatrix *MultSymbolic(const SparseMatrix &A, const SparseMatrix &B)
+{
+   return internal::MultSymbolic(internal::SparseThreadPool(A), A, B);
+}
+
+SparseMatrix *MultSymbolic(const SparseMatrix &A, const SparseMatrix &B,
+                           ThreadPool &pool)
+{
+   return internal::MultSymbolic(&pool, A, B);
+}
+
+void MultNumeric(const SparseMatrix &A, const SparseMatrix &B,
+                 SparseMatrix &C)
+{
+   internal::MultNumeric(internal::SparseThreadPool(A), A, B, C);
+}
+
+void MultNumeric(const SparseMatrix &A, const SparseMatrix &B, SparseMatrix &C,
+                 ThreadPool &pool)
+{
+   internal::MultNumeric(&pool, A, B, C);
+}
 
+SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
+                    SparseMatrix *OAB)
+{
+   ThreadPool *pool = internal::SparseThreadPool(A);
+   SparseMatrix *C = OAB ? OAB : internal::MultSymbolic(pool, A, B);
+   internal::MultNumeric(pool, A, B, *C);
    return C;
 }
 
@@ -4091,6 +4285,27 @@ SparseMatrix *RAP(const SparseMatrix &Rt, const SparseMatrix &A,
    return RAP_;
 }
 
+SparseRAP::SparseRAP(const SparseMatrix &R, const SparseMatrix &A,
+                     const SparseMatrix &P)
+   : AP(MultSymbolic(A, P)), RAP_(MultSymbolic(R, *AP))
+{
+   Mult(R, A, P);
+}
+
+SparseMatrix &SparseRAP::Mult(const SparseMatrix &R, const SparseMatrix &A,
+                              const SparseMatrix &P)
+{
+   MultNumeric(A, P, *AP);
+   MultNumeric(R, *AP, *RAP_);
+   return *RAP_;
+}
+
+SparseRAP::~SparseRAP()
+{
+   delete RAP_;
+   delete AP;
+}
+
 SparseMatrix *Mult_AtDA (const SparseMatrix &A, const Vector &D,
                          SparseMatrix *OAtDA)
 {
@@ -4128,68 +4343,69 @@ SparseMatrix * Add(real_t a, const SparseMatrix & A, real_t b,
    const int *B_j = B.GetJ();
    const real_t *B_data = B.GetData();
 
-   int * marker = new int[ncols];
-   std::fill(marker, marker+ncols, -1);
-
-   int num_nonzeros = 0, jcol;
-   C_i[0] = 0;
-   for (int ic = 0; ic < nrows; ic++)
+   // The blocks of rows are processed independently, each with its own marker
+   // array, see internal::MultSymbolic().
+   ThreadPool *pool = internal::SparseThreadPool(A);
+   internal::SparseRowBlocks(pool, nrows, [&](int begin, int end)
    {
-      for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+      std::vector<int> marker(ncols, -1);
+      for (int ic = begin; ic < end; ic++)
       {
-         jcol = A_j[ia];
-         marker[jcol] = ic;
-         num_nonzeros++;
-      }
-      for (int ib = B_i[ic]; ib < B_i[ic+1]; ib++)
-      {
-         jcol = B_j[ib];
-         if (marker[jcol] != ic)
+         int num_nonzeros = 0;
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
          {
-            marker[jcol] = ic;
+            marker[A_j[ia]] = ic;
             num_nonzeros++;
          }
+         for (int ib = B_i[ic]; ib < B_i[ic+1]; ib++)
+         {
+            const int jcol = B_j[ib];
+            if (marker[jcol] != ic)
+            {
+               marker[jcol] = ic;
+               num_nonzeros++;
+            }
+         }
+         C_i[ic+1] = num_nonzeros;
       }
-      C_i[ic+1] = num_nonzeros;
-   }
-
-   C_j = Memory<int>(num_nonzeros);
-   C_data = Memory<real_t>(num_nonzeros);
+   });
+   internal::SparseRowOffsets(C_i, nrows);
 
-   for (int ia = 0; ia < ncols; ia++)
-   {
-      marker[ia] = -1;
-   }
+   C_j = Memory<int>(C_i[nrows]);
+   C_data = Memory<real_t>(C_i[nrows]);
 
-   int pos = 0;
-   for (int ic = 0; ic < nrows; ic++)
+   internal::SparseRowBlocks(pool, nrows, [&](int begin, int end)
    {
-      for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
-      {
-         jcol = A_j[ia];
-         C_j[pos] = jcol;
-         C_data[pos] = a*A_data[ia];
-         marker[jcol] = pos;
-         pos++;
-      }
-      for (int ib = B_i[ic]; ib < B_i[ic+1]; ib++)
+      std::vector<int> marker(ncols, -1);
+      for (int ic = begin; ic < end; ic++)
       {
-         jcol = B_j[ib];
-         if (marker[jcol] < C_i[ic])
+         int pos = C_i[ic];
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
          {
+            const int jcol = A_j[ia];
             C_j[pos] = jcol;
-            C_data[pos] = b*B_data[ib];
+            C_data[pos] = a*A_data[ia];
             marker[jcol] = pos;
             pos++;
          }
-         else
+         for (int ib = B_i[ic]; ib < B_i[ic+1]; ib++)
          {
-            C_data[marker[jcol]] += b*B_data[ib];
+            const int jcol = B_j[ib];
+            if (marker[jcol] < C_i[ic])
+            {
+               C_j[pos] = jcol;
+               C_data[pos] = b*B_data[ib];
+               marker[jcol] = pos;
+               pos++;
+            }
+            else
+            {
+               C_data[marker[jcol]] += b*B_data[ib];
+            }
          }
       }
-   }
+   });
 
-   delete[] marker;
    return new SparseMatrix(C_i, C_j, C_data, nrows, ncols);
 }
 
@@ -4355,6 +4571,7 @@ void SparseMatrix::Swap(SparseMatrix &other)
    mfem::Swap(ColPtrJ, other.ColPtrJ);
    mfem::Swap(ColPtrNode, other.ColPtrNode);
    mfem::Swap(At, other.At);
+   mfem::Swap(Af, other.Af);
 
 #ifdef MFEM_USE_MEMALLOC
    mfem::Swap(NodesMem, other.NodesMem);
@@ -79,6 +79,10 @@ protected:
    /// Transpose of A. Owned. Used to perform MultTranspose() on devices.
    mutable SparseMatrix *At;
 
+   /** @brief Copy of A in the SELL-C-sigma or the block CSR format. Owned. Used
+       by the matrix-vector products, see BuildSELL() and BuildBCSR(). */
+   mutable Operator *Af = nullptr;
+
 #ifdef MFEM_USE_MEMALLOC
    typedef MemAlloc <RowNode, 1024> RowNodeAlloc;
    RowNodeAlloc * NodesMem;
@@ -352,6 +356,15 @@ public:
    void AddMult(const Vector &x, Vector &y,
                 const real_t a = 1.0) const override;
 
+   /** @brief Matrix multiplication of several vectors: Y[j] = A * X[j]. The
+       matrix is read once for up to MDOT_MAX_VECTORS vectors. */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
+   /// Y[j] += A * X[j] (default)  or  Y[j] += a * A * X[j]
+   void ArrayAddMult(const Array<const Vector *> &X, Array<Vector *> &Y,
+                     const real_t a = 1.0) const override;
+
    /// Multiply a vector with the transposed matrix. y = At * x
    /** If the matrix is modified, call ResetTranspose() and optionally
        EnsureMultTranspose() to make sure this method uses the correct updated
@@ -405,6 +418,35 @@ public:
        when the internal transpose matrix is not required. */
    void EnsureMultTranspose() const;
 
+   /** @brief Build and store internally a copy of this matrix in the sliced
+       ELLPACK format SELL-C-sigma, see SELLMatrix, which will be used in the
+       methods Mult(), AddMult(), MultTranspose() and AddMultTranspose(). */
+   /** The format computes the products with @a C rows at once in SIMD lanes,
+       which is faster than the CSR format for matrices with short rows. The
+       CSR arrays are kept and used by all other methods.
+
+       Warning: any changes in this matrix will invalidate the internal copy.
+       To rebuild the copy, call ResetSpMVFormat() followed by a call to this
+       method. If the internal transpose is built, see BuildTranspose(), it is
+       used by MultTranspose() and AddMultTranspose() instead of the copy.
+
+       This method can only be used when the sparse matrix is finalized. */
+   void BuildSELL(int C = 8, int sigma = 64) const;
+
+   /** @brief Build and store internally a copy of this matrix in the block CSR
+       format with blocks of size @a vdim, see BCSRMatrix, which will be used
+       in the methods Mult(), AddMult(), MultTranspose() and
+       AddMultTranspose(). */
+   /** This is meant for the matrices of vector-valued FiniteElementSpace%s,
+       with @a vdim = FiniteElementSpace::GetVDim() and @a byvdim = true for
+       the ordering Ordering::byVDIM. See BuildSELL() for the validity of the
+       internal copy. */
+   void BuildBCSR(int vdim, bool byvdim = true) const;
+
+   /** Reset (destroy) the internal copy built by BuildSELL() or BuildBCSR(),
+       so that the matrix-vector products use the CSR format. */
+   void ResetSpMVFormat() const;
+
    void PartMult(const Array<int> &rows, const Vector &x, Vector &y) const;
    void PartAddMult(const Array<int> &rows, const Vector &x, Vector &y,
                     const real_t a=1.0) const;
@@ -743,14 +785,36 @@ SparseMatrix *TransposeAbstractSparseMatrix (const AbstractSparseMatrix &A,
                                              int useActualWidth);
 
 /// Matrix product A.B.
-/** If @a OAB is not NULL, we assume it has the structure of A.B and store the
-    result in @a OAB. If @a OAB is NULL, we create a new SparseMatrix to store
+/** If @a OAB is not NULL, we assume its sparsity contains the one of A.B and
+    store the result in @a OAB, skipping the symbolic phase, see
+    MultNumeric(). If @a OAB is NULL, we create a new SparseMatrix to store
     the result and return a pointer to it.
 
-    All matrices must be finalized. */
+    All matrices must be finalized. When Backend::CPU_THREADS is enabled, the
+    threads of ThreadPool::Global() are used, with the same result as the
+    sequential version. */
 SparseMatrix *Mult(const SparseMatrix &A, const SparseMatrix &B,
                    SparseMatrix *OAB = NULL);
 
+/** @brief Symbolic phase of the matrix product A.B: return a new SparseMatrix
+    with the sparsity of A.B and uninitialized entries. */
+/** The columns of each row are in the order of their first appearance in the
+    product. The entries can be computed with MultNumeric(). */
+SparseMatrix *MultSymbolic(const SparseMatrix &A, const SparseMatrix &B);
+/// Symbolic phase of the matrix product A.B using the threads of @a pool.
+SparseMatrix *MultSymbolic(const SparseMatrix &A, const SparseMatrix &B,
+                           ThreadPool &pool);
+
+/** @brief Numeric phase of the matrix product A.B: compute the entries of
+    @a C = A.B, where the sparsity of @a C contains the one of A.B, e.g.
+    computed by MultSymbolic(). */
+/** The entries of @a C outside of the sparsity of A.B are set to zero. */
+void MultNumeric(const SparseMatrix &A, const SparseMatrix &B,
+                 SparseMatrix &C);
+/// Numeric phase of the matrix product A.B using the threads of @a pool.
+void MultNumeric(const SparseMatrix &A, const SparseMatrix &B, SparseMatrix &C,
+                 ThreadPool &pool);
+
 /// C = A^T B
 SparseMatrix *TransposeMult(const SparseMatrix &A, const SparseMatrix &B);
 
@@ -776,12 +840,47 @@ SparseMatrix *RAP(const SparseMatrix &A, const SparseMatrix &R,
 SparseMatrix *RAP(const SparseMatrix &Rt, const SparseMatrix &A,
                   const SparseMatrix &P);
 
+/** @brief Triple product R.A.P of finalized sparse matrices with fixed sparsity
+    patterns, for repeated products with changing entries. */
+/** The constructor computes the sparsity of A.P and R.A.P once, see
+    MultSymbolic(). The method Mult() then only performs the numeric phase of
+    the two products, e.g. for the Galerkin products P^T A P in Newton
+    iterations or time stepping on a fixed mesh. */
+class SparseRAP
+{
+protected:
+   SparseMatrix *AP, *RAP_;
+
+public:
+   /// Compute the sparsity and the entries of R.A.P.
+   SparseRAP(const SparseMatrix &R, const SparseMatrix &A,
+             const SparseMatrix &P);
+
+   /// The intermediate and final products are owned, so copying is disabled.
+   SparseRAP(const SparseRAP &) = delete;
+   SparseRAP &operator=(const SparseRAP &) = delete;
+
+   /** @brief Compute the entries of R.A.P and return the product, owned by
+       this object. */
+   /** The sparsity patterns of @a R, @a A and @a P must be contained in those
+       given to the constructor. */
+   SparseMatrix &Mult(const SparseMatrix &R, const SparseMatrix &A,
+                      const SparseMatrix &P);
+
+   /// Return the last computed product R.A.P, owned by this object.
+   SparseMatrix &GetProduct() { return *RAP_; }
+
+   ~SparseRAP();
+};
+
 /// Matrix multiplication A^t D A. All matrices must be finalized.
 SparseMatrix *Mult_AtDA(const SparseMatrix &A, const Vector &D,
                         SparseMatrix *OAtDA = NULL);
 
 
 /// Matrix addition result = A + B.
+/** When Backend::CPU_THREADS is enabled, the threads of ThreadPool::Global()
+    are used, as in Mult(). */
 SparseMatrix * Add(const SparseMatrix & A, const SparseMatrix & B);
 /// Matrix addition result = a*A + b*B
 SparseMatrix * Add(real_t a, const SparseMatrix & A, real_t b,
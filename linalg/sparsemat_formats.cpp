@@ -0,0 +1,485 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "sparsemat_formats.hpp"
+#include "sparsemat.hpp"
+#include "../general/forall.hpp"
+
+#include <algorithm>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// y += a A x with the slices of C = T_C rows computed in T_C lanes, for the CPU
+// backends.
+template <int T_C>
+void SELLAddMultSlices(const int nslices, const int *rows, const int *ptr,
+                       const int *cols, const real_t *vals, const real_t *x,
+                       real_t *y, const real_t a)
+{
+   mfem::forall(nslices, [=] MFEM_HOST_DEVICE (int s)
+   {
+      real_t sum[T_C];
+      for (int r = 0; r < T_C; r++) { sum[r] = 0.0; }
+      const int end = ptr[s+1];
+      for (int k = ptr[s]; k < end; k += T_C)
+      {
+         for (int r = 0; r < T_C; r++) { sum[r] += vals[k+r]*x[cols[k+r]]; }
+      }
+      for (int r = 0; r < T_C; r++)
+      {
+         const int row = rows[s*T_C + r];
+         if (row >= 0) { y[row] += a*sum[r]; }
+      }
+   });
+}
+
+// y += a A x with one thread per row, for the GPU backends and the slice
+// heights without a specialized kernel.
+void SELLAddMultRows(const int nslices, const int C, const int *rows,
+                     const int *row_len, const int *ptr, const int *cols,
+                     const real_t *vals, const real_t *x, real_t *y,
+                     const real_t a)
+{
+   mfem::forall(nslices*C, [=] MFEM_HOST_DEVICE (int t)
+   {
+      const int row = rows[t];
+      if (row < 0) { return; }
+      const int begin = ptr[t/C] + t%C;
+      const int end = begin + row_len[t]*C;
+      real_t sum = 0.0;
+      for (int k = begin; k < end; k += C) { sum += vals[k]*x[cols[k]]; }
+      y[row] += a*sum;
+   });
+}
+
+// y += a A x for blocks of size b = T_B. The indices of the component c of the
+// node i are i*rn + c*rc for the rows and i*cn + c*cc for the columns.
+template <int T_B = 0>
+void BCSRAddMult(const int b_, const int nbr, const int rn, const int rc,
+                 const int cn, const int cc, const int *bI, const int *bJ,
+                 const real_t *bA, const real_t *x, real_t *y, const real_t a)
+{
+   const int b = T_B ? T_B : b_;
+   constexpr int MAX_B = T_B ? T_B : 8;
+   mfem::forall(nbr, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t sum[MAX_B], xb[MAX_B];
+      for (int c = 0; c < b; c++) { sum[c] = 0.0; }
+      const int end = bI[i+1];
+      for (int k = bI[i]; k < end; k++)
+      {
+         const int j = bJ[k];
+         const real_t *Ak = bA + k*b*b;
+         for (int d = 0; d < b; d++) { xb[d] = x[j*cn + d*cc]; }
+         for (int c = 0; c < b; c++)
+         {
+            for (int d = 0; d < b; d++) { sum[c] += Ak[c*b + d]*xb[d]; }
+         }
+      }
+      for (int c = 0; c < b; c++) { y[i*rn + c*rc] += a*sum[c]; }
+   });
+}
+
+// y += a A^T x for blocks of size b = T_B, see BCSRAddMult().
+template <int T_B = 0>
+void BCSRAddMultTranspose(const int b_, const int nbr, const int rn,
+                          const int rc, const int cn, const int cc,
+                          const int *bI, const int *bJ, const real_t *bA,
+                          const real_t *x, real_t *y, const real_t a)
+{
+   const int b = T_B ? T_B : b_;
+   constexpr int MAX_B = T_B ? T_B : 8;
+   const bool atomic = Device::Allows(~Backend::CPU_MASK);
+   mfem::forall(nbr, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t xb[MAX_B];
+      for (int c = 0; c < b; c++) { xb[c] = a*x[i*rn + c*rc]; }
+      const int end = bI[i+1];
+      for (int k = bI[i]; k < end; k++)
+      {
+         const int j = bJ[k];
+         const real_t *Ak = bA + k*b*b;
+         for (int d = 0; d < b; d++)
+         {
+            real_t sum = 0.0;
+            for (int c = 0; c < b; c++) { sum += Ak[c*b + d]*xb[c]; }
+            if (atomic) { AtomicAdd(y[j*cn + d*cc], sum); }
+            else { y[j*cn + d*cc] += sum; }
+         }
+      }
+   });
+}
+
+} // namespace internal
+
+SELLMatrix::SELLMatrix(const SparseMatrix &A, int C_, int sigma_)
+   : Operator(A.Height(), A.Width()), C(C_), sigma(sigma_)
+{
+   MFEM_VERIFY(A.Finalized(), "the matrix must be finalized");
+   MFEM_VERIFY(C > 0 && sigma > 0,
+               "invalid parameters: C = " << C << ", sigma = " << sigma);
+   const int *Ai = A.HostReadI(), *Aj = A.HostReadJ();
+   const real_t *Ad = A.HostReadData();
+   nslices = (height + C - 1)/C;
+   const int npos = nslices*C;
+
+   // Sort the rows by decreasing length in each window of sigma rows.
+   Array<int> perm(height);
+   for (int i = 0; i < height; i++) { perm[i] = i; }
+   for (int w = 0; w < height; w += sigma)
+   {
+      std::stable_sort(perm.GetData() + w,
+                       perm.GetData() + std::min(w + sigma, height),
+                       [=](int r1, int r2)
+      {
+         return Ai[r1+1] - Ai[r1] > Ai[r2+1] - Ai[r2];
+      });
+   }
+
+   rows.SetSize(npos);
+   row_len.SetSize(npos);
+   slice_ptr.SetSize(nslices + 1);
+   slice_ptr[0] = 0;
+   for (int s = 0; s < nslices; s++)
+   {
+      int max_len = 0;
+      for (int t = s*C; t < (s+1)*C; t++)
+      {
+         rows[t] = (t < height) ? perm[t] : -1;
+         row_len[t] = (t < height) ? Ai[rows[t]+1] - Ai[rows[t]] : 0;
+         max_len = std::max(max_len, row_len[t]);
+      }
+      slice_ptr[s+1] = slice_ptr[s] + max_len*C;
+   }
+
+   const int nnz = slice_ptr[nslices];
+   cols.SetSize(nnz);
+   vals.SetSize(nnz);
+   vals.UseDevice(true);
+   cols = 0;
+   vals = 0.0;
+   for (int s = 0; s < nslices; s++)
+   {
+      for (int r = 0; r < C; r++)
+      {
+         const int t = s*C + r;
+         if (rows[t] < 0) { continue; }
+         const int offset = Ai[rows[t]];
+         for (int k = 0; k < row_len[t]; k++)
+         {
+            cols[slice_ptr[s] + k*C + r] = Aj[offset + k];
+            vals[slice_ptr[s] + k*C + r] = Ad[offset + k];
+         }
+      }
+   }
+}
+
+void SELLMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void SELLMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
+{
+   MFEM_ASSERT(width == x.Size() && height == y.Size(),
+               "incompatible Vector sizes");
+   const int *d_rows = rows.Read(), *d_len = row_len.Read();
+   const int *d_ptr = slice_ptr.Read(), *d_cols = cols.Read();
+   const real_t *d_vals = vals.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+
+   const bool lanes = !Device::Allows(Backend::DEVICE_MASK);
+   switch (lanes ? C : 0)
+   {
+      case 4:
+         internal::SELLAddMultSlices<4>(nslices, d_rows, d_ptr, d_cols, d_vals,
+                                        d_x, d_y, a);
+         break;
+      case 8:
+         internal::SELLAddMultSlices<8>(nslices, d_rows, d_ptr, d_cols, d_vals,
+                                        d_x, d_y, a);
+         break;
+      case 16:
+         internal::SELLAddMultSlices<16>(nslices, d_rows, d_ptr, d_cols,
+                                         d_vals, d_x, d_y, a);
+         break;
+      default:
+         internal::SELLAddMultRows(nslices, C, d_rows, d_len, d_ptr, d_cols,
+                                   d_vals, d_x, d_y, a);
+   }
+}
+
+void SELLMatrix::MultTranspose(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void SELLMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                  const real_t a) const
+{
+   MFEM_ASSERT(height == x.Size() && width == y.Size(),
+               "incompatible Vector sizes");
+   const int C = this->C;
+   const int *d_rows = rows.Read(), *d_len = row_len.Read();
+   const int *d_ptr = slice_ptr.Read(), *d_cols = cols.Read();
+   const real_t *d_vals = vals.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+   const bool atomic = Device::Allows(~Backend::CPU_MASK);
+   if (!atomic)
+   {
+      // Serial CPU backends: traverse the slices in the storage order. The
+      // padding adds zeros to the entry 0 of y.
+      for (int s = 0; s < nslices; s++)
+      {
+         const int *rs = d_rows + s*C;
+         for (int k = d_ptr[s]; k < d_ptr[s+1]; k += C)
+         {
+            for (int r = 0; r < C; r++)
+            {
+               if (rs[r] >= 0) { d_y[d_cols[k+r]] += a*d_vals[k+r]*d_x[rs[r]]; }
+            }
+         }
+      }
+      return;
+   }
+   mfem::forall(nslices*C, [=] MFEM_HOST_DEVICE (int t)
+   {
+      const int row = d_rows[t];
+      if (row < 0) { return; }
+      const real_t ax = a*d_x[row];
+      const int begin = d_ptr[t/C] + t%C;
+      const int end = begin + d_len[t]*C;
+      for (int k = begin; k < end; k += C)
+      {
+         if (atomic) { AtomicAdd(d_y[d_cols[k]], d_vals[k]*ax); }
+         else { d_y[d_cols[k]] += d_vals[k]*ax; }
+      }
+   });
+}
+
+BCSRMatrix::BCSRMatrix(const SparseMatrix &A, int b_, bool byvdim_)
+   : Operator(A.Height(), A.Width()), b(b_), byvdim(byvdim_)
+{
+   MFEM_VERIFY(A.Finalized(), "the matrix must be finalized");
+   MFEM_VERIFY(b >= 1 && b <= 8, "invalid block size: " << b);
+   MFEM_VERIFY(height % b == 0 && width % b == 0,
+               "the size of the matrix is not a multiple of the block size");
+   const int *Ai = A.HostReadI(), *Aj = A.HostReadJ();
+   const real_t *Ad = A.HostReadData();
+   const int nbr = height/b, nbc = width/b;
+   const int b2 = b*b;
+   auto Row = [=](int i, int c) { return byvdim ? i*b + c : c*nbr + i; };
+   auto Node = [=](int j) { return byvdim ? j/b : j%nbc; };
+   auto Comp = [=](int j) { return byvdim ? j%b : j/nbc; };
+
+   // pos[j] is the position of the block of the node j in the current block
+   // row, if it is at least bI[i].
+   Array<int> pos(nbc);
+   pos = -1;
+   bI.SetSize(nbr + 1);
+   bI[0] = 0;
+   for (int i = 0; i < nbr; i++)
+   {
+      int nb = bI[i];
+      for (int c = 0; c < b; c++)
+      {
+         const int row = Row(i, c);
+         for (int k = Ai[row]; k < Ai[row+1]; k++)
+         {
+            const int j = Node(Aj[k]);
+            if (pos[j] < bI[i]) { pos[j] = nb++; }
+         }
+      }
+      bI[i+1] = nb;
+   }
+
+   bJ.SetSize(bI[nbr]);
+   bA.SetSize(bI[nbr]*b2);
+   bA.UseDevice(true);
+   bA = 0.0;
+   pos = -1;
+   for (int i = 0; i < nbr; i++)
+   {
+      int nb = bI[i];
+      for (int c = 0; c < b; c++)
+      {
+         const int row = Row(i, c);
+         for (int k = Ai[row]; k < Ai[row+1]; k++)
+         {
+            const int j = Node(Aj[k]);
+            if (pos[j] < bI[i])
+            {
+               pos[j] = nb++;
+               bJ[pos[j]] = j;
+            }
+            bA[pos[j]*b2 + c*b + Comp(Aj[k])] += Ad[k];
+         }
+      }
+   }
+}
+
+void BCSRMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void BCSRMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
+{
+   MFEM_ASSERT(width == x.Size() && height == y.Size(),
+               "incompatible Vector sizes");
+   const int nbr = height/b, nbc = width/b;
+   const int rn = byvdim ? b : 1, rc = byvdim ? 1 : nbr;
+   const int cn = byvdim ? b : 1, cc = byvdim ? 1 : nbc;
+   const int *d_I = bI.Read(), *d_J = bJ.Read();
+   const real_t *d_A = bA.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+   switch (b)
+   {
+      case 2:
+         internal::BCSRAddMult<2>(b, nbr, rn, rc, cn, cc, d_I, d_J, d_A, d_x,
+                                  d_y, a);
+         break;
+      case 3:
+         internal::BCSRAddMult<3>(b, nbr, rn, rc, cn, cc, d_I, d_J, d_A, d_x,
+                                  d_y, a);
+         break;
+      default:
+         internal::BCSRAddMult(b, nbr, rn, rc, cn, cc, d_I, d_J, d_A, d_x,
+                               d_y, a);
+   }
+}
+
+void BCSRMatrix::MultTranspose(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void BCSRMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                  const real_t a) const
+{
+   MFEM_ASSERT(height == x.Size() && width == y.Size(),
+               "incompatible Vector sizes");
+   const int nbr = height/b, nbc = width/b;
+   const int rn = byvdim ? b : 1, rc = byvdim ? 1 : nbr;
+   const int cn = byvdim ? b : 1, cc = byvdim ? 1 : nbc;
+   const int *d_I = bI.Read(), *d_J = bJ.Read();
+   const real_t *d_A = bA.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+   switch (b)
+   {
+      case 2:
+         internal::BCSRAddMultTranspose<2>(b, nbr, rn, rc, cn, cc, d_I, d_J,
+                                           d_A, d_x, d_y, a);
+         break;
+      case 3:
+         internal::BCSRAddMultTranspose<3>(b, nbr, rn, rc, cn, cc, d_I, d_J,
+                                           d_A, d_x, d_y, a);
+         break;
+      default:
+         internal::BCSRAddMultTranspose(b, nbr, rn, rc, cn, cc, d_I, d_J,
+                                        d_A, d_x, d_y, a);
+   }
+}
+
+SinglePrecisionSparseMatrix::SinglePrecisionSparseMatrix(
+   const SparseMatrix &A_)
+   : Operator(A_.Height(), A_.Width())
+{
+   MFEM_VERIFY(A_.Finalized(), "the matrix must be finalized");
+   const int nnz = A_.NumNonZeroElems();
+   I.SetSize(height + 1);
+   J.SetSize(nnz);
+   A.SetSize(nnz);
+   const int *Ai = A_.ReadI(), *Aj = A_.ReadJ();
+   const real_t *Ad = A_.ReadData();
+   int *d_I = I.Write(), *d_J = J.Write();
+   float *d_A = A.Write();
+   mfem::forall(height + 1, [=] MFEM_HOST_DEVICE (int i) { d_I[i] = Ai[i]; });
+   mfem::forall(nnz, [=] MFEM_HOST_DEVICE (int k)
+   {
+      d_J[k] = Aj[k];
+      d_A[k] = (float)Ad[k];
+   });
+}
+
+void SinglePrecisionSparseMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void SinglePrecisionSparseMatrix::AddMult(const Vector &x, Vector &y,
+                                          const real_t a) const
+{
+   MFEM_ASSERT(width == x.Size() && height == y.Size(),
+               "incompatible Vector sizes");
+   const int *d_I = I.Read(), *d_J = J.Read();
+   const float *d_A = A.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+   mfem::forall(height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t sum = 0.0;
+      for (int k = d_I[i]; k < d_I[i+1]; k++)
+      {
+         sum += d_A[k]*d_x[d_J[k]];
+      }
+      d_y[i] += a*sum;
+   });
+}
+
+void SinglePrecisionSparseMatrix::MultTranspose(const Vector &x,
+                                                Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void SinglePrecisionSparseMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                                   const real_t a) const
+{
+   MFEM_ASSERT(height == x.Size() && width == y.Size(),
+               "incompatible Vector sizes");
+   const int *d_I = I.Read(), *d_J = J.Read();
+   const float *d_A = A.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+   const bool atomic = Device::Allows(~Backend::CPU_MASK);
+   mfem::forall_switch(atomic, height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const real_t ax = a*d_x[i];
+      for (int k = d_I[i]; k < d_I[i+1]; k++)
+      {
+         if (atomic) { AtomicAdd(d_y[d_J[k]], d_A[k]*ax); }
+         else { d_y[d_J[k]] += d_A[k]*ax; }
+      }
+   });
+}
+
+}
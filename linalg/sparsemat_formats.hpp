@@ -0,0 +1,160 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_SPARSEMAT_FORMATS
+#define MFEM_SPARSEMAT_FORMATS
+
+#include "../config/config.hpp"
+#include "../general/array.hpp"
+#include "operator.hpp"
+#include "vector.hpp"
+
+namespace mfem
+{
+
+class SparseMatrix;
+
+/** @brief Copy of a finalized SparseMatrix in the sliced ELLPACK format
+    SELL-C-sigma, for the matrix-vector products. */
+/** The rows are sorted by decreasing length within windows of sigma rows and
+    grouped in slices of C rows. Each slice is stored column by column with
+    the length of its longest row, so that the products with the C rows of a
+    slice are computed in C independent lanes that the compiler vectorizes,
+    see A. Kreutzer et al., "A unified sparse matrix data format for efficient
+    general sparse matrix-vector multiplication on modern processors with wide
+    SIMD units", SIAM J. Sci. Comput., 36(5), 2014.
+
+    The matrix is copied: changes of the SparseMatrix are not reflected in the
+    SELLMatrix. See SparseMatrix::BuildSELL() for the use of this format by
+    the SparseMatrix methods. */
+class SELLMatrix : public Operator
+{
+protected:
+   int C;       ///< Number of rows in each slice.
+   int sigma;   ///< Size of the row sorting windows.
+   int nslices; ///< Number of slices.
+
+   /// Row of each slice position, -1 for the padding of the last slice.
+   Array<int> rows;
+   /// Number of entries of each slice position.
+   Array<int> row_len;
+   /// Offsets of the slices in #cols and #vals, size #nslices + 1.
+   Array<int> slice_ptr;
+   /// Column indices, padded with the column index 0.
+   Array<int> cols;
+   /// Entries, padded with zeros.
+   Vector vals;
+
+public:
+   /** @brief Copy the finalized matrix @a A with slices of @a C rows, sorting
+       the rows by decreasing length within windows of @a sigma rows. */
+   /** The kernels are specialized for @a C = 4, 8 and 16. With @a sigma = 1,
+       the rows are not sorted. */
+   SELLMatrix(const SparseMatrix &A, int C = 8, int sigma = 64);
+
+   /// Number of rows in each slice.
+   int GetSliceHeight() const { return C; }
+
+   /// Number of stored entries, including the padding.
+   int NumStoredEntries() const { return vals.Size(); }
+
+   void Mult(const Vector &x, Vector &y) const override;
+
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+};
+
+/** @brief Copy of a finalized SparseMatrix in the block CSR format, for the
+    matrices of vector-valued FiniteElementSpace%s. */
+/** The matrix is stored as a CSR matrix of dense @a b x @a b blocks, where the
+    block (I,J) couples the @a b components of the node I with those of the
+    node J, with the indices of the Ordering::byVDIM (I*b + c) or of the
+    Ordering::byNODES (c*n + I, for n nodes) orderings. One column index is
+    stored per block, and the @a b components of x are loaded once per block.
+    Blocks that are only partially present in the SparseMatrix are completed
+    with zeros.
+
+    The matrix is copied: changes of the SparseMatrix are not reflected in the
+    BCSRMatrix. See SparseMatrix::BuildBCSR() for the use of this format by
+    the SparseMatrix methods. */
+class BCSRMatrix : public Operator
+{
+protected:
+   int b;       ///< Block size.
+   bool byvdim; ///< The indices use the Ordering::byVDIM ordering.
+
+   /// Block row offsets, size (height/b + 1).
+   Array<int> bI;
+   /// Block column indices.
+   Array<int> bJ;
+   /// Entries, row-major in each block.
+   Vector bA;
+
+public:
+   /** @brief Copy the finalized matrix @a A with blocks of size @a b, for the
+       Ordering::byVDIM (@a byvdim = true) or the Ordering::byNODES orderings
+       of the rows and columns. */
+   /** The height and the width of @a A must be multiples of @a b, and @a b
+       must not exceed 8. The kernels are specialized for @a b = 2 and 3. */
+   BCSRMatrix(const SparseMatrix &A, int b, bool byvdim = true);
+
+   /// Block size.
+   int GetBlockSize() const { return b; }
+
+   /// Number of stored blocks.
+   int NumBlocks() const { return bJ.Size(); }
+
+   void Mult(const Vector &x, Vector &y) const override;
+
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+};
+
+/** @brief Copy of a finalized SparseMatrix with the entries stored in single
+    precision, e.g. for the inner solver of a MixedPrecisionSolver. */
+/** The products read the entries in single precision and accumulate in the
+    precision of real_t, so that the memory traffic of the entries is halved
+    while the vectors are unchanged. The relative accuracy of the entries is
+    about 1e-7. */
+class SinglePrecisionSparseMatrix : public Operator
+{
+protected:
+   Array<int> I, J;
+   Array<float> A;
+
+public:
+   /// Copy the finalized matrix @a A, rounding its entries to single precision.
+   SinglePrecisionSparseMatrix(const SparseMatrix &A);
+
+   void Mult(const Vector &x, Vector &y) const override;
+
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+};
+
+}
+
+#endif // MFEM_SPARSEMAT_FORMATS
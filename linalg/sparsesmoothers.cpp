@@ -15,6 +15,9 @@
 #include "matrix.hpp"
 #include "sparsemat.hpp"
 #include "sparsesmoothers.hpp"
+#include "../general/forall.hpp"
+#include "../general/table.hpp"
+#include <algorithm>
 #include <iostream>
 
 namespace mfem
@@ -51,6 +54,236 @@ void GSSmoother::Mult(const Vector &x, Vector &y) const
    }
 }
 
+namespace internal
+{
+
+// Greedy distance-1 or distance-2 coloring of the vertices of the graph G,
+// visited in breadth-first order as in Mesh::GetElementColoring(). Returns the
+// number of colors.
+static int GreedyColoring(const Table &G, int distance, Array<int> &colors)
+{
+   const int n = G.Size();
+   const int *i_G = G.GetI(), *j_G = G.GetJ();
+   Array<int> stack(n);
+   colors.SetSize(n);
+   colors = -2;
+   int max_degree = 0, stack_p = 0, stack_top_p = 0;
+   for (int v0 = 0; v0 < n; v0++)
+   {
+      if (colors[v0] != -2) { continue; }
+      colors[v0] = -1;
+      stack[stack_top_p++] = v0;
+      for ( ; stack_p < stack_top_p; stack_p++)
+      {
+         const int v = stack[stack_p];
+         max_degree = std::max(max_degree, i_G[v+1] - i_G[v]);
+         for (int j = i_G[v]; j < i_G[v+1]; j++)
+         {
+            if (colors[j_G[j]] == -2)
+            {
+               colors[j_G[j]] = -1;
+               stack[stack_top_p++] = j_G[j];
+            }
+         }
+      }
+   }
+
+   int num_colors = 0;
+   const int max_colors = distance == 1 ? max_degree + 1 :
+                          max_degree*max_degree + 1;
+   Array<int> col_marker(std::min(max_colors, n + 1));
+   col_marker = -1;
+   for (stack_p = 0; stack_p < n; stack_p++)
+   {
+      const int v = stack[stack_p];
+      for (int j = i_G[v]; j < i_G[v+1]; j++)
+      {
+         const int u = j_G[j];
+         if (colors[u] >= 0) { col_marker[colors[u]] = v; }
+         if (distance == 1) { continue; }
+         for (int k = i_G[u]; k < i_G[u+1]; k++)
+         {
+            const int c = colors[j_G[k]];
+            if (c >= 0) { col_marker[c] = v; }
+         }
+      }
+      int c = 0;
+      while (col_marker[c] == v) { c++; }
+      colors[v] = c;
+      num_colors = std::max(num_colors, c + 1);
+   }
+   return num_colors;
+}
+
+} // namespace internal
+
+MulticolorGSSmoother::MulticolorGSSmoother(int t, int it, real_t w, int d)
+   : type(t), iterations(it), omega(w), distance(d), pattern_nnz(-1),
+     pattern_hash(0)
+{
+   MFEM_VERIFY(distance == 1 || distance == 2,
+               "invalid coloring distance: " << distance);
+}
+
+MulticolorGSSmoother::MulticolorGSSmoother(const SparseMatrix &a, int t,
+                                           int it, real_t w, int d)
+   : MulticolorGSSmoother(t, it, w, d)
+{
+   SetOperator(a);
+}
+
+void MulticolorGSSmoother::SetOperator(const Operator &a)
+{
+   SparseSmoother::SetOperator(a);
+   MFEM_VERIFY(oper->Finalized() && height == width,
+               "the matrix must be square and finalized");
+   Setup();
+}
+
+void MulticolorGSSmoother::Setup()
+{
+   const int n = height;
+   const int *I = oper->HostReadI(), *J = oper->HostReadJ();
+   const real_t *A = oper->HostReadData();
+   const int nnz = I[n];
+
+   inv_diag.SetSize(n);
+   inv_diag.UseDevice(true);
+   real_t *h_inv_diag = inv_diag.HostWrite();
+   for (int i = 0; i < n; i++)
+   {
+      real_t d = 0.0;
+      for (int j = I[i]; j < I[i+1]; j++)
+      {
+         if (J[j] == i) { d = A[j]; break; }
+      }
+      MFEM_VERIFY(d != 0.0, "zero diagonal entry in row " << i);
+      h_inv_diag[i] = 1.0/d;
+   }
+
+   // FNV-1a hash of the sparsity pattern
+   unsigned long long hash = 14695981039346656037ULL;
+   auto Hash = [&hash](int v)
+   {
+      hash = (hash ^ (unsigned long long)(unsigned int)v)*1099511628211ULL;
+   };
+   for (int i = 0; i <= n; i++) { Hash(I[i]); }
+   for (int j = 0; j < nnz; j++) { Hash(J[j]); }
+   if (nnz == pattern_nnz && hash == pattern_hash &&
+       color_rows.Size() == n) { return; }
+   pattern_nnz = nnz;
+   pattern_hash = hash;
+
+   // Symmetrized graph of the matrix, without the diagonal
+   Table G, Gt, S;
+   G.MakeI(n);
+   for (int i = 0; i < n; i++)
+   {
+      for (int j = I[i]; j < I[i+1]; j++)
+      {
+         if (J[j] != i) { G.AddAColumnInRow(i); }
+      }
+   }
+   G.MakeJ();
+   for (int i = 0; i < n; i++)
+   {
+      for (int j = I[i]; j < I[i+1]; j++)
+      {
+         if (J[j] != i) { G.AddConnection(i, J[j]); }
+      }
+   }
+   G.ShiftUpI();
+   Transpose(G, Gt, n);
+   S.MakeI(n);
+   Array<int> marker(n);
+   marker = -1;
+   for (int pass = 0; pass < 2; pass++)
+   {
+      for (int i = 0; i < n; i++)
+      {
+         for (const Table *T : {&G, &Gt})
+         {
+            for (int j = T->GetI()[i]; j < T->GetI()[i+1]; j++)
+            {
+               const int k = T->GetJ()[j];
+               if (marker[k] == 2*i + pass) { continue; }
+               marker[k] = 2*i + pass;
+               if (pass == 0) { S.AddAColumnInRow(i); }
+               else { S.AddConnection(i, k); }
+            }
+         }
+      }
+      if (pass == 0) { S.MakeJ(); }
+   }
+   S.ShiftUpI();
+
+   Array<int> colors;
+   const int num_colors = internal::GreedyColoring(S, distance, colors);
+   color_offsets.SetSize(num_colors + 1);
+   color_offsets = 0;
+   for (int i = 0; i < n; i++) { color_offsets[colors[i] + 1]++; }
+   color_offsets.PartialSum();
+   color_rows.SetSize(n);
+   Array<int> pos(num_colors);
+   for (int c = 0; c < num_colors; c++) { pos[c] = color_offsets[c]; }
+   for (int i = 0; i < n; i++) { color_rows[pos[colors[i]]++] = i; }
+}
+
+void MulticolorGSSmoother::GetColoring(Array<int> &colors) const
+{
+   colors.SetSize(height);
+   for (int c = 0; c < GetNumColors(); c++)
+   {
+      for (int k = color_offsets[c]; k < color_offsets[c+1]; k++)
+      {
+         colors[color_rows[k]] = c;
+      }
+   }
+}
+
+void MulticolorGSSmoother::Sweep(const Vector &x, Vector &y,
+                                 bool forward) const
+{
+   const int *d_I = oper->ReadI(), *d_J = oper->ReadJ();
+   const real_t *d_A = oper->ReadData();
+   const int *d_color_rows = color_rows.Read();
+   const real_t *d_inv_diag = inv_diag.Read();
+   const real_t *d_x = x.Read();
+   real_t *d_y = y.ReadWrite();
+   const real_t w = omega;
+   const int num_colors = GetNumColors();
+   for (int c0 = 0; c0 < num_colors; c0++)
+   {
+      const int c = forward ? c0 : num_colors - 1 - c0;
+      const int *d_rows = d_color_rows + color_offsets[c];
+      mfem::forall(color_offsets[c+1] - color_offsets[c],
+                   [=] MFEM_HOST_DEVICE (int k)
+      {
+         const int i = d_rows[k];
+         real_t sum = d_x[i];
+         for (int j = d_I[i]; j < d_I[i+1]; j++)
+         {
+            if (d_J[j] != i) { sum -= d_A[j]*d_y[d_J[j]]; }
+         }
+         d_y[i] += w*(sum*d_inv_diag[i] - d_y[i]);
+      });
+   }
+}
+
+void MulticolorGSSmoother::Mult(const Vector &x, Vector &y) const
+{
+   if (!iterative_mode)
+   {
+      y.UseDevice(true);
+      y = 0.0;
+   }
+   for (int i = 0; i < iterations; i++)
+   {
+      if (type != 2) { Sweep(x, y, true); }
+      if (type != 1) { Sweep(x, y, false); }
+   }
+}
+
 /// Create the Jacobi smoother.
 DSmoother::DSmoother(const SparseMatrix &a, int t, real_t s, int it)
    : SparseSmoother(a)
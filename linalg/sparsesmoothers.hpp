@@ -51,6 +51,63 @@ public:
    void Mult(const Vector &x, Vector &y) const override;
 };
 
+/** @brief Multicolor Gauss-Seidel, SOR and SSOR smoother for a SparseMatrix,
+    which updates the rows of one color of the matrix graph in parallel. */
+/** The rows are colored greedily, in breadth-first order as in
+    Mesh::GetElementColoring(), on the symmetrized graph of the matrix, so that
+    two rows of the same color are not coupled (distance 1) or, in addition,
+    have no common neighbor (distance 2). The sweeps process the colors one
+    after the other, using mfem::forall over the rows of each color, i.e. the
+    threads of Backend::CPU_THREADS or a GPU backend. The result does not
+    depend on the number of threads, but differs from the one of GSSmoother,
+    which uses the natural ordering of the rows.
+
+    The coloring is kept by SetOperator() when the new matrix has the same
+    sparsity pattern, e.g. on the same level of a Multigrid hierarchy after a
+    reassembly. */
+class MulticolorGSSmoother : public SparseSmoother
+{
+protected:
+   int type; // 0, 1, 2 - symmetric, forward, backward
+   int iterations;
+   real_t omega;
+   int distance;
+
+   /// Rows sorted by color, the rows of color c are in [offsets[c], offsets[c+1]).
+   Array<int> color_offsets, color_rows;
+   /// Inverse of the diagonal of the matrix.
+   Vector inv_diag;
+   /// Size and hash of the sparsity pattern of the current coloring.
+   int pattern_nnz;
+   unsigned long long pattern_hash;
+
+   void Setup();
+   void Sweep(const Vector &x, Vector &y, bool forward) const;
+
+public:
+   /** @brief Create a smoother with the given @a type (0, 1, 2 - symmetric,
+       forward, backward), number of @a iterations, relaxation parameter
+       @a omega (1 for Gauss-Seidel) and coloring @a distance (1 or 2). */
+   MulticolorGSSmoother(int type = 0, int iterations = 1, real_t omega = 1.0,
+                        int distance = 1);
+
+   /// Create a smoother for the finalized square matrix @a a.
+   MulticolorGSSmoother(const SparseMatrix &a, int type = 0,
+                        int iterations = 1, real_t omega = 1.0,
+                        int distance = 1);
+
+   void SetOperator(const Operator &a) override;
+
+   /// Number of colors of the matrix graph.
+   int GetNumColors() const { return color_offsets.Size() - 1; }
+
+   /// Return the color of each row.
+   void GetColoring(Array<int> &colors) const;
+
+   /// Apply the smoother.
+   void Mult(const Vector &x, Vector &y) const override;
+};
+
 /// Data type for scaled Jacobi-type smoother of sparse matrix
 class DSmoother : public SparseSmoother
 {
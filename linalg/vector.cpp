@@ -13,6 +13,7 @@
 
 #include "kernels.hpp"
 #include "vector.hpp"
+#include "fused_sums.hpp"
 #include "../general/forall.hpp"
 
 #ifdef MFEM_USE_OPENMP
@@ -24,6 +25,7 @@
 #include <cmath>
 #include <ctime>
 #include <limits>
+#include <vector>
 
 namespace mfem
 {
@@ -535,6 +537,174 @@ void subtract(const real_t a, const Vector &x, const Vector &y, Vector &z)
    }
 }
 
+namespace internal
+{
+
+// Data pointers of up to MDOT_MAX_VECTORS vectors, captured by value in the
+// kernels.
+struct MVectorData
+{
+   const real_t *v[MDOT_MAX_VECTORS];
+   real_t a[MDOT_MAX_VECTORS];
+};
+
+// Inner products of x with the NK vectors in v, NK <= MDOT_MAX_VECTORS. The
+// number of vectors is a template parameter, so that the loops are unrolled.
+template <int NK>
+static void MDotKernel(bool use_dev, int N, const real_t *d_x,
+                       const MVectorData &d_v, real_t *dots)
+{
+   FusedSums<NK>(use_dev, N, NK, dots,
+                 [=] MFEM_HOST_DEVICE (int i, real_t *acc)
+   {
+      const real_t xi = d_x[i];
+      for (int k = 0; k < NK; k++) { acc[k] += xi*d_v.v[k][i]; }
+   });
+}
+
+// Update x += sum_k a[k] v[k] with the NK vectors in v.
+template <int NK>
+static void MAddKernel(bool use_dev, int N, real_t *d_x,
+                       const MVectorData &d_v)
+{
+   mfem::forall_switch(use_dev, N, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t xi = d_x[i];
+      for (int k = 0; k < NK; k++) { xi += d_v.a[k]*d_v.v[k][i]; }
+      d_x[i] = xi;
+   });
+}
+
+} // namespace internal
+
+real_t AddDot(real_t a, const Vector &x, Vector &y, const Vector &z)
+{
+   MFEM_ASSERT(x.Size() == y.Size() && z.Size() == y.Size(),
+               "incompatible Vectors!");
+   const bool use_dev = x.UseDevice() || y.UseDevice() || z.UseDevice();
+   const int N = y.Size();
+   // Note: get read access first, in case z is the same as y.
+   auto d_x = x.Read(use_dev);
+   auto d_z = z.Read(use_dev);
+   auto d_y = y.ReadWrite(use_dev);
+   real_t dot;
+   internal::FusedSums<1>(use_dev, N, 1, &dot,
+                          [=] MFEM_HOST_DEVICE (int i, real_t *acc)
+   {
+      d_y[i] += a*d_x[i];
+      acc[0] += d_y[i]*d_z[i];
+   });
+   return dot;
+}
+
+void AddAdd(real_t a, const Vector &x, Vector &y,
+            real_t b, const Vector &u, Vector &v)
+{
+   MFEM_ASSERT(x.Size() == y.Size() && u.Size() == y.Size() &&
+               v.Size() == y.Size(), "incompatible Vectors!");
+   const bool use_dev = x.UseDevice() || y.UseDevice() || u.UseDevice() ||
+                        v.UseDevice();
+   const int N = y.Size();
+   auto d_x = x.Read(use_dev);
+   auto d_u = u.Read(use_dev);
+   auto d_y = y.ReadWrite(use_dev);
+   auto d_v = v.ReadWrite(use_dev);
+   mfem::forall_switch(use_dev, N, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_y[i] += a*d_x[i];
+      d_v[i] += b*d_u[i];
+   });
+}
+
+real_t AddAddDot(real_t a, const Vector &x, Vector &y,
+                 real_t b, const Vector &u, Vector &v, const Vector &w)
+{
+   MFEM_ASSERT(x.Size() == y.Size() && u.Size() == y.Size() &&
+               v.Size() == y.Size() && w.Size() == y.Size(),
+               "incompatible Vectors!");
+   const bool use_dev = x.UseDevice() || y.UseDevice() || u.UseDevice() ||
+                        v.UseDevice() || w.UseDevice();
+   const int N = y.Size();
+   // Note: get read access first, in case w is the same as v.
+   auto d_x = x.Read(use_dev);
+   auto d_u = u.Read(use_dev);
+   auto d_w = w.Read(use_dev);
+   auto d_y = y.ReadWrite(use_dev);
+   auto d_v = v.ReadWrite(use_dev);
+   real_t dot;
+   internal::FusedSums<1>(use_dev, N, 1, &dot,
+                          [=] MFEM_HOST_DEVICE (int i, real_t *acc)
+   {
+      d_y[i] += a*d_x[i];
+      d_v[i] += b*d_u[i];
+      acc[0] += d_v[i]*d_w[i];
+   });
+   return dot;
+}
+
+void MDot(const Vector &x, int n, const Vector *const *v, real_t *dots)
+{
+   const int N = x.Size();
+   for (int k0 = 0; k0 < n; k0 += MDOT_MAX_VECTORS)
+   {
+      const int nk = std::min(n - k0, MDOT_MAX_VECTORS);
+      bool use_dev = x.UseDevice();
+      for (int k = 0; k < nk; k++)
+      {
+         MFEM_ASSERT(v[k0+k]->Size() == N, "incompatible Vectors!");
+         use_dev = use_dev || v[k0+k]->UseDevice();
+      }
+      internal::MVectorData d_v;
+      for (int k = 0; k < nk; k++) { d_v.v[k] = v[k0+k]->Read(use_dev); }
+      auto d_x = x.Read(use_dev);
+      real_t *d = dots + k0;
+      switch (nk)
+      {
+         case 1: internal::MDotKernel<1>(use_dev, N, d_x, d_v, d); break;
+         case 2: internal::MDotKernel<2>(use_dev, N, d_x, d_v, d); break;
+         case 3: internal::MDotKernel<3>(use_dev, N, d_x, d_v, d); break;
+         case 4: internal::MDotKernel<4>(use_dev, N, d_x, d_v, d); break;
+         case 5: internal::MDotKernel<5>(use_dev, N, d_x, d_v, d); break;
+         case 6: internal::MDotKernel<6>(use_dev, N, d_x, d_v, d); break;
+         case 7: internal::MDotKernel<7>(use_dev, N, d_x, d_v, d); break;
+         case 8: internal::MDotKernel<8>(use_dev, N, d_x, d_v, d); break;
+      }
+   }
+}
+
+void MAdd(Vector &x, int n, const real_t *a, const Vector *const *v)
+{
+   const int N = x.Size();
+   for (int k0 = 0; k0 < n; k0 += MDOT_MAX_VECTORS)
+   {
+      const int nk = std::min(n - k0, MDOT_MAX_VECTORS);
+      bool use_dev = x.UseDevice();
+      for (int k = 0; k < nk; k++)
+      {
+         MFEM_ASSERT(v[k0+k]->Size() == N, "incompatible Vectors!");
+         use_dev = use_dev || v[k0+k]->UseDevice();
+      }
+      internal::MVectorData d_v;
+      for (int k = 0; k < nk; k++)
+      {
+         d_v.v[k] = v[k0+k]->Read(use_dev);
+         d_v.a[k] = a[k0+k];
+      }
+      auto d_x = x.ReadWrite(use_dev);
+      switch (nk)
+      {
+         case 1: internal::MAddKernel<1>(use_dev, N, d_x, d_v); break;
+         case 2: internal::MAddKernel<2>(use_dev, N, d_x, d_v); break;
+         case 3: internal::MAddKernel<3>(use_dev, N, d_x, d_v); break;
+         case 4: internal::MAddKernel<4>(use_dev, N, d_x, d_v); break;
+         case 5: internal::MAddKernel<5>(use_dev, N, d_x, d_v); break;
+         case 6: internal::MAddKernel<6>(use_dev, N, d_x, d_v); break;
+         case 7: internal::MAddKernel<7>(use_dev, N, d_x, d_v); break;
+         case 8: internal::MAddKernel<8>(use_dev, N, d_x, d_v); break;
+      }
+   }
+}
+
 void Vector::cross3D(const Vector &vin, Vector &vout) const
 {
    HostRead();
@@ -1179,7 +1349,7 @@ real_t Vector::operator*(const Vector &v) const
 #define MFEM_USE_OPENMP_DETERMINISTIC_DOT
 #ifdef MFEM_USE_OPENMP_DETERMINISTIC_DOT
       // By default, use a deterministic way of computing the dot product
-      static Vector th_dot;
+      Vector th_dot;
       #pragma omp parallel
       {
          const int nt = omp_get_num_threads();
@@ -1210,6 +1380,24 @@ real_t Vector::operator*(const Vector &v) const
 #endif // MFEM_USE_OPENMP_DETERMINISTIC_DOT
    }
 #endif // MFEM_USE_OPENMP
+   if (Device::Allows(Backend::CPU_THREADS))
+   {
+      // Deterministic: the partial sums only depend on the number of threads
+      const int nb = std::min(size, 4*ThreadPool::Global().NumThreads());
+      Vector th_dot(nb);
+      real_t *b_dot = th_dot.HostWrite();
+      const real_t *x = HostRead(), *y = v.HostRead();
+      const int N = size;
+      ThreadsWrap(nb, [=](int b)
+      {
+         const int start = int((long long)N*b/nb);
+         const int stop  = int((long long)N*(b+1)/nb);
+         real_t my_dot = 0.0;
+         for (int i = start; i < stop; i++) { my_dot += x[i] * y[i]; }
+         b_dot[b] = my_dot;
+      });
+      return th_dot.Sum();
+   }
    if (Device::Allows(Backend::DEBUG_DEVICE))
    {
       const int N = size;
@@ -722,6 +722,39 @@ inline real_t InnerProduct(const Vector &x, const Vector &y)
    return x * y;
 }
 
+/** @name Fused vector operations
+    These functions combine several BLAS-1 operations in one pass over the
+    data, e.g. for the Krylov solvers. Like InnerProduct(const Vector&, const
+    Vector&), the inner products are local: in parallel, they are summed over
+    the MPI ranks by the caller, with one reduction for all of them. */
+///@{
+
+/// Maximum number of vectors of MDot() and MAdd() processed in one pass.
+constexpr int MDOT_MAX_VECTORS = 8;
+
+/** @brief Set y = y + a x and return the inner product of the updated y with
+    z, in one pass. The vector @a z may be @a y, giving the squared norm. */
+real_t AddDot(real_t a, const Vector &x, Vector &y, const Vector &z);
+
+/// Set y = y + a x and v = v + b u, in one pass.
+void AddAdd(real_t a, const Vector &x, Vector &y,
+            real_t b, const Vector &u, Vector &v);
+
+/** @brief Set y = y + a x and v = v + b u, and return the inner product of
+    the updated v with w, in one pass. The vector @a w may be @a v. */
+real_t AddAddDot(real_t a, const Vector &x, Vector &y,
+                 real_t b, const Vector &u, Vector &v, const Vector &w);
+
+/** @brief Compute the inner products dots[k] = (x, v[k]), k = 0, ..., n-1,
+    reading @a x once for every MDOT_MAX_VECTORS vectors. */
+void MDot(const Vector &x, int n, const Vector *const *v, real_t *dots);
+
+/** @brief Set x = x + sum_k a[k] v[k], k = 0, ..., n-1, reading and writing
+    @a x once for every MDOT_MAX_VECTORS vectors. */
+void MAdd(Vector &x, int n, const real_t *a, const Vector *const *v);
+
+///@}
+
 #ifdef MFEM_USE_MPI
 /// Returns the inner product of x and y in parallel
 /** In parallel this computes the inner product of the global vectors,
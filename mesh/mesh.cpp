@@ -16,6 +16,7 @@
 #include "../general/sort_pairs.hpp"
 #include "../general/binaryio.hpp"
 #include "../general/text.hpp"
+#include "../general/annotation.hpp"
 #include "../general/device.hpp"
 #include "../general/tic_toc.hpp"
 #include "../general/gecko.hpp"
@@ -4648,6 +4649,7 @@ void Mesh::SetMeshGen()
 void Mesh::Loader(std::istream &input, int generate_edges,
                   std::string parse_tag)
 {
+   MFEM_PERF_SCOPE("Mesh::Loader");
    int curved = 0, read_gf = 1;
    bool finalize_topo = true;
 
@@ -4669,6 +4671,10 @@ void Mesh::Loader(std::istream &input, int generate_edges,
    else if (mesh_type == "MFEM mesh v1.2") { mfem_version = 12; } // parallel
    else if (mesh_type == "MFEM mesh v1.3") { mfem_version = 13; } // attr sets
 
+   // MFEM's binary conforming mesh format
+   int mfem_bin_version = 0;
+   if (mesh_type == "MFEM binary mesh v1.0") { mfem_bin_version = 10; }
+
    // MFEM nonconforming mesh format
    // (NOTE: previous v1.1 is now under this branch for backward compatibility)
    int mfem_nc_version = 0;
@@ -4688,6 +4694,12 @@ void Mesh::Loader(std::istream &input, int generate_edges,
       }
       ReadMFEMMesh(input, mfem_version, curved);
    }
+   else if (mfem_bin_version)
+   {
+      // The binary format always ends with a tag, see the v1.2 case above.
+      if (parse_tag.empty()) { parse_tag = "mfem_mesh_end"; }
+      ReadMFEMBinaryMesh(input, curved);
+   }
    else if (mfem_nc_version)
    {
       MFEM_ASSERT(ncmesh == NULL, "internal error");
@@ -4840,7 +4852,7 @@ void Mesh::Loader(std::istream &input, int generate_edges,
 
    // If a parse tag was supplied, keep reading the stream until the tag is
    // encountered.
-   if (mfem_version >= 12)
+   if (mfem_version >= 12 || mfem_bin_version)
    {
       string line;
       do
@@ -7648,7 +7660,9 @@ const Table & Mesh::ElementToElementTable()
       }
    }
 
-   conn.Sort();
+   RadixSort(conn.GetData(), conn.Size(),
+             [](const Connection &c) { return c.from; },
+             [](const Connection &c) { return c.to; });
    conn.Unique();
    el_to_el = new Table(NumOfElements, conn);
 
@@ -11472,6 +11486,7 @@ void Mesh::PrintXG(std::ostream &os) const
 void Mesh::Printer(std::ostream &os, std::string section_delimiter,
                    const std::string &comments) const
 {
+   MFEM_PERF_SCOPE("Mesh::Printer");
    int i, j;
 
    if (NURBSext)
@@ -11594,6 +11609,115 @@ void Mesh::Printer(std::ostream &os, std::string section_delimiter,
    }
 }
 
+void Mesh::BinaryPrinter(std::ostream &os, std::string section_delimiter) const
+{
+   MFEM_PERF_SCOPE("Mesh::BinaryPrinter");
+   MFEM_VERIFY(!NURBSext && !Nonconforming(),
+               "the binary mesh format does not support NURBS and "
+               "nonconforming meshes");
+
+   os << "MFEM binary mesh v1.0\n";
+
+   // Pad the following comment line such that the binary header starts at a
+   // multiple of binary_mesh_align bytes, if the stream position is known.
+   const long long start = os.tellp();
+   const long long gap = (start < 0) ? 0 :
+                         (binary_mesh_align - (start + 2) % binary_mesh_align) %
+                         binary_mesh_align;
+   os << '#' << std::string(gap, ' ') << '\n';
+
+   // all offsets below are relative to the start of the binary header
+   long long offset = 0;
+   auto write_section = [&](const void *data, long long bytes)
+   {
+      os.write(static_cast<const char*>(data), bytes);
+      offset += bytes;
+      const long long pad = (binary_mesh_align -
+                             offset % binary_mesh_align) % binary_mesh_align;
+      os << std::string(pad, '\0');
+      offset += pad;
+   };
+
+   auto count_verts = [](const Array<Element*> &elems)
+   {
+      long long num_verts = 0;
+      for (int j = 0; j < elems.Size(); j++)
+      {
+         num_verts += elems[j]->GetNVertices();
+      }
+      return num_verts;
+   };
+
+   const bool set_names = attribute_sets.SetsExist() ||
+                          bdr_attribute_sets.SetsExist();
+   const int header[4] = { binary_mesh_magic, int(sizeof(int)),
+                           int(sizeof(real_t)), 0
+                         };
+   const long long sizes[8] =
+   {
+      Dim, spaceDim, NumOfVertices, NumOfElements, NumOfBdrElements,
+      count_verts(elements), count_verts(boundary),
+      (Nodes ? 1 : 0) | (set_names ? 2 : 0)
+   };
+   const long long int_max = std::numeric_limits<int>::max();
+   MFEM_VERIFY(sizes[5] <= int_max && sizes[6] <= int_max &&
+               sizes[1]*sizes[2] <= int_max,
+               "the mesh is too large for the binary mesh format");
+   os.write(reinterpret_cast<const char*>(header), sizeof(header));
+   offset += sizeof(header);
+   write_section(sizes, sizeof(sizes));
+
+   auto write_elements = [&](const Array<Element*> &elems, int num_verts)
+   {
+      const int num_elems = elems.Size();
+      Array<int> geoms(num_elems), attrs(num_elems), verts(num_verts);
+      for (int j = 0, k = 0; j < num_elems; j++)
+      {
+         const Element *el = elems[j];
+         geoms[j] = el->GetGeometryType();
+         attrs[j] = el->GetAttribute();
+         const int nv = el->GetNVertices();
+         const int *v = el->GetVertices();
+         for (int i = 0; i < nv; i++) { verts[k++] = v[i]; }
+      }
+      write_section(geoms.GetData(), num_elems*sizeof(int));
+      write_section(attrs.GetData(), num_elems*sizeof(int));
+      write_section(verts.GetData(), num_verts*sizeof(int));
+   };
+   write_elements(elements, int(sizes[5]));
+   write_elements(boundary, int(sizes[6]));
+
+   if (Nodes == NULL)
+   {
+      Array<real_t> coords(NumOfVertices*spaceDim);
+      for (int j = 0; j < NumOfVertices; j++)
+      {
+         for (int i = 0; i < spaceDim; i++)
+         {
+            coords[j*spaceDim + i] = vertices[j](i);
+         }
+      }
+      write_section(coords.GetData(), coords.Size()*sizeof(real_t));
+   }
+
+   if (set_names)
+   {
+      os << "\nattribute_sets\n";
+      attribute_sets.Print(os);
+      os << "\nbdr_attribute_sets\n";
+      bdr_attribute_sets.Print(os);
+   }
+
+   if (Nodes)
+   {
+      os << "\nnodes\n";
+      Nodes->SaveBinary(os);
+   }
+
+   if (section_delimiter.empty()) { section_delimiter = "mfem_mesh_end"; }
+   os << '\n' << section_delimiter << endl;
+}
+
 void Mesh::PrintTopo(std::ostream &os, const Array<int> &e_to_k,
 		     const int version, const std::string &comments) const
 {
@@ -11648,6 +11772,12 @@ void Mesh::Save(const std::string &fname, int precision) const
    Print(ofs);
 }
 
+void Mesh::SaveBinary(const std::string &fname) const
+{
+   ofstream ofs(fname, std::ios::out | std::ios::binary);
+   PrintBinary(ofs);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void Mesh::Print(adios2stream &os) const
 {
@@ -265,6 +265,11 @@ protected:
    static const int vtk_quadratic_wedge[18];
    static const int vtk_quadratic_hex[27];
 
+   // Identification and section alignment of the MFEM binary mesh format,
+   // see PrintBinary().
+   static const int binary_mesh_magic;
+   static const int binary_mesh_align;
+
 #ifdef MFEM_USE_MEMALLOC
    friend class Tetrahedron;
    MemAlloc <Tetrahedron, 1024> TetMemory;
@@ -327,6 +332,7 @@ protected:
    // Readers for different mesh formats, used in the Load() method.
    // The implementations of these methods are in mesh_readers.cpp.
    void ReadMFEMMesh(std::istream &input, int version, int &curved);
+   void ReadMFEMBinaryMesh(std::istream &input, int &curved);
    void ReadLineMesh(std::istream &input);
    void ReadNetgen2DMesh(std::istream &input, int &curved);
    void ReadNetgen3DMesh(std::istream &input);
@@ -596,6 +602,12 @@ protected:
                 std::string section_delimiter = "",
                 const std::string &comments = "") const;
 
+   /** Write the mesh in the MFEM binary mesh v1.0 format, see PrintBinary(),
+       followed by the given @a section_delimiter, or by "mfem_mesh_end" if
+       @a section_delimiter is empty. */
+   void BinaryPrinter(std::ostream &os,
+                      std::string section_delimiter = "") const;
+
    /// @brief Creates a mesh for the parallelepiped [0,sx]x[0,sy]x[0,sz],
    /// divided into nx*ny*nz hexahedra if @a type = HEXAHEDRON or into
    /// 6*nx*ny*nz tetrahedrons if @a type = TETRAHEDRON.
@@ -2388,6 +2400,22 @@ public:
    /// used for ASCII output.
    virtual void Save(const std::string &fname, int precision=16) const;
 
+   /** @brief Print the mesh to the given stream using the MFEM binary mesh
+       v1.0 format. The file can be read with Load() or the Mesh constructors,
+       like the ASCII formats. */
+   /** After two text lines, the file contains a fixed-width header and the
+       sections of the element and boundary geometries, attributes and
+       vertices, and of the vertex coordinates, in the byte order and real_t
+       precision of the writer. Each section starts at a multiple of 64 bytes
+       from the beginning of the file, so that the arrays are aligned when the
+       file is read or memory mapped. The curvature GridFunction, if any, is
+       written with GridFunction::SaveBinary(). Nonconforming and NURBS meshes
+       are not supported. */
+   void PrintBinary(std::ostream &os) const { BinaryPrinter(os); }
+
+   /// Save the mesh to a file using Mesh::PrintBinary.
+   void SaveBinary(const std::string &fname) const;
+
    /// Print the mesh to the given stream using the adios2 bp format
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &os) const;
@@ -21,6 +21,7 @@
 #include <vector>
 #include <algorithm>
 #include <map>
+#include <limits>
 
 #ifdef MFEM_USE_NETCDF
 #include "netcdf.h"
@@ -130,6 +131,148 @@ void Mesh::ReadMFEMMesh(std::istream &input, int version, int &curved)
    if (remove_unused_vertices) { RemoveUnusedVertices(); }
 }
 
+const int Mesh::binary_mesh_magic = 0x4d464542; // "BEFM" in little endian
+const int Mesh::binary_mesh_align = 64;
+
+void Mesh::ReadMFEMBinaryMesh(std::istream &input, int &curved)
+{
+   // Read MFEM binary mesh v1.0 format, see Mesh::BinaryPrinter()
+   string ident;
+
+   // the comment line padding the header to binary_mesh_align bytes
+   getline(input, ident);
+   MFEM_VERIFY(!ident.empty() && ident[0] == '#', "invalid binary mesh file");
+
+   // all offsets below are relative to the start of the binary header
+   long long offset = 0;
+   auto read_section = [&](void *data, long long bytes)
+   {
+      input.read(static_cast<char*>(data), bytes);
+      offset += bytes;
+      const long long pad = (binary_mesh_align -
+                             offset % binary_mesh_align) % binary_mesh_align;
+      input.ignore(pad);
+      offset += pad;
+      MFEM_VERIFY(input.good(), "error reading binary mesh file");
+   };
+
+   int header[4];
+   long long sizes[8];
+   input.read(reinterpret_cast<char*>(header), sizeof(header));
+   offset += sizeof(header);
+   read_section(sizes, sizeof(sizes));
+
+   MFEM_VERIFY(header[0] == binary_mesh_magic,
+               "invalid binary mesh file or incompatible byte order");
+   MFEM_VERIFY(header[1] == int(sizeof(int)) &&
+               header[2] == int(sizeof(real_t)),
+               "the binary mesh was written with sizeof(int) = " << header[1]
+               << ", sizeof(real_t) = " << header[2]);
+
+   // Validate the sizes before allocating anything: they come straight from
+   // the file and are used below as allocation and read sizes.
+   const long long int_max = std::numeric_limits<int>::max();
+   const long long max_elem_verts = Geometry::NumVerts[Geometry::CUBE];
+   const long long flags = sizes[7];
+   MFEM_VERIFY(sizes[0] >= 0 && sizes[0] <= 3 &&
+               sizes[1] >= sizes[0] && sizes[1] <= 3,
+               "invalid binary mesh file: dimension " << sizes[0]
+               << ", space dimension " << sizes[1]);
+   for (int i = 2; i < 7; i++)
+   {
+      MFEM_VERIFY(sizes[i] >= 0 && sizes[i] <= int_max,
+                  "invalid binary mesh file: size " << sizes[i]);
+   }
+   MFEM_VERIFY(sizes[5] <= max_elem_verts*sizes[3] &&
+               sizes[6] <= max_elem_verts*sizes[4] &&
+               sizes[1]*sizes[2] <= int_max && (flags & ~3LL) == 0,
+               "invalid binary mesh file");
+
+   Dim = int(sizes[0]);
+   const int sdim = int(sizes[1]);
+   NumOfVertices = int(sizes[2]);
+   NumOfElements = int(sizes[3]);
+   NumOfBdrElements = int(sizes[4]);
+   const bool has_nodes = flags & 1;
+   const bool set_names = flags & 2;
+
+   auto read_elements = [&](Array<Element*> &elems, int num_elems,
+                            int num_verts, int elem_dim)
+   {
+      Array<int> geoms(num_elems), attrs(num_elems), verts(num_verts);
+      read_section(geoms.GetData(), num_elems*sizeof(int));
+      read_section(attrs.GetData(), num_elems*sizeof(int));
+      read_section(verts.GetData(), num_verts*sizeof(int));
+      for (int k = 0; k < num_verts; k++)
+      {
+         MFEM_VERIFY(verts[k] >= 0 && verts[k] < NumOfVertices,
+                     "invalid vertex index: " << verts[k]);
+      }
+      elems.SetSize(num_elems);
+      int k = 0;
+      for (int j = 0; j < num_elems; j++)
+      {
+         const int geom = geoms[j];
+         MFEM_VERIFY(geom >= 0 && geom < Geometry::NumGeom &&
+                     Geometry::Dimension[geom] == elem_dim,
+                     "invalid element geometry: " << geom);
+         MFEM_VERIFY(k + Geometry::NumVerts[geom] <= num_verts,
+                     "invalid binary mesh file");
+         elems[j] = NewElement(geom);
+         elems[j]->SetAttribute(attrs[j]);
+         elems[j]->SetVertices(verts.GetData() + k);
+         k += Geometry::NumVerts[geom];
+      }
+      MFEM_VERIFY(k == num_verts, "invalid binary mesh file");
+   };
+   read_elements(elements, NumOfElements, int(sizes[5]), Dim);
+   read_elements(boundary, NumOfBdrElements, int(sizes[6]), std::max(Dim-1, 0));
+
+   vertices.SetSize(NumOfVertices);
+   if (!has_nodes)
+   {
+      spaceDim = sdim;
+      Array<real_t> coords(NumOfVertices*spaceDim);
+      read_section(coords.GetData(), coords.Size()*sizeof(real_t));
+      for (int j = 0; j < NumOfVertices; j++)
+      {
+         for (int i = 0; i < spaceDim; i++)
+         {
+            vertices[j](i) = coords[j*spaceDim + i];
+         }
+      }
+   }
+
+   if (set_names)
+   {
+      skip_comment_lines(input, '#');
+      input >> ident; // 'attribute_sets'
+      MFEM_VERIFY(ident == "attribute_sets", "invalid mesh file");
+      attribute_sets.attr_sets.Load(input);
+      attribute_sets.attr_sets.SortAll();
+      attribute_sets.attr_sets.UniqueAll();
+
+      skip_comment_lines(input, '#');
+      input >> ident; // 'bdr_attribute_sets'
+      MFEM_VERIFY(ident == "bdr_attribute_sets", "invalid mesh file");
+      bdr_attribute_sets.attr_sets.Load(input);
+      bdr_attribute_sets.attr_sets.SortAll();
+      bdr_attribute_sets.attr_sets.UniqueAll();
+   }
+
+   if (has_nodes)
+   {
+      skip_comment_lines(input, '#');
+      input >> ident; // 'nodes'
+      MFEM_VERIFY(ident == "nodes", "invalid mesh file");
+      // prepare to read the nodes
+      input >> ws;
+      curved = 1;
+   }
+
+   if (remove_unused_vertices) { RemoveUnusedVertices(); }
+}
+
 void Mesh::ReadLineMesh(std::istream &input)
 {
    int j,p1,p2,a;
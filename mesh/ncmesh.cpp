@@ -2330,6 +2330,10 @@ void NCMesh::Derefine(const Array<int> &derefs)
       DerefineElement(parent);
    }
 
+   // shrink the probe tables after the deletion of nodes and faces
+   nodes.Compact();
+   faces.Compact();
+
    // update leaf_elements, Element::index etc.
    Update();
 
@@ -18,6 +18,7 @@
 #include "../general/sets.hpp"
 #include "../general/sort_pairs.hpp"
 #include "../general/text.hpp"
+#include "../general/annotation.hpp"
 #include "../general/globals.hpp"
 
 #include <iostream>
@@ -6312,6 +6313,7 @@ long long ParMesh::ReduceInt(int value) const
 
 void ParMesh::ParPrint(ostream &os, const std::string &comments) const
 {
+   MFEM_PERF_SCOPE("ParMesh::ParPrint");
    if (NURBSext)
    {
       // TODO: NURBS meshes.
@@ -6331,6 +6333,22 @@ void ParMesh::ParPrint(ostream &os, const std::string &comments) const
    // be adding additional parallel mesh information.
    Printer(os, "mfem_serial_mesh_end", comments);
 
+   PrintSharedEntities(os);
+}
+
+void ParMesh::ParPrintBinary(ostream &os) const
+{
+   MFEM_VERIFY(Conforming() && !NURBSext,
+               "the binary mesh format does not support NURBS and "
+               "nonconforming meshes");
+
+   BinaryPrinter(os, "mfem_serial_mesh_end");
+
+   PrintSharedEntities(os);
+}
+
+void ParMesh::PrintSharedEntities(ostream &os) const
+{
    // write out group topology info.
    gtopo.Save(os);
 
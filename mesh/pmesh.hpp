@@ -317,6 +317,10 @@ protected:
 
    void LoadSharedEntities(std::istream &input);
 
+   /// Write the group topology and the shared entities read by
+   /// LoadSharedEntities(), followed by the 'mfem_mesh_end' tag.
+   void PrintSharedEntities(std::ostream &os) const;
+
    /// If the mesh is curved, make sure 'Nodes' is ParGridFunction.
    /** Note that this method is not related to the public 'Mesh::EnsureNodes`.*/
    void EnsureParNodes();
@@ -694,6 +698,12 @@ public:
        begin with '#'. */
    void ParPrint(std::ostream &out, const std::string &comments = "") const;
 
+   /** Save the mesh in a parallel mesh format, with the serial part of the
+       mesh written with Mesh::PrintBinary(). Works for conforming meshes
+       only. The result can be read back with the ParMesh constructors and
+       Load(), like the output of ParPrint(). */
+   void ParPrintBinary(std::ostream &out) const;
+
    // Enable Print() to add the parallel interface as boundary (typically used
    // for visualization purposes)
    void SetPrintShared(bool print) { print_shared = print; }
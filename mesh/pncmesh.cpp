@@ -1705,6 +1705,10 @@ void ParNCMesh::Derefine(const Array<int> &derefs)
       }
    }
 
+   // shrink the probe tables after the deletion of nodes and faces
+   nodes.Compact();
+   faces.Compact();
+
    // update leaf_elements, Element::index etc.
    Update();
 
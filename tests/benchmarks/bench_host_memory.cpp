@@ -0,0 +1,162 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+  This benchmark measures the effect of the HostMemoryPolicy (transparent huge
+  pages and NUMA placement) on the action of the partial assembly diffusion
+  operator, which is bound by the memory bandwidth and streams through the
+  large quadrature data array. On Linux, the number of data TLB misses per
+  operator application is reported in the 'dTLB-misses' counter, when the
+  performance counters are accessible (see /proc/sys/kernel/perf_event_paranoid).
+
+   * --benchmark_filter=PADiffusion/[policy]/[order]
+     with policy: 0 = default, 1 = huge pages, 2 = huge pages + interleaved
+*/
+
+// Counter of the data TLB read misses of the calling thread.
+class TLBMissCounter
+{
+   int fd = -1;
+public:
+   TLBMissCounter()
+   {
+#ifdef __linux__
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fd = int(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+   }
+   ~TLBMissCounter() { if (fd >= 0) { close(fd); } }
+
+   bool IsAvailable() const { return fd >= 0; }
+
+   void Start()
+   {
+#ifdef __linux__
+      if (fd < 0) { return; }
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+   }
+
+   long long Stop()
+   {
+      long long count = 0;
+#ifdef __linux__
+      if (fd < 0) { return 0; }
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &count, sizeof(count)) != sizeof(count)) { count = 0; }
+#endif
+      return count;
+   }
+};
+
+static HostMemoryPolicy GetPolicy(int p)
+{
+   HostMemoryPolicy policy;
+   if (p >= 1) { policy.huge_page_threshold = std::size_t(1) << 21; }
+   if (p >= 2) { policy.numa = HostMemoryPolicy::NUMA::INTERLEAVE; }
+   return policy;
+}
+
+static void PADiffusion(bm::State &state)
+{
+   const int policy = state.range(0);
+   const int p = state.range(1);
+   const HostMemoryPolicy default_policy = MemoryManager::GetHostMemoryPolicy();
+   MemoryManager::SetHostMemoryPolicy(GetPolicy(policy));
+   {
+      // About 2M dofs, so that the quadrature data is much larger than the
+      // caches and spans many pages.
+      const int N = std::max(2, int(std::cbrt(2e6)/p));
+      Mesh mesh = Mesh::MakeCartesian3D(N, N, N, Element::HEXAHEDRON);
+      H1_FECollection fec(p, 3);
+      FiniteElementSpace fes(&mesh, &fec);
+      BilinearForm a(&fes);
+      a.AddDomainIntegrator(new DiffusionIntegrator);
+      a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      a.Assemble();
+      Vector x(fes.GetVSize()), y(fes.GetVSize());
+      x.Randomize(1);
+
+      TLBMissCounter tlb;
+      long long misses = 0;
+      for (auto _ : state)
+      {
+         tlb.Start();
+         a.Mult(x, y);
+         MFEM_DEVICE_SYNC;
+         misses += tlb.Stop();
+      }
+      state.counters["MDof/s"] =
+         bm::Counter(1e-6*fes.GetVSize(), bm::Counter::kIsIterationInvariantRate);
+      if (tlb.IsAvailable())
+      {
+         state.counters["dTLB-misses"] =
+            bm::Counter(double(misses), bm::Counter::kAvgIterations);
+      }
+   }
+   MemoryManager::SetHostMemoryPolicy(default_policy);
+}
+BENCHMARK(PADiffusion)->ArgsProduct({{0, 1, 2}, {1, 2, 4, 6}})
+->Unit(bm::kMillisecond);
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=PADiffusion/1/4
+ * --benchmark_context=device=cpu
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   // Device setup, cpu by default
+   std::string device_config = "cpu";
+   if (bmi::global_context != nullptr)
+   {
+      const auto device = bmi::global_context->find("device");
+      if (device != bmi::global_context->end())
+      {
+         mfem::out << device->first << " : " << device->second << std::endl;
+         device_config = device->second;
+      }
+   }
+   // The policy applies to the aligned host memory types.
+   Device::SetMemoryTypes(MemoryType::HOST_64, MemoryType::DEVICE);
+   Device device(device_config.c_str());
+   device.Print();
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
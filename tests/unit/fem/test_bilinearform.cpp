@@ -142,3 +142,48 @@ TEST_CASE("FormLinearSystem/SolutionScope",
       REQUIRE(AsConst(sol)(bdr_dof) == 0.0);
    }
 }
+
+TEST_CASE("BilinearForm batched element matrices", "[BilinearForm]")
+{
+   // ComputeElementMatrices() uses the batched element matrices of the
+   // integrators; DiffusionIntegrator and MassIntegrator have batched kernels,
+   // ConvectionIntegrator uses the default element-by-element implementation.
+   const auto type = GENERATE(Element::TRIANGLE, Element::QUADRILATERAL,
+                              Element::TETRAHEDRON, Element::HEXAHEDRON);
+   const int order = GENERATE(1, 3);
+   CAPTURE(type, order);
+
+   const bool is_3d = (type == Element::TETRAHEDRON ||
+                       type == Element::HEXAHEDRON);
+   Mesh mesh = is_3d ? Mesh::MakeCartesian3D(3, 3, 3, type) :
+               Mesh::MakeCartesian2D(5, 5, type);
+   mesh.SetCurvature(2);
+   Vector &nodes = *mesh.GetNodes();
+   for (int i = 0; i < nodes.Size(); i++) { nodes(i) += 0.01*sin(10.0*i); }
+   const int dim = mesh.Dimension();
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   FunctionCoefficient q([](const Vector &x) { return 1.0 + x(0)*x(1); });
+   Vector v(dim);
+   v = 1.0;
+   VectorConstantCoefficient vq(v);
+
+   BilinearForm a_batched(&fes), a(&fes);
+   for (BilinearForm *form : {&a_batched, &a})
+   {
+      form->AddDomainIntegrator(new DiffusionIntegrator(q));
+      form->AddDomainIntegrator(new MassIntegrator(q));
+      form->AddDomainIntegrator(new ConvectionIntegrator(vq));
+   }
+   a_batched.ComputeElementMatrices();
+   a_batched.Assemble();
+   a_batched.Finalize();
+   a.Assemble();
+   a.Finalize();
+
+   SparseMatrix diff(a_batched.SpMat());
+   diff.Add(-1.0, a.SpMat());
+   REQUIRE(diff.MaxNorm() == MFEM_Approx(0.0, 1e-12*a.SpMat().MaxNorm()));
+}
@@ -14,6 +14,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 using namespace mfem;
 
@@ -827,6 +828,47 @@ TEST_CASE("Parallel PA DG Diffusion", "[PartialAssembly][Parallel][CUDA]")
    test_dg_diffusion(fes);
 }
 
+TEST_CASE("Split Face-Neighbor Exchange", "[ParGridFunction][Parallel]")
+{
+   Mesh serial_mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+
+   DG_FECollection fec(2, 2);
+   ParFiniteElementSpace fes(&mesh, &fec);
+   ParGridFunction x(&fes), x_split(&fes);
+   x.Randomize(1);
+   x_split = x;
+
+   x.ExchangeFaceNbrData();
+   x_split.ExchangeFaceNbrDataBegin();
+   x_split.ExchangeFaceNbrDataEnd();
+   // A second call to End() does nothing
+   x_split.ExchangeFaceNbrDataEnd();
+
+   Vector &nbr = x.FaceNbrData(), &nbr_split = x_split.FaceNbrData();
+   REQUIRE(nbr_split.Size() == nbr.Size());
+   nbr_split -= nbr;
+   REQUIRE(nbr_split.Normlinf() == 0.0);
+
+   // Destroying the ParGridFunction, or making it reference other data,
+   // completes a pending exchange
+   {
+      ParGridFunction x_tmp(&fes);
+      x_tmp = x;
+      x_tmp.ExchangeFaceNbrDataBegin();
+   }
+   x_split.ExchangeFaceNbrDataBegin();
+   x_split.MakeRef(&fes, x, 0);
+   x_split.ExchangeFaceNbrDataBegin();
+   x_split.ExchangeFaceNbrDataEnd();
+
+   Vector &nbr_ref = x_split.FaceNbrData();
+   REQUIRE(nbr_ref.Size() == nbr.Size());
+   nbr_ref -= nbr;
+   REQUIRE(nbr_ref.Normlinf() == 0.0);
+}
+
 #endif
 
 } // namespace pa_kernels
@@ -860,3 +902,41 @@ TEST_CASE("Dispatch Map Specializations")
    REQUIRE_FALSE(QI::EvalKernels::GetDispatchTable().empty());
    REQUIRE_FALSE(QI::CollocatedGradKernels::GetDispatchTable().empty());
 }
+
+TEST_CASE("Kernel Profiler")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator);
+   a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a.Assemble();
+
+   Vector x(fes.GetTrueVSize()), y(fes.GetTrueVSize());
+   x.Randomize(1);
+
+   const bool enabled = KernelProfiler::IsEnabled();
+   KernelProfiler::Clear();
+   KernelProfiler::Enable();
+   for (int i = 0; i < 3; i++) { a.Mult(x, y); }
+   if (!enabled) { KernelProfiler::Disable(); }
+
+   std::stringstream json, csv;
+   KernelProfiler::Print(json, KernelProfiler::Format::JSON);
+   KernelProfiler::Print(csv, KernelProfiler::Format::CSV);
+   KernelProfiler::Clear();
+
+   // Dispatch parameters of the 2D diffusion kernel: dim, D1D, Q1D
+   REQUIRE(json.str().find("ApplyPAKernels") != std::string::npos);
+   REQUIRE(json.str().find("\"params\": [2,3,") != std::string::npos);
+   REQUIRE(json.str().find("\"calls\": 3") != std::string::npos);
+
+   std::string header;
+   std::getline(csv, header);
+   REQUIRE(header.find("kernel,params,fallback,calls") == 0);
+   std::string line;
+   REQUIRE(std::getline(csv, line));
+   REQUIRE(line.find("ApplyPAKernels") != std::string::npos);
+}
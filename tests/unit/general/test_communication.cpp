@@ -0,0 +1,132 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("GroupCommunicator modes", "[GroupCommunicator][Parallel]")
+{
+   const int my_rank = Mpi::WorldRank();
+   const int dim = GENERATE(2, 3);
+   CAPTURE(dim);
+
+   Mesh mesh = dim == 2 ?
+               Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   H1_FECollection fec(2, dim);
+   ParFiniteElementSpace pfes(&pmesh, &fec);
+   const GroupCommunicator &gc_ref = pfes.GroupComm();
+   const int n = pfes.GetVSize();
+
+   for (auto mode : {GroupCommunicator::byGroup,
+                     GroupCommunicator::byNeighborCollective})
+   {
+      CAPTURE(int(mode));
+      GroupCommunicator gc(pmesh.gtopo, mode);
+      gc.GroupLDofTable() = gc_ref.GroupLDofTable();
+      gc.Finalize();
+
+      Array<real_t> x(n), x_ref(n);
+      for (int i = 0; i < n; i++) { x[i] = x_ref[i] = 1000*my_rank + i; }
+
+      gc_ref.Bcast(x_ref);
+      gc.Bcast(x);
+      for (int i = 0; i < n; i++) { REQUIRE(x[i] == x_ref[i]); }
+
+      for (int i = 0; i < n; i++) { x[i] = x_ref[i] = 1000*my_rank + i; }
+      gc_ref.Reduce<real_t>(x_ref, GroupCommunicator::Sum);
+      gc.ReduceBegin(x.GetData());
+      gc.ReduceEnd(x.GetData(), 0, GroupCommunicator::Sum<real_t>);
+      for (int i = 0; i < n; i++) { REQUIRE(x[i] == x_ref[i]); }
+
+      Array<int> m(n), m_ref(n);
+      for (int i = 0; i < n; i++) { m[i] = m_ref[i] = my_rank; }
+      gc_ref.Reduce<int>(m_ref, GroupCommunicator::Max);
+      gc.Reduce<int>(m, GroupCommunicator::Max);
+      for (int i = 0; i < n; i++) { REQUIRE(m[i] == m_ref[i]); }
+   }
+}
+
+TEST_CASE("GroupCommunicator without shared data",
+          "[GroupCommunicator][Parallel]")
+{
+   // Ranks 0 and 1 share two dofs, ranks 1 and 2 share a group without dofs,
+   // and the other ranks share nothing. So the ranks >= 2 have no data to
+   // exchange, but they still take part in the neighborhood collectives.
+   const int my_rank = Mpi::WorldRank();
+   const int num_ranks = Mpi::WorldSize();
+
+   ListOfIntegerSets groups;
+   IntegerSet group;
+   const int me[1] = {my_rank}, g01[2] = {0, 1}, g12[2] = {1, 2};
+   group.Recreate(1, me);
+   groups.Insert(group);
+   if (my_rank <= 1 && num_ranks > 1)
+   {
+      group.Recreate(2, g01);
+      groups.Insert(group);
+   }
+   if ((my_rank == 1 && num_ranks > 2) || my_rank == 2)
+   {
+      group.Recreate(2, g12);
+      groups.Insert(group);
+   }
+   GroupTopology gtopo(MPI_COMM_WORLD);
+   gtopo.Create(groups, 822);
+
+   // The ldofs 1 and 2 of the ranks 0 and 1 are in the group {0, 1}
+   const bool shares = (my_rank <= 1 && num_ranks > 1);
+   const int n = shares ? 3 : 1;
+   Array<int> ldof_group(n);
+   ldof_group = 0;
+   for (int gr = 1; shares && gr < gtopo.NGroups(); gr++)
+   {
+      if (gtopo.GetGroupSize(gr) == 2 &&
+          gtopo.GetNeighborRank(gtopo.GetGroup(gr)[0]) +
+          gtopo.GetNeighborRank(gtopo.GetGroup(gr)[1]) == 1)
+      {
+         ldof_group[1] = ldof_group[2] = gr;
+      }
+   }
+
+   for (auto mode : {GroupCommunicator::byGroup,
+                     GroupCommunicator::byNeighbor,
+                     GroupCommunicator::byNeighborCollective})
+   {
+      CAPTURE(int(mode));
+      GroupCommunicator gc(gtopo, mode);
+      gc.Create(ldof_group);
+
+      // Repeat, so that mismatched collectives would hang or mix the data
+      for (int it = 0; it < 3; it++)
+      {
+         Array<real_t> x(n);
+         for (int i = 0; i < n; i++) { x[i] = 100*my_rank + i + it; }
+         gc.Bcast(x);
+         // The master of the group {0, 1} is rank 0
+         for (int i = 1; i < n; i++) { REQUIRE(x[i] == i + it); }
+
+         for (int i = 0; i < n; i++) { x[i] = 100*my_rank + i; }
+         gc.Reduce<real_t>(x, GroupCommunicator::Sum);
+         if (my_rank == 0)
+         {
+            for (int i = 1; i < n; i++) { REQUIRE(x[i] == 100 + 2*i); }
+         }
+      }
+   }
+}
+
+#endif // MFEM_USE_MPI
@@ -0,0 +1,138 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <map>
+#include <utility>
+
+using namespace mfem;
+
+namespace
+{
+struct Item2 : public Hashed2 { int value; };
+struct Item4 : public Hashed4 { int value; };
+}
+
+TEST_CASE("HashTable", "[General]")
+{
+   SECTION("Hashed2 against std::map")
+   {
+      // Small initial table, to exercise rehashing
+      HashTable<Item2> table(64, 16);
+      std::map<std::pair<int, int>, int> ref;
+      // Unsigned arithmetic: the overflow of a signed seed is undefined
+      unsigned seed = 1;
+      auto rand = [&seed]()
+      {
+         seed = (seed*1103515245u + 12345u) & 0x7fffffffu;
+         return int(seed >> 8);
+      };
+      for (int it = 0; it < 50000; it++)
+      {
+         const int p1 = rand() % 300, p2 = rand() % 300;
+         const std::pair<int, int> key(std::min(p1, p2), std::max(p1, p2));
+         const auto found = ref.find(key);
+         const int op = rand() % 4;
+         if (op < 2)
+         {
+            const int id = table.GetId(p1, p2);
+            if (found == ref.end()) { ref[key] = id; }
+            else { REQUIRE(found->second == id); }
+         }
+         else if (op == 2)
+         {
+            REQUIRE(table.FindId(p2, p1) ==
+                    (found == ref.end() ? -1 : found->second));
+         }
+         else if (found != ref.end())
+         {
+            table.Delete(found->second);
+            ref.erase(found);
+         }
+         REQUIRE(table.Size() == int(ref.size()));
+      }
+
+      table.Compact();
+      Array<int> keys, ids;
+      for (const auto &kv : ref)
+      {
+         keys.Append(kv.first.second);
+         keys.Append(kv.first.first);
+      }
+      keys.Append(-2);
+      keys.Append(-3);
+      table.FindIds(keys, ids);
+      REQUIRE(ids.Size() == int(ref.size()) + 1);
+      int k = 0;
+      for (const auto &kv : ref)
+      {
+         REQUIRE(ids[k] == kv.second);
+         REQUIRE(table.IdExists(ids[k]));
+         k++;
+      }
+      REQUIRE(ids[k] == -1);
+
+      // Reparent all items
+      for (const auto &kv : ref)
+      {
+         table.Reparent(kv.second, kv.first.first + 1000,
+                        kv.first.second + 1000);
+      }
+      for (const auto &kv : ref)
+      {
+         REQUIRE(table.FindId(kv.first.first, kv.first.second) == -1);
+         REQUIRE(table.FindId(kv.first.first + 1000, kv.first.second + 1000) ==
+                 kv.second);
+      }
+   }
+
+   SECTION("Hashed4 bulk operations")
+   {
+      HashTable<Item4> table;
+      const int n = 1000;
+      Array<int> keys;
+      for (int i = 0; i < n; i++)
+      {
+         const int key[4] = {i+2, i, i+1, (i % 2) ? -1 : i+3};
+         keys.Append(key, 4);
+      }
+      Array<int> ids, found;
+      table.GetIds(keys, ids);
+      REQUIRE(table.Size() == n);
+      for (int i = 0; i < n; i++)
+      {
+         REQUIRE(table.FindId(i, i+1, i+2, (i % 2) ? -1 : i+3) == ids[i]);
+      }
+      table.FindIds(keys, found);
+      for (int i = 0; i < n; i++) { REQUIRE(found[i] == ids[i]); }
+
+      // Getting the existing items does not create new ones
+      table.GetIds(keys, found);
+      REQUIRE(table.Size() == n);
+      for (int i = 0; i < n; i++) { REQUIRE(found[i] == ids[i]); }
+
+      for (int i = 0; i < n; i += 2) { table.Delete(ids[i]); }
+      table.Compact();
+      REQUIRE(table.Size() == n/2);
+      table.FindIds(keys, found);
+      for (int i = 0; i < n; i++)
+      {
+         REQUIRE(found[i] == ((i % 2) ? ids[i] : -1));
+      }
+
+      HashTable<Item4> copy(table);
+      table.DeleteAll();
+      REQUIRE(table.FindId(1, 2, 3) == -1);
+      REQUIRE(copy.FindId(1, 2, 3) == ids[1]);
+   }
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "unit_tests.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+TEST_CASE("JitCompiler", "[General]")
+{
+   const bool was_enabled = JitCompiler::IsEnabled();
+   JitCompiler::Enable();
+   if (!JitCompiler::IsEnabled()) { return; } // not supported
+   if (!JitCompiler::IsCompilerAvailable())
+   {
+      WARN("Skipping the JitCompiler test: no compiler found");
+      JitCompiler::Enable(was_enabled);
+      return;
+   }
+
+#if defined(__unix__) || defined(__APPLE__)
+   // Use an empty cache directory, so that the source is compiled, and do not
+   // leave files behind.
+   const char *tmpdir = std::getenv("TMPDIR");
+   std::string cache = std::string((tmpdir && *tmpdir) ? tmpdir : "/tmp") +
+                       "/mfem_jit_XXXXXX";
+   REQUIRE(mkdtemp(&cache[0]) != nullptr);
+   JitCompiler::SetCacheDirectory(cache);
+#endif
+
+   const std::string source =
+      "#include \"config/config.hpp\"\n"
+      "extern \"C\" int mfem_jit_test(int n) { return MFEM_VERSION + n; }\n";
+   using Function = int (*)(int);
+   Function f = reinterpret_cast<Function>(
+                   JitCompiler::Lookup(source, "mfem_jit_test"));
+   REQUIRE(f != nullptr);
+   REQUIRE(f(7) == MFEM_VERSION + 7);
+   // The second lookup does not compile the source again.
+   REQUIRE(JitCompiler::Lookup(source, "mfem_jit_test") == (void*) f);
+
+   REQUIRE(JitCompiler::Lookup(source, "mfem_jit_missing") == nullptr);
+   REQUIRE(JitCompiler::Lookup("#error \"invalid\"\n", "f") == nullptr);
+
+#if defined(__unix__) || defined(__APPLE__)
+   // Only the shared object of the valid source and its list of included
+   // headers remain in the cache: the temporary sources and logs were removed.
+   int num_so = 0, num_deps = 0;
+   DIR *dir = opendir(cache.c_str());
+   REQUIRE(dir != nullptr);
+   while (dirent *entry = readdir(dir))
+   {
+      const std::string name = entry->d_name;
+      if (name == "." || name == "..") { continue; }
+      REQUIRE(name.size() > 3);
+      const std::string ext = name.substr(name.find('.'));
+      CHECK((ext == ".so" || ext == ".so.d"));
+      num_so += (ext == ".so");
+      num_deps += (ext == ".so.d");
+      std::remove((cache + "/" + name).c_str());
+   }
+   closedir(dir);
+   rmdir(cache.c_str());
+   CHECK(num_so == 1);
+   CHECK(num_deps == 1);
+   JitCompiler::SetCacheDirectory("");
+#endif
+
+   JitCompiler::Enable(was_enabled);
+}
+
+TEST_CASE("JitCompiler/KernelDispatch", "[General]")
+{
+   const bool was_enabled = JitCompiler::IsEnabled();
+   JitCompiler::Enable();
+   if (!JitCompiler::IsEnabled()) { return; } // not supported
+   if (!JitCompiler::IsCompilerAvailable())
+   {
+      WARN("Skipping the JitCompiler test: no compiler found");
+      JitCompiler::Enable(was_enabled);
+      return;
+   }
+
+#if defined(__unix__) || defined(__APPLE__)
+   const char *tmpdir = std::getenv("TMPDIR");
+   std::string cache = std::string((tmpdir && *tmpdir) ? tmpdir : "/tmp") +
+                       "/mfem_jit_XXXXXX";
+   REQUIRE(mkdtemp(&cache[0]) != nullptr);
+   JitCompiler::SetCacheDirectory(cache);
+#endif
+
+   // The 2D mass kernel with 3 dofs and 4 quadrature points in each direction
+   // is not among the registered specializations.
+   const int dim = 2, order = 2, q1d = 4;
+   const auto key = std::make_tuple(dim, order + 1, q1d);
+   using Kernels = MassIntegrator::ApplyPAKernels;
+
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   const IntegrationRule &ir = IntRules.Get(Geometry::SQUARE, 2*q1d - 1);
+
+   BilinearForm a_pa(&fes), a_fa(&fes);
+   a_pa.AddDomainIntegrator(new MassIntegrator(&ir));
+   a_fa.AddDomainIntegrator(new MassIntegrator(&ir));
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_pa.Assemble();
+   a_fa.Assemble();
+   a_fa.Finalize();
+
+   Vector x(fes.GetVSize()), y_pa(x.Size()), y_fa(x.Size());
+   x.Randomize(1);
+   a_pa.Mult(x, y_pa);
+   a_fa.SpMat().Mult(x, y_fa);
+
+   // The specialization was compiled, registered and used.
+   REQUIRE(Kernels::GetDispatchTable().count(key) == 1);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+
+#if defined(__unix__) || defined(__APPLE__)
+   DIR *dir = opendir(cache.c_str());
+   REQUIRE(dir != nullptr);
+   while (dirent *entry = readdir(dir))
+   {
+      const std::string name = entry->d_name;
+      if (name == "." || name == "..") { continue; }
+      std::remove((cache + "/" + name).c_str());
+   }
+   closedir(dir);
+   rmdir(cache.c_str());
+   JitCompiler::SetCacheDirectory("");
+#endif
+
+   JitCompiler::Enable(was_enabled);
+}
@@ -12,6 +12,11 @@
 #include "mfem.hpp"
 #include "unit_tests.hpp"
 
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
 using namespace mfem;
 
 TEST_CASE("MemoryManager/Scopes",
@@ -67,3 +72,100 @@ TEST_CASE("MemoryManager/Scopes",
       REQUIRE((x_data == x.HostRead()));
    }
 }
+
+TEST_CASE("MemoryManager/Registry", "[MemoryManager]")
+{
+   const int n = 1000, nv = 64;
+   std::vector<Vector*> vecs(nv);
+   std::vector<Vector> refs(nv*n/10);
+   mm.Reserve(nv, refs.size());
+   for (int v = 0; v < nv; v++)
+   {
+      vecs[v] = new Vector(n, MemoryType::HOST_64);
+      REQUIRE(mm.IsKnown(vecs[v]->GetData()));
+      for (int i = 1; i < n/10; i++)
+      {
+         Vector &ref = refs[v*n/10 + i];
+         ref.MakeRef(*vecs[v], 10*i, 10);
+         REQUIRE(mm.IsAlias(ref.GetData()));
+      }
+   }
+   std::ostringstream os;
+   mm.PrintStats(os);
+   REQUIRE(os.str().find("registered aliases") != std::string::npos);
+
+   // Remove the vectors in an order different from the registration
+   for (int v = 0; v < nv; v += 2)
+   {
+      for (int i = 1; i < n/10; i++) { refs[v*n/10 + i].Destroy(); }
+      const real_t *data = vecs[v]->GetData();
+      delete vecs[v];
+      REQUIRE(!mm.IsKnown(data));
+   }
+   for (int v = 1; v < nv; v += 2)
+   {
+      REQUIRE(mm.IsKnown(vecs[v]->GetData()));
+      for (int i = 1; i < n/10; i++)
+      {
+         REQUIRE(mm.IsAlias(refs[v*n/10 + i].GetData()));
+         refs[v*n/10 + i].Destroy();
+      }
+      delete vecs[v];
+   }
+}
+
+TEST_CASE("MemoryManager/HostPool", "[MemoryManager]")
+{
+   const HostPoolStats start = MemoryManager::GetHostPoolStats();
+   {
+      // Temporaries of varying sizes, as in a time-stepping loop
+      for (int step = 0; step < 10; step++)
+      {
+         for (int n : {1, 100, 1000, 12345})
+         {
+            Vector x(n, MemoryType::HOST_POOL);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(x.GetData()) % 64 == 0);
+            x = 1.0;
+            REQUIRE(x.Sum() == n);
+         }
+      }
+      const HostPoolStats stats = MemoryManager::GetHostPoolStats();
+      REQUIRE(stats.num_allocs - start.num_allocs == 40);
+      REQUIRE(stats.num_reused - start.num_reused >= 36);
+      REQUIRE(stats.bytes_in_use == start.bytes_in_use);
+      REQUIRE(stats.max_bytes_in_use >= 12345*sizeof(real_t));
+      REQUIRE(stats.bytes_reserved >= stats.bytes_in_use);
+   }
+   // Blocks cached by the (still running) threads of the pool; the memory
+   // manager registry itself is not thread-safe.
+   std::mutex mtx;
+   ThreadPool::Global().ParallelFor(64, [&](int i)
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      Memory<real_t> m(1000 + i, MemoryType::HOST_POOL);
+      m[0] = 1.0;
+      m.Delete();
+   });
+   MemoryManager::ReleaseHostPool();
+   const HostPoolStats stats = MemoryManager::GetHostPoolStats();
+   REQUIRE(stats.bytes_reserved == stats.bytes_in_use);
+}
+
+TEST_CASE("MemoryManager/HostMemoryPolicy", "[MemoryManager]")
+{
+   const HostMemoryPolicy default_policy = MemoryManager::GetHostMemoryPolicy();
+   HostMemoryPolicy policy;
+   policy.huge_page_threshold = 1 << 20;
+   policy.numa = HostMemoryPolicy::NUMA::INTERLEAVE;
+   MemoryManager::SetHostMemoryPolicy(policy);
+   {
+      const int n = (1 << 20)/sizeof(real_t) + 1;
+      Vector x(n, MemoryType::HOST_64), y(10, MemoryType::HOST_64);
+      const std::uintptr_t huge_page = 1 << 21;
+      REQUIRE(reinterpret_cast<std::uintptr_t>(x.GetData()) % huge_page == 0);
+      REQUIRE(reinterpret_cast<std::uintptr_t>(y.GetData()) % 64 == 0);
+      x = 1.0;
+      REQUIRE(x.Sum() == n);
+   }
+   MemoryManager::SetHostMemoryPolicy(default_policy);
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace mfem;
+
+namespace
+{
+// Pseudo-random integers in [lo, hi)
+struct RandomInts
+{
+   unsigned long long state = 12345;
+   long long operator()(long long lo, long long hi)
+   {
+      state = state*6364136223846793005ull + 1442695040888963407ull;
+      return lo + (long long)((state >> 33) % (unsigned long long)(hi - lo));
+   }
+};
+
+typedef Pair<long long, int> LPair;
+
+bool SamePairs(const std::vector<LPair> &a, const std::vector<LPair> &b)
+{
+   if (a.size() != b.size()) { return false; }
+   for (size_t i = 0; i < a.size(); i++)
+   {
+      if (a[i].one != b[i].one || a[i].two != b[i].two) { return false; }
+   }
+   return true;
+}
+}
+
+TEST_CASE("SortPairs", "[General]")
+{
+   RandomInts rand;
+   const auto less_one = [](const LPair &p, const LPair &q)
+   { return p.one < q.one; };
+
+   for (int n : {0, 1, 10, 300, 5000, 100000})
+   {
+      for (long long range : {1ll, 100ll, 1ll << 20, 1ll << 40})
+      {
+         std::vector<LPair> pairs(n);
+         for (int i = 0; i < n; i++)
+         {
+            pairs[i] = LPair(rand(-range, range), i);
+         }
+         std::vector<LPair> ref(pairs);
+         std::stable_sort(ref.begin(), ref.end(), less_one);
+
+         SortPairs(pairs.data(), n);
+         REQUIRE(SamePairs(pairs, ref));
+
+         // Nearly sorted input
+         for (int k = 0; k + 1 < n; k += 97)
+         {
+            std::swap(pairs[k], pairs[k+1]);
+         }
+         ref = pairs;
+         std::stable_sort(ref.begin(), ref.end(), less_one);
+         SortPairs(pairs.data(), n);
+         REQUIRE(SamePairs(pairs, ref));
+      }
+   }
+
+   SECTION("Triples")
+   {
+      const int n = 20000;
+      std::vector<Triple<int, int, int>> t(n);
+      for (int i = 0; i < n; i++)
+      {
+         t[i] = Triple<int, int, int>(int(rand(-5, 5)), int(rand(0, 1000)),
+                                      int(rand(-100000, 100000)));
+      }
+      std::vector<Triple<int, int, int>> ref(t);
+      std::sort(ref.begin(), ref.end());
+      SortTriple(t.data(), n);
+      for (int i = 0; i < n; i++)
+      {
+         REQUIRE(t[i].one == ref[i].one);
+         REQUIRE(t[i].two == ref[i].two);
+         REQUIRE(t[i].three == ref[i].three);
+      }
+   }
+
+   SECTION("Threads")
+   {
+      const int nt = GENERATE(2, 3);
+      ThreadPool pool(nt);
+      const int n = 100000;
+      std::vector<LPair> pairs(n);
+      for (int i = 0; i < n; i++) { pairs[i] = LPair(rand(0, 1 << 30), i); }
+      std::vector<LPair> ref(pairs), buf;
+      std::stable_sort(ref.begin(), ref.end(), less_one);
+      internal::RadixSortKeys(pairs.data(), n, buf, &pool,
+                              [](const LPair &p) { return p.one; });
+      REQUIRE(SamePairs(pairs, ref));
+   }
+}
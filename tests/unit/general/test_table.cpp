@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+static bool SameTables(const Table &A, const Table &B)
+{
+   if (A.Size() != B.Size() || A.Size_of_connections() !=
+       B.Size_of_connections()) { return false; }
+   for (int i = 0; i <= A.Size(); i++)
+   {
+      if (A.GetI()[i] != B.GetI()[i]) { return false; }
+   }
+   for (int k = 0; k < A.Size_of_connections(); k++)
+   {
+      if (A.GetJ()[k] != B.GetJ()[k]) { return false; }
+   }
+   return true;
+}
+
+TEST_CASE("Table/Threads", "[General]")
+{
+   const int nt = GENERATE(1, 2, 5);
+   ThreadPool pool(nt);
+
+   Mesh mesh = Mesh::MakeCartesian3D(8, 7, 6, Element::HEXAHEDRON);
+   Table elem_vert(mesh.GetNE(), 8);
+   Array<int> v;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      mesh.GetElementVertices(e, v);
+      for (int k = 0; k < 8; k++) { elem_vert.GetRow(e)[k] = v[k]; }
+   }
+
+   Table vert_elem, vert_elem_t;
+   Transpose(elem_vert, vert_elem);
+   Transpose(elem_vert, vert_elem_t, pool);
+   REQUIRE(SameTables(vert_elem, vert_elem_t));
+   REQUIRE(vert_elem_t.Size() == mesh.GetNV());
+
+   // Extra empty columns
+   Transpose(elem_vert, vert_elem, mesh.GetNV() + 3);
+   Transpose(elem_vert, vert_elem_t, pool, mesh.GetNV() + 3);
+   REQUIRE(SameTables(vert_elem, vert_elem_t));
+
+   Table elem_elem, elem_elem_t;
+   Mult(elem_vert, vert_elem, elem_elem);
+   Mult(elem_vert, vert_elem, elem_elem_t, pool);
+   REQUIRE(SameTables(elem_elem, elem_elem_t));
+   // The interior elements have 26 neighbors, plus themselves. The elements
+   // are not numbered lexicographically (space-filling curve ordering).
+   int max_row_size = 0;
+   for (int e = 0; e < elem_elem_t.Size(); e++)
+   {
+      max_row_size = std::max(max_row_size, elem_elem_t.RowSize(e));
+   }
+   REQUIRE(max_row_size == 27);
+}
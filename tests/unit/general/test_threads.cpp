@@ -0,0 +1,90 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "unit_tests.hpp"
+
+TEST_CASE("ThreadPool", "[General]")
+{
+   const int nt = GENERATE(1, 2, 4, 7);
+   ThreadPool pool(nt);
+   REQUIRE(pool.NumThreads() == nt);
+
+   SECTION("Each index is visited once")
+   {
+      for (int N : {0, 1, 3, 100, 12345})
+      {
+         Array<int> count(N);
+         count = 0;
+         int *c = count.GetData();
+         pool.ParallelFor(N, [=](int i) { c[i]++; });
+         for (int i = 0; i < N; i++) { REQUIRE(count[i] == 1); }
+      }
+   }
+
+   SECTION("Unbalanced loop")
+   {
+      // Most of the work is in the first few iterations, so that the other
+      // threads have to steal it.
+      const int N = 1000;
+      Vector x(N);
+      real_t *X = x.GetData();
+      pool.ParallelFor(N, [=](int i)
+      {
+         const int n = (i < 10) ? 100000 : 10;
+         real_t s = 0.0;
+         for (int k = 1; k <= n; k++) { s += 1.0/k; }
+         X[i] = s;
+      });
+      for (int i = 0; i < N; i++)
+      {
+         const int n = (i < 10) ? 100000 : 10;
+         real_t s = 0.0;
+         for (int k = 1; k <= n; k++) { s += 1.0/k; }
+         REQUIRE(x(i) == s);
+      }
+   }
+
+   SECTION("Nested loops run sequentially")
+   {
+      const int N = 64, M = 16;
+      Array<int> count(N*M), in_par(N);
+      count = 0;
+      int *c = count.GetData(), *ip = in_par.GetData();
+      ThreadPool *p = &pool;
+      pool.ParallelFor(N, [=](int i)
+      {
+         ip[i] = ThreadPool::InParallel();
+         p->ParallelFor(M, [=](int j) { c[i*M + j]++; });
+      });
+      REQUIRE(!ThreadPool::InParallel());
+      for (int i = 0; i < N; i++) { REQUIRE(in_par[i] == (nt > 1)); }
+      for (int i = 0; i < N*M; i++) { REQUIRE(count[i] == 1); }
+   }
+
+   SECTION("AtomicAdd")
+   {
+      const int N = 10000;
+      int isum = 0;
+      real_t rsum = 0.0;
+      int *is = &isum;
+      real_t *rs = &rsum;
+      pool.ParallelFor(N, [=](int i)
+      {
+         AtomicAdd(*is, 1);
+         AtomicAdd(*rs, real_t(1));
+      });
+      REQUIRE(isum == N);
+      REQUIRE(rsum == N);
+   }
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "unit_tests.hpp"
+
+#include <sstream>
+
+#ifndef MFEM_USE_CALIPER
+
+static int CountSubstr(const std::string &str, const std::string &sub)
+{
+   int count = 0;
+   for (size_t pos = str.find(sub); pos != std::string::npos;
+        pos = str.find(sub, pos + sub.size()))
+   {
+      count++;
+   }
+   return count;
+}
+
+TEST_CASE("TraceRecorder", "[General]")
+{
+   const bool was_enabled = TraceRecorder::IsEnabled();
+
+   TraceRecorder::Clear();
+   TraceRecorder::Disable();
+   {
+      MFEM_PERF_SCOPE("not recorded");
+   }
+   TraceRecorder::Enable("");
+   {
+      MFEM_PERF_SCOPE("scope");
+      MFEM_PERF_BEGIN("region");
+      MFEM_PERF_END("region");
+      const std::string name = std::string("dynamic") + "\"name";
+      MFEM_PERF_BEGIN(name);
+      MFEM_PERF_END(name);
+   }
+
+   std::ostringstream os;
+   TraceRecorder::Write(os);
+   const std::string trace = os.str();
+   REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+   REQUIRE(CountSubstr(trace, "not recorded") == 0);
+   REQUIRE(CountSubstr(trace, "\"scope\", \"ph\": \"X\"") == 1);
+   REQUIRE(CountSubstr(trace, "\"region\", \"ph\": \"B\"") == 1);
+   REQUIRE(CountSubstr(trace, "\"region\", \"ph\": \"E\"") == 1);
+   REQUIRE(CountSubstr(trace, "\"dynamic\\\"name\"") == 2);
+
+   TraceRecorder::Clear();
+   std::ostringstream empty;
+   TraceRecorder::Write(empty);
+   REQUIRE(CountSubstr(empty.str(), "\"name\"") == 0);
+
+   if (!was_enabled) { TraceRecorder::Disable(); }
+}
+
+#endif
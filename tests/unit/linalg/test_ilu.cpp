@@ -169,3 +169,75 @@ TEST_CASE("ILU Factorization", "[ILU]")
    REQUIRE(AB(0,1,6) == MFEM_Approx(-9.4));
    REQUIRE(AB(1,1,6) == MFEM_Approx(22552.0/245.0));
 }
+
+TEST_CASE("ILU Level Scheduling", "[ILU]")
+{
+   const int order = 2;
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   DG_FECollection fec(order, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   const int block_size = fec.GetFE(Geometry::SQUARE, order)->GetDof();
+
+   // Implicit time step of a DG advection problem
+   Vector v_dir(2);
+   v_dir(0) = 1.0;
+   v_dir(1) = 0.5;
+   VectorConstantCoefficient v(v_dir);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new MassIntegrator);
+   a.AddDomainIntegrator(new ConvectionIntegrator(v, 0.1));
+   a.AddInteriorFaceIntegrator(new DGTraceIntegrator(v, -0.1, 0.05));
+   a.Assemble();
+   a.Finalize();
+   SparseMatrix &A = a.SpMat();
+   const int n = A.Height();
+
+   const auto reordering = GENERATE(BlockILU::Reordering::NONE,
+                                    BlockILU::Reordering::MINIMUM_DISCARDED_FILL);
+   CAPTURE(int(reordering));
+
+   BlockILU ilu(A, block_size, reordering);
+   BlockILU ilu_levels(block_size, reordering);
+   ilu_levels.SetLevelScheduling();
+   ilu_levels.SetOperator(A);
+
+   int forward_levels, backward_levels;
+   ilu_levels.GetNumLevels(forward_levels, backward_levels);
+   REQUIRE(forward_levels > 1);
+   REQUIRE(forward_levels < n/block_size);
+   REQUIRE(backward_levels > 1);
+   REQUIRE(backward_levels < n/block_size);
+
+   SECTION("Same factorization and solution")
+   {
+      // The factors are only stored in level order
+      REQUIRE(ilu_levels.GetBlockData() == nullptr);
+
+      Vector b(n), x(n), x_levels(n);
+      b.Randomize(1);
+      ilu.Mult(b, x);
+      ilu_levels.Mult(b, x_levels);
+      x_levels -= x;
+      REQUIRE(x_levels.Normlinf() == 0.0);
+   }
+
+   SECTION("Reuse of the symbolic setup")
+   {
+      BlockILU ilu_reuse(block_size, reordering);
+      ilu_reuse.SetLevelScheduling();
+      ilu_reuse.SetReuseSymbolic();
+      ilu_reuse.SetOperator(A);
+
+      Vector b(n), x(n), x2(n);
+      b.Randomize(2);
+      ilu_reuse.Mult(b, x);
+
+      SparseMatrix A2(A);
+      A2 *= 2.0;
+      ilu_reuse.SetOperator(A2);
+      ilu_reuse.Mult(b, x2);
+      x2 *= 2.0;
+      x2 -= x;
+      REQUIRE(x2.Normlinf() == MFEM_Approx(0.0));
+   }
+}
@@ -0,0 +1,369 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <memory>
+
+using namespace mfem;
+
+namespace
+{
+
+// Solve with @a solver and return the relative difference with @a X_ref.
+real_t SolveAndCompare(IterativeSolver &solver, const Operator &A,
+                       Solver *prec, const Vector &B, const Vector &X_ref)
+{
+   solver.SetRelTol(1e-12);
+   solver.SetAbsTol(0.0);
+   solver.SetMaxIter(1000);
+   solver.SetPrintLevel(IterativeSolver::PrintLevel().Errors());
+   if (prec) { solver.SetPreconditioner(*prec); }
+   solver.SetOperator(A);
+   Vector X(B.Size());
+   X = 0.0;
+   solver.Mult(B, X);
+   REQUIRE(solver.GetConverged());
+   X -= X_ref;
+   return X.Normlinf()/X_ref.Normlinf();
+}
+
+// A solver with an overridden Dot(), counting its calls.
+template <typename SOLVER>
+class CountingDotSolver : public SOLVER
+{
+public:
+   mutable int num_dots = 0;
+
+   real_t Dot(const Vector &x, const Vector &y) const override
+   {
+      num_dots++;
+      return x*y;
+   }
+};
+
+} // namespace
+
+TEST_CASE("Pipelined and s-step Krylov solvers", "[Krylov]")
+{
+   const bool use_prec = GENERATE(false, true);
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+   GridFunction x(&fes);
+   x = 0.0;
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+   SparseMatrix A;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+   DSmoother jacobi(A);
+   Solver *prec = use_prec ? &jacobi : nullptr;
+
+   CGSolver cg;
+   cg.SetRelTol(1e-14);
+   cg.SetMaxIter(1000);
+   if (prec) { cg.SetPreconditioner(*prec); }
+   cg.SetOperator(A);
+   Vector X_ref(B.Size());
+   X_ref = 0.0;
+   cg.Mult(B, X_ref);
+   REQUIRE(cg.GetConverged());
+
+   SECTION("PipelinedCGSolver")
+   {
+      PipelinedCGSolver pcg;
+      REQUIRE(SolveAndCompare(pcg, A, prec, B, X_ref) < 1e-9);
+   }
+
+   SECTION("SStepCGSolver")
+   {
+      for (int s = 1; s <= 5; s++)
+      {
+         SStepCGSolver scg;
+         scg.SetNumSteps(s);
+         REQUIRE(SolveAndCompare(scg, A, prec, B, X_ref) < 1e-9);
+         REQUIRE(scg.GetNumIterations() % s == 0);
+      }
+   }
+
+   SECTION("GMRESSolver")
+   {
+      using Ortho = GMRESSolver::Orthogonalization;
+      for (int kdim : {30, 7}) // without and with restarts
+      {
+         for (Ortho ortho : {Ortho::MGS, Ortho::CGS, Ortho::CGS2, Ortho::DCGS2})
+         {
+            GMRESSolver gmres;
+            gmres.SetKDim(kdim);
+            gmres.SetOrthogonalization(ortho);
+            REQUIRE(SolveAndCompare(gmres, A, prec, B, X_ref) < 1e-9);
+         }
+      }
+   }
+
+   SECTION("Fused kernels")
+   {
+      CGSolver fcg;
+      fcg.SetFusedDot();
+      REQUIRE(SolveAndCompare(fcg, A, prec, B, X_ref) < 1e-9);
+
+      using Ortho = GMRESSolver::Orthogonalization;
+      for (Ortho ortho : {Ortho::MGS, Ortho::CGS, Ortho::CGS2, Ortho::DCGS2})
+      {
+         GMRESSolver gmres;
+         gmres.SetKDim(30);
+         gmres.SetOrthogonalization(ortho);
+         gmres.SetFusedDot();
+         REQUIRE(SolveAndCompare(gmres, A, prec, B, X_ref) < 1e-9);
+      }
+   }
+
+   SECTION("Overridden Dot()")
+   {
+      // Without SetFusedDot(), AddDot() and MDot() call the overridden Dot().
+      CountingDotSolver<CGSolver> ccg;
+      REQUIRE(SolveAndCompare(ccg, A, prec, B, X_ref) < 1e-9);
+      REQUIRE(ccg.num_dots >= 2*ccg.GetNumIterations());
+
+      using Ortho = GMRESSolver::Orthogonalization;
+      for (Ortho ortho : {Ortho::MGS, Ortho::CGS, Ortho::DCGS2})
+      {
+         CountingDotSolver<GMRESSolver> cgmres;
+         cgmres.SetKDim(30);
+         cgmres.SetOrthogonalization(ortho);
+         REQUIRE(SolveAndCompare(cgmres, A, prec, B, X_ref) < 1e-9);
+         // at least the inner products with the basis in each iteration
+         REQUIRE(cgmres.num_dots >= 2*cgmres.GetNumIterations());
+      }
+   }
+}
+
+TEST_CASE("Block CG solver", "[Krylov]")
+{
+   const bool use_prec = GENERATE(false, true);
+   const bool partial_assembly = GENERATE(false, true);
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+   GridFunction x(&fes);
+   x = 0.0;
+
+   BilinearForm a(&fes);
+   if (partial_assembly) { a.SetAssemblyLevel(AssemblyLevel::PARTIAL); }
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+   OperatorHandle A;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+   OperatorJacobiSmoother jacobi(a, ess_tdof_list);
+   Solver *prec = use_prec ? &jacobi : nullptr;
+
+   // Right-hand sides: B, random vectors vanishing on the boundary, and B
+   // again, which makes the search directions dependent.
+   const int nvec = 5;
+   MultiVector RHS(B.Size(), nvec), SOL(B.Size(), nvec);
+   for (int j = 0; j < nvec; j++)
+   {
+      Vector &rhs = RHS.GetColumn(j);
+      if (j == 0 || j == nvec - 1) { rhs = B; continue; }
+      rhs.Randomize(j);
+      rhs.SetSubVector(ess_tdof_list, 0.0);
+   }
+
+   BlockCGSolver bcg;
+   bcg.SetRelTol(1e-12);
+   bcg.SetAbsTol(0.0);
+   bcg.SetMaxIter(1000);
+   bcg.SetPrintLevel(IterativeSolver::PrintLevel().Errors());
+   if (prec) { bcg.SetPreconditioner(*prec); }
+   bcg.SetOperator(*A);
+   SOL = 0.0;
+   bcg.ArrayMult(RHS.GetConstColumns(), SOL.GetColumns());
+   REQUIRE(bcg.GetConverged());
+
+   CGSolver cg;
+   cg.SetRelTol(1e-14);
+   cg.SetMaxIter(1000);
+   if (prec) { cg.SetPreconditioner(*prec); }
+   cg.SetOperator(*A);
+   int max_cg_iter = 0;
+   for (int j = 0; j < nvec; j++)
+   {
+      Vector X_ref(B.Size());
+      X_ref = 0.0;
+      cg.Mult(RHS.GetColumn(j), X_ref);
+      REQUIRE(cg.GetConverged());
+      max_cg_iter = std::max(max_cg_iter, cg.GetNumIterations());
+      X_ref -= SOL.GetColumn(j);
+      REQUIRE(X_ref.Normlinf() < 1e-8*SOL.GetColumn(j).Normlinf());
+   }
+   // The block iteration stops when all the columns have converged, so it is
+   // compared with the slowest column
+   REQUIRE(bcg.GetNumIterations() <= max_cg_iter);
+}
+
+TEST_CASE("Mixed precision solver", "[Krylov]")
+{
+   const int dim = GENERATE(2, 3);
+   const bool partial_assembly = GENERATE(false, true);
+   CAPTURE(dim, partial_assembly);
+   Mesh mesh = dim == 2 ?
+               Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   // Coefficients that are not exact in single precision
+   ConstantCoefficient one_third(1.0/3.0), pi(M_PI);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(pi));
+   b.Assemble();
+   GridFunction x(&fes);
+   x = 0.0;
+
+   // The same operator with double and single precision data
+   BilinearForm a(&fes), a_single(&fes);
+   DiffusionIntegrator *diff_single = new DiffusionIntegrator(one_third);
+   MassIntegrator *mass_single = new MassIntegrator(pi);
+   diff_single->SetSinglePrecisionPA();
+   mass_single->SetSinglePrecisionPA();
+   a.AddDomainIntegrator(new DiffusionIntegrator(one_third));
+   a.AddDomainIntegrator(new MassIntegrator(pi));
+   a_single.AddDomainIntegrator(diff_single);
+   a_single.AddDomainIntegrator(mass_single);
+   if (partial_assembly)
+   {
+      a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      a_single.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   }
+   a.Assemble();
+   a_single.Assemble();
+
+   OperatorHandle A, A_single;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+   std::unique_ptr<SinglePrecisionSparseMatrix> A_sp;
+   if (partial_assembly)
+   {
+      a_single.FormSystemMatrix(ess_tdof_list, A_single);
+   }
+   else
+   {
+      A_sp.reset(new SinglePrecisionSparseMatrix(*A.As<SparseMatrix>()));
+      A_single.Reset(A_sp.get(), false);
+   }
+
+   // The single precision operator has a relative accuracy of about 1e-7.
+   Vector y(B.Size()), y_single(B.Size());
+   X.Randomize(1);
+   A->Mult(X, y);
+   A_single->Mult(X, y_single);
+   y_single -= y;
+   REQUIRE(y_single.Normlinf() > 0.0);
+   REQUIRE(y_single.Normlinf() < 1e-5*y.Normlinf());
+
+   CGSolver inner;
+   inner.SetRelTol(1e-2);
+   inner.SetMaxIter(100);
+   inner.SetOperator(*A_single);
+
+   MixedPrecisionSolver solver;
+   solver.SetRelTol(1e-12);
+   solver.SetAbsTol(0.0);
+   solver.SetMaxIter(20);
+   solver.SetOperator(*A);
+   solver.SetInnerSolver(inner);
+   X = 0.0;
+   solver.Mult(B, X);
+   REQUIRE(solver.GetConverged());
+
+   // The residual reaches double precision accuracy.
+   A->Mult(X, y);
+   y -= B;
+   REQUIRE(y.Norml2() <= 1e-12*B.Norml2());
+}
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("Parallel pipelined and s-step Krylov solvers",
+          "[Parallel], [Krylov]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   mesh.Clear();
+   H1_FECollection fec(2, 2);
+   ParFiniteElementSpace fes(&pmesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   ParLinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+   ParGridFunction x(&fes);
+   x = 0.0;
+
+   ParBilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+   HypreParMatrix A;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+   HypreSmoother jacobi(A, HypreSmoother::Jacobi);
+
+   CGSolver cg(MPI_COMM_WORLD);
+   cg.SetRelTol(1e-14);
+   cg.SetMaxIter(1000);
+   cg.SetPreconditioner(jacobi);
+   cg.SetOperator(A);
+   Vector X_ref(B.Size());
+   X_ref = 0.0;
+   cg.Mult(B, X_ref);
+   REQUIRE(cg.GetConverged());
+
+   auto check = [&](IterativeSolver &solver)
+   {
+      real_t err = SolveAndCompare(solver, A, &jacobi, B, X_ref);
+      MPI_Allreduce(MPI_IN_PLACE, &err, 1, MFEM_MPI_REAL_T, MPI_MAX,
+                    MPI_COMM_WORLD);
+      REQUIRE(err < 1e-9);
+   };
+
+   PipelinedCGSolver pcg(MPI_COMM_WORLD);
+   check(pcg);
+   SStepCGSolver scg(MPI_COMM_WORLD);
+   check(scg);
+   GMRESSolver gmres(MPI_COMM_WORLD);
+   gmres.SetOrthogonalization(GMRESSolver::Orthogonalization::CGS2);
+   check(gmres);
+}
+
+#endif // MFEM_USE_MPI
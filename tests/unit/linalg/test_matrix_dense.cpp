@@ -12,6 +12,7 @@
 #include "mfem.hpp"
 #include "unit_tests.hpp"
 #include "linalg/dtensor.hpp"
+#include "linalg/batched/cpu_simd.hpp"
 
 using namespace mfem;
 
@@ -363,7 +364,8 @@ TEST_CASE("Batched Linear Algebra",
 {
    auto backend = GENERATE(BatchedLinAlg::NATIVE,
                            BatchedLinAlg::GPU_BLAS,
-                           BatchedLinAlg::MAGMA);
+                           BatchedLinAlg::MAGMA,
+                           BatchedLinAlg::CPU_SIMD);
    // Skip unavailable backends
    if (!BatchedLinAlg::IsAvailable(backend)) { return; }
    CAPTURE(backend);
@@ -465,6 +467,92 @@ TEST_CASE("Batched Linear Algebra",
    }
 }
 
+TEST_CASE("Batched Linear Algebra CPU_SIMD", "[DenseMatrix]")
+{
+   // Sizes with the closed-form and the general kernels, a number of matrices
+   // that is not a multiple of the SIMD width, and matrices needing pivoting.
+   const int n = GENERATE(1, 3, 6);
+   const int n_mat = 3*DenseMatrixBatch::lanes + 1;
+   const int n_rhs = 2;
+   CAPTURE(n);
+
+   DenseTensor A(n, n, n_mat);
+   Vector a(A.Data(), n*n*n_mat);
+   a.Randomize(1);
+   for (int e = 0; e < n_mat; e++)
+   {
+      for (int i = 0; i < n; i++) { A(i,i,e) = (e % 2 == 0 && n > 1) ? 0.0 : n; }
+   }
+   Vector x(n*n_rhs*n_mat);
+   x.Randomize(2);
+
+   const BatchedLinAlgBase &simd = BatchedLinAlg::Get(BatchedLinAlg::CPU_SIMD);
+   const BatchedLinAlgBase &native = BatchedLinAlg::Get(BatchedLinAlg::NATIVE);
+
+   // Same factors and pivots as the NATIVE backend
+   DenseTensor LU_simd(A), LU_native(A);
+   Array<int> P_simd, P_native;
+   simd.LUFactor(LU_simd, P_simd);
+   native.LUFactor(LU_native, P_native);
+   for (int i = 0; i < P_native.Size(); i++)
+   {
+      REQUIRE(P_simd[i] == P_native[i]);
+   }
+   for (int i = 0; i < n*n*n_mat; i++)
+   {
+      REQUIRE(LU_simd.Data()[i] == MFEM_Approx(LU_native.Data()[i]));
+   }
+
+   // Solve, and residual of the solution
+   Vector y(x);
+   simd.LUSolve(LU_simd, P_simd, y);
+   Vector r(x.Size());
+   native.Mult(A, y, r);
+   r -= x;
+   REQUIRE(r.Normlinf() == MFEM_Approx(0.0));
+
+   // Solve with the factors of the NATIVE backend
+   Vector z(x);
+   simd.LUSolve(LU_native, P_native, z);
+   z -= y;
+   REQUIRE(z.Normlinf() == MFEM_Approx(0.0));
+
+   // Solve with the interleaved factors, which are not affected by later
+   // factorizations into the same DenseTensor
+   const CPUSIMDBatchedLinAlg simd_f;
+   CPUSIMDBatchedLinAlg::Factors factors;
+   DenseTensor LU(A);
+   Array<int> P;
+   simd_f.LUFactor(LU, P, factors);
+   REQUIRE(factors.Size() == n);
+   REQUIRE(factors.NumMatrices() == n_mat);
+   LU = 0.0;
+   for (int e = 0; e < n_mat; e++)
+   {
+      for (int i = 0; i < n; i++) { LU(i,i,e) = 1.0; }
+   }
+   native.LUFactor(LU, P);
+   z = x;
+   simd_f.LUSolve(factors, z);
+   z -= y;
+   REQUIRE(z.Normlinf() == MFEM_Approx(0.0));
+   z = x;
+   simd.LUSolve(LU, P, z);
+   z -= x;
+   REQUIRE(z.Normlinf() == MFEM_Approx(0.0));
+
+   // Inverse
+   DenseTensor Ainv(A);
+   simd.Invert(Ainv);
+   DenseMatrix I(n);
+   for (int e = 0; e < n_mat; e++)
+   {
+      Mult(A(e), Ainv(e), I);
+      for (int i = 0; i < n; i++) { I(i,i) -= 1.0; }
+      REQUIRE(I.MaxMaxNorm() == MFEM_Approx(0.0));
+   }
+}
+
 TEST_CASE("DenseTensor copy", "[DenseMatrix][DenseTensor]")
 {
    DenseTensor t1(2,3,4);
@@ -493,6 +581,83 @@ TEST_CASE("DenseTensor copy", "[DenseMatrix][DenseTensor]")
    }
 }
 
+TEST_CASE("DenseMatrixBatch", "[DenseMatrix]")
+{
+   const int n = GENERATE(1, 2, 3, 5);
+   const int k = 2*DenseMatrixBatch::lanes + 3;
+
+   // Random matrices with a dominant diagonal, and rectangular factors
+   DenseTensor A(n, n, k), B(n, n, k), R(n, n + 2, k);
+   A.HostWrite();
+   for (int e = 0; e < k; e++)
+   {
+      Vector a(A(e).GetData(), n*n), b(B(e).GetData(), n*n);
+      Vector r(R(e).GetData(), n*(n + 2));
+      a.Randomize(e + 1);
+      b.Randomize(e + 100);
+      r.Randomize(e + 200);
+      for (int i = 0; i < n; i++) { A(i,i,e) += n; }
+      // Lanes that need pivoting in the Gauss-Jordan elimination
+      if (n > 3 && e % 2 == 0) { A(0,0,e) = 0.0; }
+   }
+   DenseMatrixBatch Ab(A), Bb(B), Rb(R);
+   REQUIRE(Ab.NumMatrices() == k);
+
+   DenseMatrixBatch Cb, Db;
+   Mult(Ab, Bb, Cb);
+   MultABt(Rb, Rb, Db);
+   DenseMatrixBatch Eb(Cb);
+   AddMult(Ab, Bb, Eb, -0.5);
+   AddMult_a_AAt(2.0, Rb, Eb);
+   AddMultABt(Rb, Rb, Eb, -1.5);
+   DenseMatrixBatch Ib(Ab);
+   Ib.Invert();
+
+   DenseMatrix C(n), D(n), E(n), I(n), M(n);
+   for (int e = 0; e < k; e++)
+   {
+      Mult(A(e), B(e), C);
+      MultABt(R(e), R(e), D);
+      E = C;
+      E *= 0.5;
+      AddMult_a_AAt(0.5, R(e), E);
+      DenseMatrixInverse inv(A(e));
+      inv.GetInverseMatrix(I);
+
+      Cb.GetMatrix(e, M);
+      M -= C;
+      REQUIRE(M.MaxMaxNorm() == MFEM_Approx(0.0));
+      Db.GetMatrix(e, M);
+      M -= D;
+      REQUIRE(M.MaxMaxNorm() == MFEM_Approx(0.0));
+      Eb.GetMatrix(e, M);
+      M -= E;
+      REQUIRE(M.MaxMaxNorm() == MFEM_Approx(0.0));
+      Ib.GetMatrix(e, M);
+      M -= I;
+      REQUIRE(M.MaxMaxNorm() == MFEM_Approx(0.0));
+   }
+
+   // Batched matrix-vector products, with one column
+   DenseMatrixBatch xb(n, 1, k), yb;
+   for (int e = 0; e < k; e++)
+   {
+      for (int i = 0; i < n; i++) { xb(i, 0, e) = 1.0 + i - e; }
+   }
+   Mult(Ab, xb, yb);
+   DenseTensor Y;
+   yb.CopyTo(Y);
+   REQUIRE(Y.SizeI() == n);
+   REQUIRE(Y.SizeJ() == 1);
+   for (int e = 0; e < k; e++)
+   {
+      Vector x(n), y(n);
+      for (int i = 0; i < n; i++) { x(i) = 1.0 + i - e; }
+      A(e).Mult(x, y);
+      for (int i = 0; i < n; i++) { REQUIRE(Y(i, 0, e) == MFEM_Approx(y(i))); }
+   }
+}
+
 TEST_CASE("MatrixInverse", "[DenseMatrix]")
 {
    real_t tol = 1e-10;
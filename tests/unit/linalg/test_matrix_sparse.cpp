@@ -11,6 +11,7 @@
 
 #include "mfem.hpp"
 #include "unit_tests.hpp"
+#include <memory>
 #include <sstream>
 
 namespace mfem
@@ -240,4 +241,140 @@ TEST_CASE("SparseMatrix printing", "[SparseMatrix]")
    }
 }
 
+TEST_CASE("SparseMatrix SpMV formats", "[SparseMatrix]")
+{
+   const int dim = GENERATE(2, 3);
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   CAPTURE(dim, ordering);
+
+   Mesh mesh = dim == 2 ?
+               Mesh::MakeCartesian2D(4, 3, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(2, 2, 3, Element::HEXAHEDRON);
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim, ordering);
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new ElasticityIntegrator(one, one));
+   a.Assemble();
+   a.Finalize();
+
+   // Make the matrix nonsymmetric, to check the transpose products
+   SparseMatrix &A = a.SpMat();
+   Vector s(A.Height());
+   s.Randomize(1);
+   s += 1.0;
+   A.ScaleRows(s);
+
+   Vector x(A.Width()), y(A.Height()), y_csr(A.Height());
+   Vector xt(A.Height()), yt(A.Width()), yt_csr(A.Width());
+   x.Randomize(2);
+   xt.Randomize(3);
+   A.Mult(x, y_csr);
+   A.MultTranspose(xt, yt_csr);
+
+   auto check = [&]()
+   {
+      A.Mult(x, y);
+      y -= y_csr;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+      A.MultTranspose(xt, yt);
+      yt -= yt_csr;
+      REQUIRE(yt.Normlinf() == MFEM_Approx(0.0));
+      A.AddMult(x, y, -1.0);
+      y += y_csr;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   };
+
+   SECTION("SELL-C-sigma")
+   {
+      for (int C : {4, 5, 8, 16})
+      {
+         for (int sigma : {1, 64})
+         {
+            CAPTURE(C, sigma);
+            A.BuildSELL(C, sigma);
+            check();
+         }
+      }
+   }
+
+   SECTION("Block CSR")
+   {
+      A.BuildBCSR(dim, ordering == Ordering::byVDIM);
+      check();
+      // Blocks of size 1 (plain CSR) use the generic kernel
+      A.BuildBCSR(1);
+      check();
+   }
+
+   A.ResetSpMVFormat();
+   check();
+}
+
+TEST_CASE("SparseMatrix products", "[SparseMatrix]")
+{
+   const int nt = GENERATE(1, 2, 5);
+   ThreadPool pool(nt);
+
+   Mesh mesh = Mesh::MakeCartesian2D(6, 5, Element::QUADRILATERAL);
+   H1_FECollection fec1(1, 2), fec2(2, 2);
+   FiniteElementSpace fes1(&mesh, &fec1), fes2(&mesh, &fec2);
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes2);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+   a.Finalize();
+   SparseMatrix &A = a.SpMat();
+   DiscreteLinearOperator interp(&fes1, &fes2);
+   interp.AddDomainInterpolator(new IdentityInterpolator);
+   interp.Assemble();
+   interp.Finalize();
+   SparseMatrix &P = interp.SpMat();
+   std::unique_ptr<SparseMatrix> Pt(Transpose(P));
+
+   auto MaxDiff = [](const SparseMatrix &X, const SparseMatrix &Y)
+   {
+      std::unique_ptr<SparseMatrix> D(Add(1.0, X, -1.0, Y));
+      return D->MaxNorm();
+   };
+
+   SECTION("Symbolic and numeric phases")
+   {
+      std::unique_ptr<SparseMatrix> AP(Mult(A, P));
+      std::unique_ptr<SparseMatrix> AP_t(MultSymbolic(A, P, pool));
+      MultNumeric(A, P, *AP_t, pool);
+      REQUIRE(AP->NumNonZeroElems() == AP_t->NumNonZeroElems());
+      for (int i = 0; i <= A.Height(); i++)
+      {
+         REQUIRE(AP->GetI()[i] == AP_t->GetI()[i]);
+      }
+      for (int k = 0; k < AP->NumNonZeroElems(); k++)
+      {
+         REQUIRE(AP->GetJ()[k] == AP_t->GetJ()[k]);
+         REQUIRE(AP->GetData()[k] == AP_t->GetData()[k]);
+      }
+
+      // Reuse of the sparsity with new entries
+      SparseMatrix A2(A);
+      A2 *= 2.0;
+      MultNumeric(A2, P, *AP_t, pool);
+      *AP *= 2.0;
+      REQUIRE(MaxDiff(*AP, *AP_t) == MFEM_Approx(0.0));
+      Mult(A2, P, AP.get());
+      REQUIRE(MaxDiff(*AP, *AP_t) == MFEM_Approx(0.0));
+   }
+
+   SECTION("Repeated RAP")
+   {
+      std::unique_ptr<SparseMatrix> PtAP(RAP(A, *Pt));
+      SparseRAP rap(*Pt, A, P);
+      REQUIRE(MaxDiff(*PtAP, rap.GetProduct()) == MFEM_Approx(0.0));
+
+      SparseMatrix A3(A);
+      A3 *= 3.0;
+      *PtAP *= 3.0;
+      REQUIRE(MaxDiff(*PtAP, rap.Mult(*Pt, A3, P)) == MFEM_Approx(0.0));
+   }
+}
+
 } // namespace mfem
@@ -0,0 +1,142 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace
+{
+
+// Max difference between A.ArrayMult() and A.Mult() applied to each column.
+real_t ArrayMultError(const Operator &A, int nvec)
+{
+   MultiVector X(A.Width(), nvec), Y(A.Height(), nvec);
+   X.Randomize(1);
+   A.ArrayMult(X.GetConstColumns(), Y.GetColumns());
+   Y.SyncFromColumns();
+   real_t err = 0.0;
+   Vector y(A.Height());
+   for (int j = 0; j < nvec; j++)
+   {
+      A.Mult(X.GetColumn(j), y);
+      y -= Y.GetColumn(j);
+      err = std::max(err, y.Normlinf());
+   }
+   return err;
+}
+
+} // namespace
+
+TEST_CASE("MultiVector", "[MultiVector]")
+{
+   const int n = 13, k = 3;
+   MultiVector X(n, k);
+   REQUIRE(X.Size() == n*k);
+   REQUIRE(X.VectorSize() == n);
+   REQUIRE(X.NumVectors() == k);
+   X.Randomize(1);
+
+   SECTION("Layout")
+   {
+      MultiVector Y(X);
+      Y.SetLayout(MultiVector::Layout::INTERLEAVED);
+      Vector x, y;
+      for (int j = 0; j < k; j++)
+      {
+         X.CopyColumn(j, x);
+         Y.CopyColumn(j, y);
+         for (int i = 0; i < n; i++)
+         {
+            REQUIRE(Y(i*k + j) == X(j*n + i));
+            REQUIRE(y(i) == x(i));
+         }
+      }
+      y.Randomize(2);
+      Y.SetColumn(1, y);
+      Y.SetLayout(MultiVector::Layout::COLUMNS);
+      for (int i = 0; i < n; i++)
+      {
+         REQUIRE(Y.GetColumn(0)(i) == X.GetColumn(0)(i));
+         REQUIRE(Y.GetColumn(1)(i) == y(i));
+      }
+   }
+
+   SECTION("InnerProducts and AddMult")
+   {
+      MultiVector Y(n, k + 1);
+      Y.Randomize(2);
+      DenseMatrix G;
+      X.InnerProducts(Y, G);
+      REQUIRE(G.Height() == k);
+      REQUIRE(G.Width() == k + 1);
+      for (int i = 0; i < k; i++)
+      {
+         for (int j = 0; j <= k; j++)
+         {
+            REQUIRE(G(i,j) == MFEM_Approx(X.GetColumn(i)*Y.GetColumn(j)));
+         }
+      }
+
+      DenseMatrix C(k + 1, k);
+      for (int j = 0; j < k; j++)
+      {
+         for (int i = 0; i <= k; i++) { C(i,j) = 1.0 + i - 0.5*j; }
+      }
+      MultiVector Z(X);
+      Z.AddMult(Y, C, -2.0);
+      for (int j = 0; j < k; j++)
+      {
+         Vector z(X.GetColumn(j));
+         for (int i = 0; i <= k; i++) { z.Add(-2.0*C(i,j), Y.GetColumn(i)); }
+         z -= Z.GetColumn(j);
+         REQUIRE(z.Normlinf() == MFEM_Approx(0.0));
+      }
+   }
+}
+
+TEST_CASE("ArrayMult of sparse and partially assembled operators",
+          "[MultiVector]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = 2;
+   Mesh mesh = dim == 2 ?
+               Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   BilinearForm a_fa(&fes), a_pa(&fes);
+   for (BilinearForm *a : {&a_fa, &a_pa})
+   {
+      a->AddDomainIntegrator(new DiffusionIntegrator(one));
+      a->AddDomainIntegrator(new MassIntegrator(one));
+   }
+   a_fa.Assemble();
+   a_fa.Finalize();
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_pa.Assemble();
+
+   for (int nvec : {1, 3, 11})
+   {
+      REQUIRE(ArrayMultError(a_fa.SpMat(), nvec) == MFEM_Approx(0.0));
+      REQUIRE(ArrayMultError(a_pa, nvec) == MFEM_Approx(0.0));
+
+      // The constrained operator of FormSystemMatrix()
+      OperatorHandle A;
+      a_pa.FormSystemMatrix(ess_tdof_list, A);
+      REQUIRE(ArrayMultError(*A, nvec) == MFEM_Approx(0.0));
+   }
+}
@@ -305,6 +305,24 @@ TEST_CASE("First order ODE methods", "[ODE]")
       REQUIRE(check.order(new RK8Solver) + tol > 8.0);
    }
 
+   SECTION("WilliamsonRK3Solver")
+   {
+      mfem::out<<"WilliamsonRK3Solver"<<std::endl;
+      REQUIRE(check.order(new WilliamsonRK3Solver) + tol > 3.0);
+   }
+
+   SECTION("CarpenterKennedyRK4Solver")
+   {
+      mfem::out<<"CarpenterKennedyRK4Solver"<<std::endl;
+      REQUIRE(check.order(new CarpenterKennedyRK4Solver) + tol > 4.0);
+   }
+
+   SECTION("SSPRK104Solver")
+   {
+      mfem::out<<"SSPRK104Solver"<<std::endl;
+      REQUIRE(check.order(new SSPRK104Solver) + tol > 4.0);
+   }
+
    SECTION("ImplicitMidpointSolver")
    {
       mfem::out<<"ImplicitMidpoint"<<std::endl;
@@ -474,3 +492,195 @@ TEST_CASE("First order ODE methods", "[ODE]")
    }
 
 }
+
+TEST_CASE("IMEX ODE methods", "[ODE]")
+{
+   // du/dt = k1(u) + k2(u) with the nonstiff rotation k1(u) = (u1, -u0) and
+   // the stiff damping k2(u) = -lambda u.
+   class ODE : public TimeDependentOperator
+   {
+   protected:
+      real_t lambda;
+   public:
+      ODE(real_t lambda_) : TimeDependentOperator(2, (real_t) 0.0),
+         lambda(lambda_) { }
+
+      void Mult(const Vector &u, Vector &dudt) const override
+      {
+         REQUIRE(eval_mode != NORMAL);
+         if (eval_mode == ADDITIVE_TERM_1)
+         {
+            dudt(0) = u(1);
+            dudt(1) = -u(0);
+         }
+         else
+         {
+            dudt.Set(-lambda, u);
+         }
+      }
+
+      void ImplicitSolve(const real_t dt, const Vector &u, Vector &dudt) override
+      {
+         REQUIRE(eval_mode == ADDITIVE_TERM_2);
+         dudt.Set(-lambda/(1.0 + lambda*dt), u);
+      }
+   };
+
+   auto error = [](ODESolver &ode_solver, real_t lambda, int steps)
+   {
+      ODE oper(lambda);
+      ode_solver.Init(oper);
+      Vector u(2);
+      u = 1.0;
+      real_t t = 0.0;
+      const real_t t_final = 1.0;
+      real_t dt = t_final/steps;
+      for (int i = 0; i < steps; i++) { ode_solver.Step(u, t, dt); }
+      REQUIRE(oper.GetEvalMode() == TimeDependentOperator::NORMAL);
+
+      const real_t decay = exp(-lambda*t_final);
+      Vector u_ex(2);
+      u_ex(0) = decay*(cos(t_final) + sin(t_final));
+      u_ex(1) = decay*(cos(t_final) - sin(t_final));
+      u -= u_ex;
+      return u.Normlinf();
+   };
+
+   auto check = [&](ODESolver &ode_solver)
+   {
+      // Third order convergence
+      const real_t err0 = error(ode_solver, 1.0, 20);
+      const real_t err1 = error(ode_solver, 1.0, 40);
+      mfem::out << "errors " << err0 << " " << err1 << std::endl;
+      REQUIRE(log(err0/err1)/log(2.0) > 2.9);
+
+      // Stable and accurate with a time step much larger than 1/lambda
+      REQUIRE(error(ode_solver, 1e6, 10) < 1e-6);
+   };
+
+   SECTION("IMEXARK3Solver()")
+   {
+      IMEXARK3Solver ode_solver;
+      check(ode_solver);
+   }
+
+   SECTION("IMEXARS443Solver()")
+   {
+      IMEXARS443Solver ode_solver;
+      check(ode_solver);
+   }
+}
+
+TEST_CASE("Adaptive ODE methods", "[ODE]")
+{
+   // du/dt + A u = 0 with the eigenvalues 1 and lambda of A.
+   class ODE : public TimeDependentOperator
+   {
+   protected:
+      DenseMatrix A, T;
+   public:
+      int num_solves = 0;
+
+      ODE(real_t lambda) : TimeDependentOperator(2, (real_t) 0.0), A(2), T(2)
+      {
+         A(0,0) = 1.0;
+         A(0,1) = 0.5;
+         A(1,0) = 0.0;
+         A(1,1) = lambda;
+      }
+
+      void Mult(const Vector &u, Vector &dudt) const override
+      {
+         A.Mult(u, dudt);
+         dudt.Neg();
+      }
+
+      void ImplicitSolve(const real_t dt, const Vector &u, Vector &dudt) override
+      {
+         num_solves++;
+         Vector r(2);
+         A.Mult(u, r);
+         r.Neg();
+         T = A;
+         T *= dt;
+         T(0,0) += 1.0;
+         T(1,1) += 1.0;
+         T.Invert();
+         T.Mult(r, dudt);
+      }
+   };
+
+   auto error = [](AdaptiveODESolver &ode_solver, real_t lambda, real_t rtol,
+                   int &num_steps)
+   {
+      ODE oper(lambda);
+      ode_solver.Init(oper);
+      ode_solver.SetTolerances(rtol, rtol);
+      Vector u(2);
+      u = 1.0;
+      real_t t = 0.0, dt = 0.1;
+      const real_t t_final = 2.0;
+      ode_solver.Run(u, t, dt, t_final);
+      REQUIRE(t == t_final);
+      REQUIRE(dt == real_t(0.1));
+      REQUIRE(ode_solver.GetNextStepSize() > 0.0);
+      num_steps = ode_solver.GetNumSteps();
+
+      const real_t C = 0.5/(lambda - 1.0);
+      Vector u_ex(2);
+      u_ex(0) = (1.0 - C)*exp(-t_final) + C*exp(-lambda*t_final);
+      u_ex(1) = exp(-lambda*t_final);
+      u -= u_ex;
+      return u.Normlinf();
+   };
+
+   auto check = [&](AdaptiveODESolver &ode_solver, real_t lambda)
+   {
+      int steps_coarse, steps_fine;
+      const real_t err_coarse = error(ode_solver, lambda, 1e-4, steps_coarse);
+      const real_t err_fine = error(ode_solver, lambda, 1e-8, steps_fine);
+      mfem::out << "errors " << err_coarse << " " << err_fine << ", steps "
+                << steps_coarse << " " << steps_fine << std::endl;
+      // The global error follows the tolerance.
+      REQUIRE(err_coarse < 1e-3);
+      REQUIRE(err_fine < 1e-7);
+      REQUIRE(steps_fine > steps_coarse);
+   };
+
+   SECTION("BogackiShampineSolver()")
+   {
+      BogackiShampineSolver ode_solver;
+      check(ode_solver, 2.0);
+   }
+
+   SECTION("DormandPrinceSolver()")
+   {
+      DormandPrinceSolver ode_solver;
+      check(ode_solver, 2.0);
+   }
+
+   SECTION("CashKarpSolver()")
+   {
+      CashKarpSolver ode_solver;
+      check(ode_solver, 2.0);
+   }
+
+   SECTION("AdaptiveESDIRK3Solver()")
+   {
+      AdaptiveESDIRK3Solver ode_solver;
+      check(ode_solver, 2.0);
+      check(ode_solver, 1000.0);
+   }
+
+   SECTION("AdaptiveESDIRK4Solver()")
+   {
+      AdaptiveESDIRK4Solver ode_solver;
+      check(ode_solver, 2.0);
+      check(ode_solver, 1000.0);
+
+      // In the stiff case, the step size is not limited by the stability.
+      int num_steps;
+      error(ode_solver, 1000.0, 1e-4, num_steps);
+      REQUIRE(num_steps < 50);
+   }
+}
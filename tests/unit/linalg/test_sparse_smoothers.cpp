@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("MulticolorGSSmoother", "[MulticolorGSSmoother]")
+{
+   const int dim = GENERATE(2, 3);
+   const int distance = GENERATE(1, 2);
+   CAPTURE(dim, distance);
+
+   Mesh mesh = dim == 2 ?
+               Mesh::MakeCartesian2D(6, 6, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator);
+   a.Assemble();
+   SparseMatrix A;
+   a.FormSystemMatrix(ess_tdof_list, A);
+   const int n = A.Height();
+
+   MulticolorGSSmoother S(A, 0, 1, 1.0, distance);
+
+   SECTION("Coloring")
+   {
+      Array<int> colors;
+      S.GetColoring(colors);
+      REQUIRE(colors.Size() == n);
+      REQUIRE(S.GetNumColors() > 1);
+      REQUIRE(colors.Max() == S.GetNumColors() - 1);
+      // Rows of the same color are not coupled (distance 1) and have no common
+      // neighbor (distance 2).
+      SparseMatrix *At = Transpose(A);
+      SparseMatrix *G = Add(A, *At);
+      SparseMatrix *G2 = distance == 2 ? mfem::Mult(*G, *G) : nullptr;
+      for (SparseMatrix *M : {G, G2})
+      {
+         if (!M) { continue; }
+         for (int i = 0; i < n; i++)
+         {
+            for (int k = M->GetI()[i]; k < M->GetI()[i+1]; k++)
+            {
+               const int j = M->GetJ()[k];
+               if (j != i) { REQUIRE(colors[i] != colors[j]); }
+            }
+         }
+      }
+      delete G2;
+      delete G;
+      delete At;
+   }
+
+   SECTION("Symmetry and convergence")
+   {
+      const real_t omega = GENERATE(1.0, 1.2);
+      MulticolorGSSmoother SSOR(A, 0, 2, omega, distance);
+      Vector x(n), y(n), Sx(n), Sy(n);
+      x.Randomize(1);
+      y.Randomize(2);
+      SSOR.Mult(x, Sx);
+      SSOR.Mult(y, Sy);
+      REQUIRE((x*Sy) == MFEM_Approx(y*Sx));
+
+      // Stationary iterations with the forward and backward sweeps
+      Vector b(n), r(n);
+      b.Randomize(3);
+      for (int type : {1, 2})
+      {
+         MulticolorGSSmoother GS(A, type, 50, omega, distance);
+         GS.iterative_mode = false;
+         GS.Mult(b, x);
+         A.Mult(x, r);
+         r -= b;
+         REQUIRE(r.Norml2() < 0.1*b.Norml2());
+      }
+
+      // Preconditioned CG
+      CGSolver cg;
+      cg.SetOperator(A);
+      cg.SetPreconditioner(SSOR);
+      cg.SetRelTol(1e-10);
+      cg.SetMaxIter(200);
+      x = 0.0;
+      cg.Mult(b, x);
+      REQUIRE(cg.GetConverged());
+   }
+
+   SECTION("Reuse of the coloring")
+   {
+      Array<int> colors, colors2;
+      S.GetColoring(colors);
+      Vector b(n), x(n), x2(n);
+      b.Randomize(4);
+      S.Mult(b, x);
+
+      SparseMatrix A2(A);
+      A2 *= 2.0;
+      S.SetOperator(A2);
+      S.GetColoring(colors2);
+      S.Mult(b, x2);
+      for (int i = 0; i < n; i++) { REQUIRE(colors2[i] == colors[i]); }
+      x2 *= 2.0;
+      x2 -= x;
+      REQUIRE(x2.Normlinf() == MFEM_Approx(0.0));
+   }
+}
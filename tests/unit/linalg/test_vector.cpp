@@ -12,6 +12,7 @@
 #include "mfem.hpp"
 #include "unit_tests.hpp"
 #include <numeric>
+#include <vector>
 
 using namespace mfem;
 
@@ -247,3 +248,80 @@ TEST_CASE("Vector Sum", "[Vector],[CUDA]")
 
    REQUIRE(sum_1 == MFEM_Approx(sum_2));
 }
+
+TEST_CASE("Vector fused operations", "[Vector],[CUDA]")
+{
+   const int n = 1000, nv = 11;
+   Vector x(n), y(n), z(n);
+   x.Randomize(1);
+   y.Randomize(2);
+   z.Randomize(3);
+   std::vector<Vector> v(nv);
+   Array<const Vector*> pv(nv);
+   Vector a(nv);
+   for (int k = 0; k < nv; k++)
+   {
+      v[k].SetSize(n);
+      v[k].Randomize(4 + k);
+      v[k].UseDevice(true);
+      pv[k] = &v[k];
+      a(k) = 0.1*(k + 1);
+   }
+   x.UseDevice(true);
+   y.UseDevice(true);
+   z.UseDevice(true);
+   const real_t tol = 1e-12;
+
+   SECTION("AddDot")
+   {
+      Vector y_ref(y);
+      y_ref.Add(0.5, x);
+      const real_t dot_ref = y_ref * z;
+      Vector y2(y);
+      const real_t dot = AddDot(0.5, x, y, z);
+      REQUIRE(dot == MFEM_Approx(dot_ref));
+      y -= y_ref;
+      REQUIRE(y.Normlinf() < tol);
+      // Squared norm of the updated vector
+      y_ref.Add(-1.0, x);
+      REQUIRE(AddDot(-0.5, x, y2, y2) == MFEM_Approx(y_ref * y_ref));
+   }
+
+   SECTION("AddAdd and AddAddDot")
+   {
+      Vector y_ref(y), z_ref(z);
+      y_ref.Add(0.5, x);
+      z_ref.Add(-2.0, v[0]);
+      Vector y2(y), z2(z);
+      AddAdd(0.5, x, y, -2.0, v[0], z);
+      const real_t dot = AddAddDot(0.5, x, y2, -2.0, v[0], z2, z2);
+      REQUIRE(dot == MFEM_Approx(z_ref * z_ref));
+      y -= y_ref;
+      z -= z_ref;
+      y2 -= y_ref;
+      z2 -= z_ref;
+      REQUIRE(y.Normlinf() < tol);
+      REQUIRE(z.Normlinf() < tol);
+      REQUIRE(y2.Normlinf() < tol);
+      REQUIRE(z2.Normlinf() < tol);
+   }
+
+   SECTION("MDot")
+   {
+      Vector dots(nv);
+      MDot(x, nv, pv.GetData(), dots.GetData());
+      for (int k = 0; k < nv; k++)
+      {
+         REQUIRE(dots(k) == MFEM_Approx(x * v[k]));
+      }
+   }
+
+   SECTION("MAdd")
+   {
+      Vector x_ref(x);
+      for (int k = 0; k < nv; k++) { x_ref.Add(a(k), v[k]); }
+      MAdd(x, nv, a.HostRead(), pv.GetData());
+      x -= x_ref;
+      REQUIRE(x.Normlinf() < tol);
+   }
+}
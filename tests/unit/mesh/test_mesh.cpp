@@ -265,3 +265,80 @@ TEST_CASE("MakeNurbs", "[Mesh]")
       Mesh::MakeCartesian3D(1, 1, 1, Element::Type::HEXAHEDRON);
    test_nurbs_extension(patch_topology_3d);
 }
+
+TEST_CASE("Binary mesh format", "[Mesh]")
+{
+   auto check_same_mesh = [](const Mesh &m1, const Mesh &m2)
+   {
+      REQUIRE(m1.Dimension() == m2.Dimension());
+      REQUIRE(m1.SpaceDimension() == m2.SpaceDimension());
+      REQUIRE(m1.GetNV() == m2.GetNV());
+      REQUIRE(m1.GetNE() == m2.GetNE());
+      REQUIRE(m1.GetNBE() == m2.GetNBE());
+      for (int i = 0; i < m1.GetNE(); i++)
+      {
+         Array<int> v1, v2;
+         m1.GetElementVertices(i, v1);
+         m2.GetElementVertices(i, v2);
+         REQUIRE(m1.GetElementGeometry(i) == m2.GetElementGeometry(i));
+         REQUIRE(m1.GetAttribute(i) == m2.GetAttribute(i));
+         REQUIRE(v1 == v2);
+      }
+      for (int i = 0; i < m1.GetNBE(); i++)
+      {
+         Array<int> v1, v2;
+         m1.GetBdrElementVertices(i, v1);
+         m2.GetBdrElementVertices(i, v2);
+         REQUIRE(m1.GetBdrAttribute(i) == m2.GetBdrAttribute(i));
+         REQUIRE(v1 == v2);
+      }
+      for (int i = 0; i < m1.GetNV(); i++)
+      {
+         for (int d = 0; d < m1.SpaceDimension(); d++)
+         {
+            REQUIRE(m1.GetVertex(i)[d] == m2.GetVertex(i)[d]);
+         }
+      }
+   };
+
+   SECTION("Linear mixed mesh with attribute sets")
+   {
+      Mesh mesh = Mesh::MakeCartesian3D(2, 2, 2, Element::WEDGE);
+      mesh.attribute_sets.CreateAttributeSet("domain") = Array<int>({1});
+      mesh.bdr_attribute_sets.CreateAttributeSet("walls") = Array<int>({2, 3});
+
+      std::stringstream ss;
+      mesh.PrintBinary(ss);
+      Mesh loaded(ss);
+      check_same_mesh(mesh, loaded);
+      REQUIRE(loaded.attribute_sets.AttributeSetExists("domain"));
+      REQUIRE(loaded.bdr_attribute_sets.GetAttributeSet("walls").Size() == 2);
+   }
+
+   SECTION("Curved mesh and GridFunction")
+   {
+      Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::TRIANGLE);
+      mesh.SetCurvature(3);
+
+      std::stringstream ss;
+      mesh.PrintBinary(ss);
+      Mesh loaded(ss);
+      check_same_mesh(mesh, loaded);
+      REQUIRE(loaded.GetNodes() != nullptr);
+      Vector diff(*mesh.GetNodes());
+      diff -= *loaded.GetNodes();
+      REQUIRE(diff.Normlinf() == 0.0);
+
+      H1_FECollection fec(2, mesh.Dimension());
+      FiniteElementSpace fes(&mesh, &fec);
+      GridFunction gf(&fes);
+      gf.Randomize(1);
+
+      std::stringstream gs;
+      gf.SaveBinary(gs);
+      GridFunction gf_loaded(&mesh, gs);
+      REQUIRE(gf_loaded.Size() == gf.Size());
+      gf_loaded -= gf;
+      REQUIRE(gf_loaded.Normlinf() == 0.0);
+   }
+}
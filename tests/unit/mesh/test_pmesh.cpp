@@ -194,6 +194,53 @@ TEST_CASE("ParMeshMakeSimplicial", "[Parallel], [ParMesh]")
    REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("ParMeshPrintBinary", "[Parallel], [ParMesh]")
+{
+   // ParPrintBinary and ParPrint must give the same ParMesh when loaded back
+   const bool curved = GENERATE(false, true);
+   CAPTURE(curved);
+
+   Mesh mesh = Mesh::MakeCartesian3D(3, 3, 3, Element::TETRAHEDRON);
+   if (curved) { mesh.SetCurvature(2); }
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+   std::stringstream text, binary;
+   pmesh.ParPrint(text);
+   pmesh.ParPrintBinary(binary);
+   ParMesh from_text(MPI_COMM_WORLD, text, false);
+   ParMesh from_binary(MPI_COMM_WORLD, binary, false);
+
+   REQUIRE(from_binary.GetNE() == from_text.GetNE());
+   REQUIRE(from_binary.GetNBE() == from_text.GetNBE());
+   REQUIRE(from_binary.GetNV() == from_text.GetNV());
+   REQUIRE(from_binary.GetNSharedFaces() == from_text.GetNSharedFaces());
+   REQUIRE(from_binary.GetGlobalNE() == pmesh.GetGlobalNE());
+   REQUIRE((from_binary.GetNodes() != nullptr) == curved);
+
+   Array<int> v1, v2;
+   for (int i = 0; i < from_text.GetNE(); i++)
+   {
+      from_text.GetElementVertices(i, v1);
+      from_binary.GetElementVertices(i, v2);
+      REQUIRE(v1 == v2);
+      REQUIRE(from_text.GetAttribute(i) == from_binary.GetAttribute(i));
+   }
+   for (int i = 0; i < from_text.GetNV(); i++)
+   {
+      for (int d = 0; d < 3; d++)
+      {
+         REQUIRE(from_text.GetVertex(i)[d] == from_binary.GetVertex(i)[d]);
+      }
+   }
+
+   // The shared entities are read back such that the parallel spaces match
+   H1_FECollection fec(2, 3);
+   ParFiniteElementSpace fes_text(&from_text, &fec);
+   ParFiniteElementSpace fes_binary(&from_binary, &fec);
+   REQUIRE(fes_binary.GlobalTrueVSize() == fes_text.GlobalTrueVSize());
+   REQUIRE(fes_binary.GetTrueVSize() == fes_text.GetTrueVSize());
+}
+
 #endif // MFEM_USE_MPI
 
 } // namespace mfem
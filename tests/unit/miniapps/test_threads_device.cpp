@@ -0,0 +1,76 @@
+// Copyright (c) 2010-2024, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#define CATCH_CONFIG_RUNNER
+#include "mfem.hpp"
+#include "general/forall.hpp"
+#include "run_unit_tests.hpp"
+
+using namespace mfem;
+
+static constexpr int num_threads = 4;
+
+TEST_CASE("forall/CPUThreads", "[CPUThreads]")
+{
+   REQUIRE(Device::Allows(Backend::CPU_THREADS));
+   REQUIRE(ThreadPool::Global().NumThreads() == num_threads);
+
+   const int N = 100000;
+   Vector x(N), y(N);
+   x.Randomize(1);
+   const real_t *X = x.Read();
+   real_t *Y = y.Write();
+   mfem::forall(N, [=] MFEM_HOST_DEVICE (int i)
+   {
+      Y[i] = X[i]*X[i] + (i % 7);
+   });
+   y.HostRead();
+   for (int i = 0; i < N; i++) { REQUIRE(y(i) == x(i)*x(i) + (i % 7)); }
+}
+
+TEST_CASE("PA BilinearForm/CPUThreads", "[CPUThreads]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = 2;
+   CAPTURE(dim);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   // The threaded partial assembly and the serial full assembly give the same
+   // operator
+   BilinearForm a_pa(&fes), a_fa(&fes);
+   for (BilinearForm *a : {&a_pa, &a_fa})
+   {
+      a->AddDomainIntegrator(new DiffusionIntegrator);
+      a->AddDomainIntegrator(new MassIntegrator);
+   }
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_pa.Assemble();
+   a_fa.Assemble();
+   a_fa.Finalize();
+
+   Vector x(fes.GetTrueVSize()), y_pa(x.Size()), y_fa(x.Size());
+   x.Randomize(1);
+   a_pa.Mult(x, y_pa);
+   a_fa.SpMat().Mult(x, y_fa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+}
+
+int main(int argc, char *argv[])
+{
+   Device device("cpu-threads:" + std::to_string(num_threads));
+   return RunCatchSession(argc, argv, {"[CPUThreads]"});
+}